@@ -12,6 +12,17 @@
 #include <QFile>
 #include <QDir>
 #include <QException>
+#include <QFuture>
+#include <QMutex>
+#include <QQueue>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
 
 #include <OPGUIPCMSimulation.h>
 #include <OPGUIQtLogger.h>
@@ -181,123 +192,295 @@ namespace OPGUIPCMSimulation
         return true;
     }
 
+    namespace
+    {
+        //! Number of cases read from the database at once
+        constexpr int READ_BATCH_SIZE = 100;
+
+        //! Combination of the systems of the other agents, the first and the second car
+        struct SystemCombination
+        {
+            QString name;
+            QString otherSystem;
+            QString car1System;
+            QString car2System;
+        };
+
+        //! Configs of one system combination of one PCM case, generated for all variations by one writer
+        struct ConfigJob
+        {
+            QString pcmCase;
+            int pcmCaseIndex;
+            const SystemCombination *systemCombination;
+            std::shared_ptr<const PCM_SimulationSet> simulationSet;
+        };
+
+        //! Bounded queue between the database reader and the config writers
+        class ConfigJobQueue
+        {
+            public:
+                explicit ConfigJobQueue(int capacity) : capacity(capacity) {}
+
+                //! Blocks while the queue is full, returns false if generation was aborted
+                bool Push(ConfigJob job)
+                {
+                    QMutexLocker locker(&mutex);
+                    while (!aborted && jobs.size() >= capacity)
+                    {
+                        notFull.wait(&mutex);
+                    }
+                    if (aborted)
+                    {
+                        return false;
+                    }
+                    jobs.enqueue(std::move(job));
+                    notEmpty.wakeOne();
+                    return true;
+                }
+
+                //! Blocks while the queue is empty, returns false if all jobs are done or generation was aborted
+                bool Pop(ConfigJob &job)
+                {
+                    QMutexLocker locker(&mutex);
+                    while (!aborted && !closed && jobs.isEmpty())
+                    {
+                        notEmpty.wait(&mutex);
+                    }
+                    if (aborted || jobs.isEmpty())
+                    {
+                        return false;
+                    }
+                    job = jobs.dequeue();
+                    notFull.wakeOne();
+                    return true;
+                }
+
+                //! No more jobs will be pushed
+                void Close()
+                {
+                    QMutexLocker locker(&mutex);
+                    closed = true;
+                    notEmpty.wakeAll();
+                }
+
+                //! Drops all pending jobs and stops reader and writers
+                void Abort()
+                {
+                    QMutexLocker locker(&mutex);
+                    aborted = true;
+                    jobs.clear();
+                    notEmpty.wakeAll();
+                    notFull.wakeAll();
+                }
+
+            private:
+                const int capacity;
+                QQueue<ConfigJob> jobs;
+                QMutex mutex;
+                QWaitCondition notEmpty;
+                QWaitCondition notFull;
+                bool closed = false;
+                bool aborted = false;
+        };
+
+        // the random seed uses PCM case number if the inital seed is negative. Otherwise it uses the inital seed.
+        int GetRandomSeed(int initRandomSeed, int pcmCaseIndex, int varIndex)
+        {
+            return (initRandomSeed < 0) ? (pcmCaseIndex + varIndex)
+                                        : (initRandomSeed + varIndex);
+        }
+
+        //! Writes the configs of all jobs of the queue with an own config generator (and thus own writers)
+        bool WriteConfigJobs(ConfigJobQueue &queue, const QString &baseFolder, int variationCount, int initRandomSeed)
+        {
+            ConfigGenerator configGenerator(baseFolder);
+            ConfigJob job;
+
+            while (queue.Pop(job))
+            {
+                QString caseSystemName = job.pcmCase + "/" + job.systemCombination->name;
+
+                for (int varIndex = 0; varIndex <= variationCount; varIndex++)
+                {
+                    if (!configGenerator.WriteConfigs(job.pcmCase,
+                                                      caseSystemName,
+                                                      job.systemCombination->otherSystem,
+                                                      job.systemCombination->car1System,
+                                                      job.systemCombination->car2System,
+                                                      GetRandomSeed(initRandomSeed, job.pcmCaseIndex, varIndex),
+                                                      job.simulationSet.get()))
+                    {
+                        LOG_ERROR("Failed to generate configuration file for case: " + job.pcmCase);
+                        queue.Abort();
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+
     bool PCMSimulation::CreateConfigs(ConfigGenerator &configGenerator, 
                                         QStringList &pcmCaseIndexList, 
                                         QStringList &otherSytemList, 
                                         QStringList &car1SystemList, 
                                         QStringList &car2SystemList)
     {
-        for (auto &pcmCaseIndex : this->pcmSelectedCasesForSimulation)
-        {
+        std::vector<SystemCombination> systemCombinations;
 
-            // Prepare to read a simulation set
-            QString pcmCase = QString("%1").arg(pcmCaseIndex.toInt());
-            PCM_SimulationSet *simulationSet = ReadSimulationSetFromDb(pcmCase);
-            if (simulationSet == nullptr)
+        int otherSystemCount = 0;
+        for (const QString &otherSystem : otherSytemList)
+        {
+            if (otherSystem.isEmpty())
             {
-                LOG_ERROR("Failed to read data for case: " + pcmCase);
-                return false;
+                continue;
             }
-
-            int otherSystemCount = 0;
-            for (QString otherSystem : otherSytemList)
+            int car1SystemCount = 0;
+            for (const QString &car1System : car1SystemList)
             {
-                if (otherSystem.isEmpty())
+                if (car1System.isEmpty())
                 {
                     continue;
                 }
-                int car1SystemCount = 0;
-                for (QString car1System : car1SystemList)
+                int car2SystemCount = 0;
+                for (const QString &car2System : car2SystemList)
                 {
-                    if (car1System.isEmpty())
+                    if (car2System.isEmpty())
                     {
                         continue;
                     }
-                    int car2SystemCount = 0;
-                    for (QString car2System : car2SystemList)
+
+                    QString systemName = QString::number(otherSystemCount) + "-" + QString::number(car1SystemCount) + "-" + QString::number(car2SystemCount);
+                    systemCombinations.push_back({systemName, otherSystem, car1System, car2System});
+
+                    car2SystemCount++;
+                }
+                car1SystemCount++;
+            }
+            otherSystemCount++;
+        }
+
+        // The database is read on this thread, while a pool of writers generates the configs.
+        // Each writer handles all variations of a system combination, as they share one output folder.
+        const int writerCount = (configWriterCount > 0) ? configWriterCount : std::max(1, QThread::idealThreadCount());
+        ConfigJobQueue queue(2 * writerCount);
+        QThreadPool writerPool;
+        writerPool.setMaxThreadCount(writerCount);
+
+        QList<QFuture<bool>> writers;
+        for (int writerIndex = 0; writerIndex < writerCount; writerIndex++)
+        {
+            writers.append(QtConcurrent::run(&writerPool, [&queue, &configGenerator, this]()
+            {
+                return WriteConfigJobs(queue, configGenerator.GetBaseFolder(), variationCount, initRandomSeed);
+            }));
+        }
+
+        bool success = true;
+
+        // all cases are read with one database connection in batches
+        DatabaseReader dbReader;
+        dbReader.SetDatabase(this->pcmDBPath);
+        if (!dbReader.OpenDataBase())
+        {
+            LOG_ERROR("Failed to open database: " + this->pcmDBPath);
+            queue.Abort();
+            success = false;
+        }
+
+        for (int batchStart = 0; success && batchStart < this->pcmSelectedCasesForSimulation.size(); batchStart += READ_BATCH_SIZE)
+        {
+            QStringList pcmCaseBatch;
+            for (const QString &pcmCaseIndex : this->pcmSelectedCasesForSimulation.mid(batchStart, READ_BATCH_SIZE))
+            {
+                pcmCaseBatch.append(QString("%1").arg(pcmCaseIndex.toInt()));
+            }
+
+            std::map<QString, std::unique_ptr<PCM_SimulationSet>> simulationSets;
+            if (!ReadSimulationSetsFromDb(dbReader, pcmCaseBatch, simulationSets))
+            {
+                queue.Abort();
+                success = false;
+                break;
+            }
+
+            for (const QString &pcmCase : pcmCaseBatch)
+            {
+                auto simulationSetEntry = simulationSets.find(pcmCase);
+                if (simulationSetEntry == simulationSets.end())
+                {
+                    LOG_ERROR("Failed to read data for case: " + pcmCase);
+                    queue.Abort();
+                    success = false;
+                    break;
+                }
+
+                std::shared_ptr<const PCM_SimulationSet> simulationSet(std::move(simulationSetEntry->second));
+
+                for (const auto &systemCombination : systemCombinations)
+                {
+                    if (!queue.Push({pcmCase, pcmCase.toInt(), &systemCombination, simulationSet}))
                     {
-                        if (car2System.isEmpty())
-                        {
-                            continue;
-                        }
-
-                        QString systemName = QString::number(otherSystemCount) + "-" + QString::number(car1SystemCount) + "-" + QString::number(car2SystemCount);
-                        QString caseSystemName = pcmCase + "/" + systemName;
-
-                        for (int varIndex = 0; varIndex <= variationCount; varIndex++)
-                        {
-                            QString varName = QStringLiteral("");;
-                            bool withVariation = false;
-
-                            if (varIndex == 0)
-                            {
-                                varName = DIR_NO_VARIATION;
-                                withVariation = false;
-                            }
-                            else
-                            {
-                                varName = QString("Var_%1").arg(varIndex, 5, 10, QChar('0')); // zero padding if var index less than 5 digits
-                                withVariation = true;
-                            }
-
-                            QString caseSystemVarName = caseSystemName; 
-
-                            // the random seed uses PCM case number if the inital seed is negative. Otherwise it uses the inital seed.
-                            int randomSeed = (initRandomSeed < 0) ? (pcmCaseIndex.toInt() + varIndex)
-                                                              : (initRandomSeed + varIndex);
-
-                            if (!configGenerator.GenerateConfigs(pcmCase,
-                                                             caseSystemVarName,
-                                                             otherSystem, car1System, car2System,
-                                                             randomSeed,
-                                                             simulationSet))
-                            {
-
-                                LOG_ERROR("Failed to generate configuration file for case: " + pcmCase);
-      
-                                if (simulationSet != nullptr)
-                                {
-                                    delete simulationSet;
-                                }
-
-                                return false;
-                            }
-                        }
-
-                        car2SystemCount++;
+                        success = false;
+                        break;
                     }
-                    car1SystemCount++;
                 }
-                otherSystemCount++;
+
+                if (!success)
+                {
+                    break;
+                }
             }
+        }
+
+        dbReader.CloseDataBase();
+        queue.Close();
+
+        for (auto &writer : writers)
+        {
+            success = writer.result() && success;
+        }
+
+        if (!success)
+        {
+            return false;
+        }
+
+        // register the configs in the same order as they were generated sequentially before
+        for (auto &pcmCaseIndex : this->pcmSelectedCasesForSimulation)
+        {
+            QString pcmCase = QString("%1").arg(pcmCaseIndex.toInt());
 
-            if (simulationSet != nullptr)
+            for (const auto &systemCombination : systemCombinations)
             {
-                delete simulationSet;
+                for (int varIndex = 0; varIndex <= variationCount; varIndex++)
+                {
+                    configGenerator.AddConfigSet(configGenerator.GetBaseFolder() + "/" + pcmCase + "/" + systemCombination.name);
+                }
             }
         }
-        
+
         return true;
     }
 
-    PCM_SimulationSet *PCMSimulation::ReadSimulationSetFromDb(QString pcmCase)
+    bool PCMSimulation::ReadSimulationSetsFromDb(DatabaseReader &dbReader, const QStringList &pcmCases,
+                                                 std::map<QString, std::unique_ptr<PCM_SimulationSet>> &simulationSets)
     {
-        // Read from database
-        DatabaseReader dbReader; 
-        dbReader.SetDatabase(this->pcmDBPath);
-        PCM_SimulationSet *simulationSet = dbReader.Read(pcmCase);
-
-        if (simulationSet == nullptr)
+        if (!dbReader.ReadBatch(pcmCases, simulationSets))
         {
-            LOG_ERROR("Failed to read database for case: " + pcmCase);
-            return nullptr;
+            LOG_ERROR("Failed to read database for cases: " + pcmCases.join(", "));
+            return false;
         }
 
         // Relocate trajectory because pcm cog is in the geometric middle of the car
         // but simulated cog is between the rear axle
-        RelocateCog(simulationSet);
+        for (auto &[pcmCase, simulationSet] : simulationSets)
+        {
+            RelocateCog(simulationSet.get());
+        }
 
-        return simulationSet;
+        return true;
     }
 
     void PCMSimulation::RelocateCog(PCM_SimulationSet *simulationSet)
@@ -435,5 +618,8 @@ namespace OPGUIPCMSimulation
     void PCMSimulation::setAgentsOther(const QStringList &agentsOther){
         this->agentsOther = agentsOther;
     };
+    void PCMSimulation::setConfigWriterCount(int configWriterCount){
+        this->configWriterCount = configWriterCount;
+    };
 
 }    
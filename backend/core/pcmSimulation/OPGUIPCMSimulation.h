@@ -16,6 +16,9 @@
 
 
 
+#include <map>
+#include <memory>
+
 #include <QString>
 #include <QStringList>
 
@@ -45,12 +48,15 @@ class PCMSimulation
         void setAgentsCar1(const QStringList &agentsCar1 );
         void setAgentsCar2(const QStringList &agentsCar2  );
         void setAgentsOther(const QStringList &agentsOther);
+        void setConfigWriterCount(int configWriterCount);
   
     private:
         int variationCount = VARIATION_COUNT_DEFAULT;
         int initRandomSeed = INIT_RANDOM_SEED;
+        int configWriterCount = 0; // number of parallel config writers, one per hardware thread if not positive
         bool CreateConfigs(ConfigGenerator &configGenerator, QStringList &pcmCaseIndexList, QStringList &otherSytemList, QStringList &car1SystemList, QStringList &car2SystemList);
-        PCM_SimulationSet* ReadSimulationSetFromDb(QString pcmCase);
+        bool ReadSimulationSetsFromDb(DatabaseReader &dbReader, const QStringList &pcmCases,
+                                      std::map<QString, std::unique_ptr<PCM_SimulationSet>> &simulationSets);
         void RelocateCog(PCM_SimulationSet *simulationSet);
 
         QString pcmDBPath;
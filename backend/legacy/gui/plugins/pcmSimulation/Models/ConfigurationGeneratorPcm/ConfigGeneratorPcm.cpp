@@ -38,6 +38,26 @@ bool ConfigGenerator::GenerateConfigs(const QString &pcmCase,
                                       const QString &car2SystemFile,
                                       const int randomSeed,
                                       const PCM_SimulationSet *simulationSet)
+{
+    if (!WriteConfigs(pcmCase, caseOutputFolderName,
+                      otherSystemFile, car1SystemFile, car2SystemFile,
+                      randomSeed, simulationSet))
+    {
+        return false;
+    }
+
+    AddConfigSet(baseFolder + "/" + caseOutputFolderName);
+
+    return true;
+}
+
+bool ConfigGenerator::WriteConfigs(const QString &pcmCase,
+                                   const QString &caseOutputFolderName,
+                                   const QString &otherSystemFile,
+                                   const QString &car1SystemFile,
+                                   const QString &car2SystemFile,
+                                   const int randomSeed,
+                                   const PCM_SimulationSet *simulationSet)
 {
     if (pcmCase == "")
     {
@@ -130,11 +150,14 @@ bool ConfigGenerator::GenerateConfigs(const QString &pcmCase,
 
 	
 
-    AddConfigSet(caseOutputFolder);
-
     return true;
 }
 
+const QString &ConfigGenerator::GetBaseFolder() const
+{
+    return baseFolder;
+}
+
 const QString ConfigGenerator::GenerateFrameworkConfig(const int logLevel)
 {   
     /* use if want to place opSimulationManager outside result folder. */
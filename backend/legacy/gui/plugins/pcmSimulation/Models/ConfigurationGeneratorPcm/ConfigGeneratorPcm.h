@@ -72,6 +72,28 @@ public:
                          const int randomSeed,
                          const PCM_SimulationSet *simulationSet);
 
+    //-----------------------------------------------------------------------------
+    //! Write the configuration files of a case without adding them to the list of
+    //! generated configs (see GenerateConfigs for the parameters).
+    //!
+    //! Generators with the same base folder may write configs of different cases
+    //! concurrently.
+    //!
+    //! @return     true if writing of configs was successful
+    //-----------------------------------------------------------------------------
+    bool WriteConfigs(const QString &pcmCase,
+                      const QString &caseOutputFolderName,
+                      const QString &otherSystemFile,
+                      const QString &car1SystemFile,
+                      const QString &car2SystemFile,
+                      const int randomSeed,
+                      const PCM_SimulationSet *simulationSet);
+
+    //-----------------------------------------------------------------------------
+    //! Get the base folder where all configs are generated in.
+    //-----------------------------------------------------------------------------
+    const QString &GetBaseFolder() const;
+
     //-----------------------------------------------------------------------------
     //! Generate the framework configuration file.
     //!
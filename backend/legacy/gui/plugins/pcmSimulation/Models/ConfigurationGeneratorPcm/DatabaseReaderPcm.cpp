@@ -10,6 +10,64 @@
 
 #include "DatabaseReaderPcm.h"
 
+#include <algorithm>
+
+namespace {
+
+//! Sample of a trajectory as read from the dynamics table
+struct TrajectorySample
+{
+    double time;
+    double x;
+    double y;
+    double vx;
+    double vy;
+    double psi;
+};
+
+//! Data of one case collected while scanning the tables
+struct CaseData
+{
+    std::vector<QSqlRecord> participantRows;
+    std::vector<PCM_InitialValues *> initials;
+    std::map<qlonglong, double> mue;                                //!< first MUE of each participant
+    std::map<qlonglong, double> xMax;                               //!< maximal shape x of each participant
+    std::vector<QString> trajectoryPartIds;                          //!< participants with a trajectory, in order of the trajectories
+    std::map<QString, std::vector<TrajectorySample>> trajectories;   //!< samples of each participant
+};
+
+//! Prepares and executes a statement with an IN clause (marked by %1) over the given cases
+bool ExecForCases(QSqlQuery &query, const QString &statement, const std::vector<qlonglong> &caseIds)
+{
+    QStringList placeholders;
+    for (size_t i = 0; i < caseIds.size(); ++i)
+    {
+        placeholders.append("?");
+    }
+
+    query.setForwardOnly(true);
+    if (!query.prepare(statement.arg(placeholders.join(","))))
+    {
+        std::cout << "Error (DatabaseReader): " << query.lastError().text().toStdString() << std::endl;
+        return false;
+    }
+
+    for (const qlonglong caseId : caseIds)
+    {
+        query.addBindValue(caseId);
+    }
+
+    if (!query.exec())
+    {
+        std::cout << "Error (DatabaseReader): " << query.lastError().text().toStdString() << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
 DatabaseReader::DatabaseReader()
 {
 }
@@ -216,6 +274,169 @@ PCM_SimulationSet *DatabaseReader::Read(const QString &pcmCase)
                                  pcmData);
 }
 
+bool DatabaseReader::ReadBatch(const QStringList &pcmCases,
+                               std::map<QString, std::unique_ptr<PCM_SimulationSet>> &simulationSets)
+{
+    if (!IsDataBaseOpen())
+    {
+        return false;
+    }
+
+    std::vector<qlonglong> caseIds;
+    std::map<qlonglong, CaseData> cases;
+    for (const QString &pcmCase : pcmCases)
+    {
+        const qlonglong caseId = pcmCase.toLongLong();
+        if (cases.emplace(caseId, CaseData()).second)
+        {
+            caseIds.push_back(caseId);
+        }
+    }
+
+    if (caseIds.empty())
+    {
+        return true;
+    }
+
+    QSqlQuery query(db);
+
+    //JEM PCM 5.0
+    if (!ExecForCases(query, "SELECT CASEID,PARTID,MAX(X) FROM participant_shape WHERE CASEID IN (%1) GROUP BY CASEID,PARTID", caseIds))
+    {
+        return false;
+    }
+    while (query.next())
+    {
+        // the shape starts at x = 0 at the latest
+        cases[query.value(0).toLongLong()].xMax[query.value(1).toLongLong()] = std::max(0.0, query.value(2).toDouble());
+    }
+
+    // one scan in storage order, which keeps the order of the initial values and the first MUE of the per case queries
+    if (!ExecForCases(query, "SELECT CASEID,PARTID,TIME,POSX,POSY,VX,VY,AX,AY,POSPSI,MUE FROM dynamics WHERE CASEID IN (%1) ORDER BY CASEID,rowid", caseIds))
+    {
+        return false;
+    }
+    while (query.next())
+    {
+        CaseData &caseData = cases[query.value(0).toLongLong()];
+        const qlonglong partId = query.value(1).toLongLong();
+        const double time = query.value(2).toDouble();
+
+        if (time == 0.0)
+        {
+            caseData.initials.push_back(new PCM_InitialValues(query.value(3).toString(),
+                                                              query.value(4).toString(),
+                                                              query.value(5).toString(),
+                                                              query.value(6).toString(),
+                                                              query.value(7).toString(),
+                                                              query.value(8).toString(),
+                                                              query.value(9).toString()));
+        }
+
+        caseData.mue.emplace(partId, query.value(10).toDouble());
+        caseData.trajectories[query.value(1).toString()].push_back({time,
+                                                 query.value(3).toDouble(),
+                                                 query.value(4).toDouble(),
+                                                 query.value(5).toDouble(),
+                                                 query.value(6).toDouble(),
+                                                 query.value(9).toDouble()});
+    }
+
+    // the trajectories are ordered by participant like in ReadTrajectoryData (GROUP BY PARTID), so the
+    // order follows the type of the PARTID column (e.g. "10" before "2" for text) and not the numeric id
+    if (!ExecForCases(query, "SELECT CASEID,PARTID FROM dynamics WHERE CASEID IN (%1) GROUP BY CASEID,PARTID ORDER BY CASEID,PARTID", caseIds))
+    {
+        return false;
+    }
+    while (query.next())
+    {
+        cases[query.value(0).toLongLong()].trajectoryPartIds.push_back(query.value(1).toString());
+    }
+
+    if (!ExecForCases(query, "SELECT CASEID,PARTTYPE,WIDTH,LENGTH,FRONTAXLEX,WEIGHT,COGZ,WHEELBASE,IXX,IYY,IZZ,TRACKWIDTH,HEIGHT,PARTID FROM participant_data WHERE CASEID IN (%1) ORDER BY CASEID,rowid", caseIds))
+    {
+        return false;
+    }
+    while (query.next())
+    {
+        cases[query.value(0).toLongLong()].participantRows.push_back(query.record());
+    }
+
+    query.clear();
+
+    for (auto &[caseId, caseData] : cases)
+    {
+        std::vector<PCM_ParticipantData *> participants;
+        for (const QSqlRecord &row : caseData.participantRows)
+        {
+            const qlonglong partId = row.value(13).toLongLong();
+            const auto mue = caseData.mue.find(partId);
+            const auto xMax = caseData.xMax.find(partId);
+
+            participants.push_back(new PCM_ParticipantData(row.value(1).toString(),
+                                                           row.value(2).toString(),
+                                                           row.value(3).toString(),
+                                                           row.value(4).toString(),
+                                                           row.value(5).toString(),
+                                                           row.value(6).toString(),
+                                                           row.value(7).toString(),
+                                                           row.value(8).toString(),
+                                                           row.value(9).toString(),
+                                                           row.value(10).toString(),
+                                                           QString::number(mue != caseData.mue.end() ? mue->second : 0.9),
+                                                           row.value(11).toString(),
+                                                           row.value(12).toString(),
+                                                           QString::number(xMax != caseData.xMax.end() ? xMax->second : 0.0)));
+        }
+
+        std::vector<PCM_Trajectory *> trajectories;
+        for (const QString &partId : caseData.trajectoryPartIds)
+        {
+            std::vector<TrajectorySample> &samples = caseData.trajectories[partId];
+            std::stable_sort(samples.begin(), samples.end(), [](const TrajectorySample &lhs, const TrajectorySample &rhs) {
+                return lhs.time < rhs.time;
+            });
+
+            std::vector<double> *timeVec = new std::vector<double>();
+            std::vector<double> *xPosVec = new std::vector<double>();
+            std::vector<double> *yPosVec = new std::vector<double>();
+            std::vector<double> *uVelVec = new std::vector<double>();
+            std::vector<double> *vVelVec = new std::vector<double>();
+            std::vector<double> *psiVec = new std::vector<double>();
+
+            for (const TrajectorySample &sample : samples)
+            {
+                timeVec->push_back(sample.time);
+                xPosVec->push_back(sample.x);
+                yPosVec->push_back(sample.y);
+                uVelVec->push_back(sample.vx);
+                vVelVec->push_back(sample.vy);
+                psiVec->push_back(sample.psi);
+            }
+
+            trajectories.push_back(new PCM_Trajectory(timeVec,
+                                                      xPosVec,
+                                                      yPosVec,
+                                                      uVelVec,
+                                                      vVelVec,
+                                                      psiVec));
+        }
+
+        auto simulationSet = std::make_unique<PCM_SimulationSet>(participants,
+                                                                 caseData.initials,
+                                                                 trajectories,
+                                                                 new PCM_Data());
+
+        // cases without participants, initial values or trajectories are incomplete (see Read)
+        if (!participants.empty() && !caseData.initials.empty() && !trajectories.empty())
+        {
+            simulationSets.emplace(QString::number(caseId), std::move(simulationSet));
+        }
+    }
+
+    return true;
+}
+
 bool DatabaseReader::ReadParticipantData(const QString &pcmCase,
                                          std::vector<PCM_ParticipantData *> &participants)
 {
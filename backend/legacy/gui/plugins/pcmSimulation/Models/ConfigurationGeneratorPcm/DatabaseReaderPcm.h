@@ -12,6 +12,7 @@
 #define DATABASEREADER_H
 
 #include <iostream>
+#include <map>
 #include <memory>
 
 #include <QStringList>
@@ -37,6 +38,19 @@ public:
 
     PCM_SimulationSet *Read(const QString &pcmCase);
 
+    //! Reads the simulation sets of a batch of cases from the open database.
+    //! In contrast to Read, all cases are read by one scan per table using prepared
+    //! statements, instead of several queries per case and participant. The simulation
+    //! sets equal the ones of Read, including the order of participants, initial values
+    //! and trajectories (ordered by PARTID as stored in the database).
+    //!
+    //! @param[in]  pcmCases        cases to read
+    //! @param[out] simulationSets  simulation sets of all cases which could be read completely
+    //!
+    //! @return     false if the database is not open or a query failed
+    bool ReadBatch(const QStringList &pcmCases,
+                   std::map<QString, std::unique_ptr<PCM_SimulationSet>> &simulationSets);
+
     bool ReadParticipantData(const QString &pcmCase,
                              std::vector<PCM_ParticipantData *> &participants);
     bool ReadDynamicsData(const QString &pcmCase,
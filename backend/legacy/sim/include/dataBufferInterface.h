@@ -14,6 +14,8 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -116,7 +118,6 @@ struct CyclicRow
     CyclicRow(openpass::type::EntityId id, Key k, Value v) :
         entityId{id},
         key{k},
-        tokens{CommonHelper::TokenizeString(key, SEPARATOR)},
         value{v}
     {
     }
@@ -130,7 +131,6 @@ struct CyclicRow
 
     openpass::type::EntityId entityId;       //!< Id of the entity (agent or object)
     Key key;                                 //!< Key (topic) associated with the data
-    Tokens tokens;                           //!< Tokenized representation of key
     Value value;                             //!< Data value
 };
 
@@ -138,6 +138,80 @@ using Keys = std::vector<Key>;               //!< List of keys
 using Values = std::vector<Value>;           //!< List of values
 using CyclicRows = std::vector<CyclicRow>;   //!< List of data rows
 
+/*!
+ * \brief Selection of cyclic keys, which is compiled once and evaluated by the databuffer
+ *
+ * In contrast to query keys, selected keys are compared as a whole (without hierarchy).
+ * A selected key may contain a single WILDCARD at any position (e.g. "Sensor*_DetectedAgents"),
+ * matching all keys with the same prefix and suffix.
+ *
+ * \code{.cpp}
+ *   KeySelection selection;
+ *   selection.Add("VelocityEgo");
+ *   selection.Add("Sensor*_DetectedAgents");
+ *
+ *   const auto cyclicResult = dataBuffer->GetCyclics(std::nullopt, selection);
+ * \endcode
+ */
+class KeySelection
+{
+public:
+    //! Adds a key (or a key pattern containing a single wildcard) to the selection
+    void Add(const Key &key)
+    {
+        const auto wildcard = key.find(WILDCARD);
+
+        if (wildcard == Key::npos)
+        {
+            keys.insert(key);
+        }
+        else
+        {
+            patterns.emplace_back(key.substr(0, wildcard), key.substr(wildcard + 1));
+        }
+
+        signature.append(key).push_back('\n');
+    }
+
+    //! Returns true, if the key is selected
+    bool Matches(const Key &key) const
+    {
+        if (keys.count(key) > 0)
+        {
+            return true;
+        }
+
+        for (const auto &[prefix, suffix] : patterns)
+        {
+            if (key.size() >= prefix.size() && key.size() >= suffix.size() &&
+                key.compare(0, prefix.size(), prefix) == 0 &&
+                key.compare(key.size() - suffix.size(), suffix.size(), suffix) == 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //! Returns true, if no key is selected
+    bool empty() const
+    {
+        return signature.empty();
+    }
+
+    //! Returns a string identifying the selection (all added keys), e.g. for caching the matched keys
+    const std::string &GetSignature() const
+    {
+        return signature;
+    }
+
+private:
+    std::unordered_set<Key> keys;                     //!< Keys without wildcard
+    std::vector<std::pair<Key, Key>> patterns;        //!< Prefix and suffix of keys with wildcard
+    std::string signature;
+};
+
 using CyclicRowRefs = std::vector<std::reference_wrapper<const CyclicRow>>;     //!< List of references to rows
 using AcyclicRowRefs = std::vector<std::reference_wrapper<const AcyclicRow>>;   //!< List of references to acyclic rows
 
@@ -222,6 +296,16 @@ public:
      */
     virtual std::unique_ptr<CyclicResultInterface> GetCyclic(const std::optional<openpass::type::EntityId> entityId, const Key &key) const = 0;
 
+    /*!
+     * \brief Retrieves stored cyclic values of all selected keys
+     *
+     * Rows are returned in order of insertion.
+     *
+     * \param[in]   entityId    Entity's id (all entities, if not set)
+     * \param[in]   selection   Selected keys
+     */
+    virtual std::unique_ptr<CyclicResultInterface> GetCyclics(const std::optional<openpass::type::EntityId> entityId, const KeySelection &selection) const = 0;
+
     /*!
      * \brief Retrieves stored acyclic values
      *
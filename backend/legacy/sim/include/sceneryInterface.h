@@ -19,6 +19,7 @@
 #define SCENERYINTERFACE
 
 #include <map>
+#include <string>
 #include "include/roadInterface/roadInterface.h"
 #include "include/roadInterface/junctionInterface.h"
 
@@ -87,6 +88,20 @@ public:
     //! @return                         junction with the provided ID
     //-----------------------------------------------------------------------------
     virtual const JunctionInterface *GetJunction(const std::string& id) const = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Returns the hash of the content of the file the scenery was imported from.
+    //!
+    //! @return                         hex encoded hash (empty, if unknown)
+    //-----------------------------------------------------------------------------
+    virtual std::string GetContentHash() const = 0;
+
+    //-----------------------------------------------------------------------------
+    //! Returns the directory, in which the converted road geometry of the scenery is cached.
+    //!
+    //! @return                         directory (empty, if the geometry is not cached)
+    //-----------------------------------------------------------------------------
+    virtual std::string GetGeometryCacheDirectory() const = 0;
 };
 
 #endif // SCENERYINTERFACE
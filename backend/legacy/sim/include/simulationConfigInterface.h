@@ -37,6 +37,9 @@ struct ExperimentConfig
     int numberOfInvocations;
     std::uint32_t randomSeed;
     Libraries libraries;
+    int numberOfThreads {1};    //!< Number of threads executing the agent tasks of a run
+    int numberOfConcurrentInvocations {1};    //!< Number of invocations executed concurrently, each with its own framework modules (sharing the scenery and its road geometry)
+    std::string geometryCacheDirectory {};    //!< Directory of the scenery geometry cache (empty: the cache is disabled)
 };
 
 struct ScenarioConfig
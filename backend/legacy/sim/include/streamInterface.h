@@ -132,3 +132,20 @@ public:
     //! Returns the length of the stream
     virtual double GetLength() const = 0;
 };
+
+//! Caches the streams, which the world creates along a road graph for the RoadGraph based queries
+//! (see WorldInterface::CreateRouteStreamCache)
+class RouteStreamCacheInterface
+{
+public:
+    RouteStreamCacheInterface() = default;
+    RouteStreamCacheInterface(const RouteStreamCacheInterface &) = delete;
+    RouteStreamCacheInterface(RouteStreamCacheInterface &&) = delete;
+    RouteStreamCacheInterface &operator=(const RouteStreamCacheInterface &) = delete;
+    RouteStreamCacheInterface &operator=(RouteStreamCacheInterface &&) = delete;
+    virtual ~RouteStreamCacheInterface() = default;
+
+    //! Discards all cached streams
+    //! Has to be called, whenever the road graph of the cache changes
+    virtual void Clear() = 0;
+};
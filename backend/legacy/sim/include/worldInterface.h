@@ -700,6 +700,16 @@ public:
     //! \return RoadStream along route
     virtual std::unique_ptr<RoadStreamInterface> GetRoadStream(const std::vector<RouteElement>& route) const = 0;
 
+    //! Creates a cache for the streams along the given road graph
+    //!
+    //! As long as the cache exists, the RoadGraph based queries on this road graph (identified by its address)
+    //! reuse the streams of previous queries instead of creating them again.
+    //! The owner of the cache has to clear it, whenever the road graph changes.
+    //!
+    //! \param roadGraph    road graph, which has to outlive the cache
+    //! \return cache for the streams along roadGraph (nullptr, if not supported by the world)
+    virtual std::shared_ptr<RouteStreamCacheInterface> CreateRouteStreamCache(const RoadGraph& roadGraph) const = 0;
+
     //-----------------------------------------------------------------------------
     //! Retrieves the friction
     //!
@@ -50,6 +50,9 @@ struct fmu_check_data_t {
     char unzipPathBuf[10000];
     const char* unzipPath;
 
+    /** Set if the FMU is already extracted to tmpPath (the FMU file is not unzipped again) */
+    int skipUnzip;
+
 	/** Directory to be used for temporary files. Either user specified or system-wide*/
 	const char* temp_dir;
 
@@ -560,7 +560,8 @@ jm_status_enu_t fmuChecker( fmu_check_data_t  *cdata)
     cdata->context = fmi_import_allocate_context(callbacks);
     fmi_import_set_configuration(cdata->context, FMI_IMPORT_NAME_CHECK);
 
-    cdata->version = fmi_import_get_fmi_version(cdata->context, cdata->FMUPath, cdata->tmpPath);
+    /* FMIL only reads the model description, if no FMU file is given */
+    cdata->version = fmi_import_get_fmi_version(cdata->context, cdata->skipUnzip ? NULL : cdata->FMUPath, cdata->tmpPath);
     if(cdata->version == fmi_version_unknown_enu) {
         jm_log_fatal(callbacks,fmu_checker_module,"Error in FMU version detection");
         do_exit(1);
@@ -13,6 +13,8 @@
 #include <string>
 #include <sstream>
 #include <cstdint>
+#include <type_traits>
+#include <variant>
 #include "include/agentInterface.h"
 #include "include/egoAgentInterface.h"
 #include "GenericFmuHandler.h"
@@ -63,9 +65,40 @@ GenericFmuHandler::~GenericFmuHandler()
 
 void GenericFmuHandler::Init()
 {
+    PrepareInputs();
     SetFmuParameters();
 }
 
+void GenericFmuHandler::PrepareInputs()
+{
+    static_assert(std::is_same_v<fmi1_value_reference_t, fmi2_value_reference_t>, "FMI value references are expected to have the same type");
+    static_assert(std::is_same_v<fmi1_real_t, fmi2_real_t>, "FMI reals are expected to have the same type");
+    static_assert(std::is_same_v<fmi1_integer_t, fmi2_integer_t>, "FMI integers are expected to have the same type");
+
+    const auto getValueReferences = [](const FmuInputs& inputs)
+    {
+        return std::visit([](const auto& typedInputs)
+        {
+            std::vector<fmi2_value_reference_t> valueReferences;
+            valueReferences.reserve(typedInputs.size());
+            for (const auto& fmuInput : typedInputs)
+            {
+                valueReferences.push_back(fmuInput.valueReference);
+            }
+            return valueReferences;
+        }, inputs);
+    };
+
+    realInputValueReferences = getValueReferences(fmuRealInputs);
+    integerInputValueReferences = getValueReferences(fmuIntegerInputs);
+    booleanInputValueReferences = getValueReferences(fmuBooleanInputs);
+
+    realInputValues.assign(realInputValueReferences.size(), 0.0);
+    integerInputValues.assign(integerInputValueReferences.size(), 0);
+    fmi1BooleanInputValues.assign(fmiVersion == fmi_version_enu_t::fmi_version_1_enu ? booleanInputValueReferences.size() : 0, false);
+    fmi2BooleanInputValues.assign(fmiVersion == fmi_version_enu_t::fmi_version_2_0_enu ? booleanInputValueReferences.size() : 0, false);
+}
+
 void GenericFmuHandler::UpdateInput(int localLinkId,
                                     const std::shared_ptr<SignalInterface const> &data,
                                     [[maybe_unused]] int time)
@@ -212,12 +245,10 @@ void GenericFmuHandler::PreStep([[maybe_unused]]int time)
 
     if (fmiVersion == fmi_version_enu_t::fmi_version_1_enu)
     {
-        fmi1_value_reference_t realvrs[150];
-        fmi1_real_t realData[150];
+        fmi1_real_t* realData = realInputValues.data();
         size_t i = 0;
         for (const auto& fmuInput : std::get<FMI1>(fmuRealInputs))
         {
-            realvrs[i] = fmuInput.valueReference;
             switch (fmuInput.type)
             {
                 case FmuInputType::VelocityEgo:
@@ -342,12 +373,10 @@ void GenericFmuHandler::PreStep([[maybe_unused]]int time)
             }
             ++i;
         }
-        fmi1_value_reference_t integervrs[40];
-        fmi1_integer_t integerData[40];
+        fmi1_integer_t* integerData = integerInputValues.data();
         i = 0;
         for (const auto& fmuInput : std::get<FMI1>(fmuIntegerInputs))
         {
-            integervrs[i] = fmuInput.valueReference;
             switch (fmuInput.type)
             {
                 case FmuInputType::LaneEgo:
@@ -380,12 +409,10 @@ void GenericFmuHandler::PreStep([[maybe_unused]]int time)
             ++i;
         }
 
-        fmi1_value_reference_t booleanvrs[2];
-        fmi1_boolean_t booleanData[2];
+        fmi1_boolean_t* booleanData = fmi1BooleanInputValues.data();
         i = 0;
         for (const auto& fmuInput : std::get<FMI1>(fmuBooleanInputs))
         {
-            booleanvrs[i] = fmuInput.valueReference;
             switch (fmuInput.type)
             {
                 case FmuInputType::ExistenceFront:
@@ -400,19 +427,17 @@ void GenericFmuHandler::PreStep([[maybe_unused]]int time)
             ++i;
         }
 
-        SetRealFMI1(realvrs, realData, std::get<FMI1>(fmuRealInputs).size());
-        SetIntegerFMI1(integervrs, integerData, std::get<FMI1>(fmuIntegerInputs).size());
-        SetBooleanFMI1(booleanvrs, booleanData, std::get<FMI1>(fmuBooleanInputs).size());
+        SetRealFMI1(realInputValueReferences.data(), realData, realInputValues.size());
+        SetIntegerFMI1(integerInputValueReferences.data(), integerData, integerInputValues.size());
+        SetBooleanFMI1(booleanInputValueReferences.data(), booleanData, fmi1BooleanInputValues.size());
     }
 
     else if (fmiVersion == fmi_version_enu_t::fmi_version_2_0_enu)
     {
-        fmi2_value_reference_t realvrs[150];
-        fmi2_real_t realData[150];
+        fmi2_real_t* realData = realInputValues.data();
         size_t i = 0;
         for (const auto& fmuInput : std::get<FMI2>(fmuRealInputs))
         {
-            realvrs[i] = fmuInput.valueReference;
             switch (fmuInput.type)
             {
                 case FmuInputType::VelocityEgo:
@@ -537,12 +562,10 @@ void GenericFmuHandler::PreStep([[maybe_unused]]int time)
             }
             ++i;
         }
-        fmi2_value_reference_t integervrs[40];
-        fmi2_integer_t integerData[40];
+        fmi2_integer_t* integerData = integerInputValues.data();
         i = 0;
         for (const auto& fmuInput : std::get<FMI2>(fmuIntegerInputs))
         {
-            integervrs[i] = fmuInput.valueReference;
             switch (fmuInput.type)
             {
                 case FmuInputType::LaneEgo:
@@ -575,12 +598,10 @@ void GenericFmuHandler::PreStep([[maybe_unused]]int time)
             ++i;
         }
 
-        fmi2_value_reference_t booleanvrs[2];
-        fmi2_boolean_t booleanData[2];
+        fmi2_boolean_t* booleanData = fmi2BooleanInputValues.data();
         i = 0;
         for (const auto& fmuInput : std::get<FMI2>(fmuBooleanInputs))
         {
-            booleanvrs[i] = fmuInput.valueReference;
             switch (fmuInput.type)
             {
                 case FmuInputType::ExistenceFront:
@@ -595,9 +616,9 @@ void GenericFmuHandler::PreStep([[maybe_unused]]int time)
             ++i;
         }
 
-        SetRealFMI2(realvrs, realData, std::get<FMI2>(fmuRealInputs).size());
-        SetIntegerFMI2(integervrs, integerData, std::get<FMI2>(fmuIntegerInputs).size());
-        SetBooleanFMI2(booleanvrs, booleanData, std::get<FMI2>(fmuBooleanInputs).size());
+        SetRealFMI2(realInputValueReferences.data(), realData, realInputValues.size());
+        SetIntegerFMI2(integerInputValueReferences.data(), integerData, integerInputValues.size());
+        SetBooleanFMI2(booleanInputValueReferences.data(), booleanData, fmi2BooleanInputValues.size());
     }
 
     LOG(CbkLogLevel::Debug, "End of PreStep");
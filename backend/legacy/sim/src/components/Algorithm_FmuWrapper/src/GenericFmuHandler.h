@@ -19,6 +19,7 @@
 #include <memory>
 #include <unordered_map>
 #include <set>
+#include <vector>
 
 #include "include/signalInterface.h"
 
@@ -69,6 +70,8 @@ public:
     void SetFmuParameters();
 
 private:
+    //! Collects the value references of the inputs by FMI type, so that each type is set by a single FMI call in PreStep
+    void PrepareInputs();
 
     template <size_t I>
     void UpdateOutput(int localLinkId, std::shared_ptr<SignalInterface const> &data, int time);
@@ -127,6 +130,14 @@ private:
     FmuInputs fmuIntegerInputs;
     FmuInputs fmuBooleanInputs;
     FmuInputs fmuStringInputs;
+
+    std::vector<fmi2_value_reference_t> realInputValueReferences;       //!< Value references of fmuRealInputs (FMI 1.0 uses the same type)
+    std::vector<fmi2_value_reference_t> integerInputValueReferences;    //!< Value references of fmuIntegerInputs
+    std::vector<fmi2_value_reference_t> booleanInputValueReferences;    //!< Value references of fmuBooleanInputs
+    std::vector<fmi2_real_t> realInputValues;                           //!< Buffer for the values of fmuRealInputs
+    std::vector<fmi2_integer_t> integerInputValues;                     //!< Buffer for the values of fmuIntegerInputs
+    std::vector<fmi1_boolean_t> fmi1BooleanInputValues;                 //!< Buffer for the values of fmuBooleanInputs (FMI 1.0)
+    std::vector<fmi2_boolean_t> fmi2BooleanInputValues;                 //!< Buffer for the values of fmuBooleanInputs (FMI 2.0)
     FmuParameters<int> fmuIntegerParameters;
     FmuParameters<double> fmuDoubleParameters;
     FmuParameters<bool> fmuBoolParameters;
@@ -534,12 +534,14 @@ void OsmpFmuHandler::PreStep(int time)
     if (sensorViewVariable)
     {
         auto* worldData = static_cast<OWL::Interfaces::WorldData*>(world->GetWorldData());
-        auto sensorView = worldData->GetSensorView(sensorViewConfig, agent->GetId());
+        auto sensorView = worldData->GetDynamicSensorView(sensorViewConfig, agent->GetId());
 
         SetSensorViewInput(*sensorView);
         if (writeSensorView)
         {
-            WriteJson(*sensorView, "SensorView-" + QString::number(time) + ".json");
+            osi3::SensorView completeSensorView;
+            completeSensorView.ParseFromString(serializedSensorView);
+            WriteJson(completeSensorView, "SensorView-" + QString::number(time) + ".json");
         }
         if (writeTraceSensorView)
         {
@@ -664,6 +666,7 @@ void OsmpFmuHandler::SetSensorViewInput(const osi3::SensorView& data)
                                                  fmuVariables.at(sensorViewVariable.value()+".size").first};
 
     data.SerializeToString(&serializedSensorView);
+    static_cast<OWL::Interfaces::WorldData*>(world->GetWorldData())->AppendStaticSensorView(agent->GetId(), serializedSensorView);
     encode_pointer_to_integer(serializedSensorView.data(),
                               fmuInputValues[1],
                               fmuInputValues[0]);
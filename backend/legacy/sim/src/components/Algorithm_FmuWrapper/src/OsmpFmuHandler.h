@@ -110,6 +110,7 @@ private:
     void SetFmuParameters();
 
     //! Sets the SensorView as input for the FMU
+    //! The static content of the world (lanes and lane boundaries) is appended to the given dynamic SensorView
     void SetSensorViewInput(const osi3::SensorView &data);
 
     //! Sets the SensorData as input for the FMU
@@ -0,0 +1,128 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "fmuCache.h"
+
+#include <cstdio>
+#include <stdexcept>
+#include <system_error>
+
+#include <QCryptographicHash>
+#include <QFile>
+
+extern "C" {
+#include "FMI/fmi_zip_unzip.h"
+#include "JM/jm_callbacks.h"
+}
+
+FmuCache& FmuCache::GetInstance()
+{
+    static FmuCache instance;
+    return instance;
+}
+
+FmuCache::FmuCache() :
+    cacheRoot{std::filesystem::temp_directory_path() / std::filesystem::path(std::tmpnam(nullptr)).filename()}
+{
+}
+
+FmuCache::~FmuCache()
+{
+    std::error_code error;
+    std::filesystem::remove_all(cacheRoot, error);
+}
+
+std::string FmuCache::HashFile(const std::filesystem::path& fmuPath)
+{
+    QFile file{QString::fromStdString(fmuPath.string())};
+    QCryptographicHash hash{QCryptographicHash::Sha256};
+
+    if (!file.open(QIODevice::ReadOnly) || !hash.addData(&file))
+    {
+        throw std::runtime_error("FMU file '" + fmuPath.string() + "' cannot be read");
+    }
+
+    return hash.result().toHex().toStdString();
+}
+
+std::filesystem::path FmuCache::GetExtractedFmu(const std::filesystem::path& fmuPath)
+{
+    const FileStamp fileStamp{fmuPath.string(), std::filesystem::last_write_time(fmuPath), std::filesystem::file_size(fmuPath)};
+
+    std::lock_guard<std::mutex> lock{mutex};
+
+    if (const auto extractedFmu = extractedFmusByFile.find(fileStamp); extractedFmu != extractedFmusByFile.cend())
+    {
+        return extractedFmu->second;
+    }
+
+    const auto hash = HashFile(fmuPath);
+    auto extractedFmu = extractedFmusByHash.find(hash);
+
+    if (extractedFmu == extractedFmusByHash.cend())
+    {
+        const auto extractionPath = cacheRoot / hash;
+        std::filesystem::create_directories(extractionPath);
+
+        if (fmi_zip_unzip(fmuPath.string().c_str(), extractionPath.string().c_str(), jm_get_default_callbacks()) != jm_status_success)
+        {
+            std::error_code error;
+            std::filesystem::remove_all(extractionPath, error);
+            throw std::runtime_error("FMU file '" + fmuPath.string() + "' cannot be extracted");
+        }
+
+        extractedFmu = extractedFmusByHash.emplace(hash, extractionPath).first;
+    }
+
+    extractedFmusByFile.emplace(fileStamp, extractedFmu->second);
+    return extractedFmu->second;
+}
+
+FmuVariables FmuCache::GetVariables(const std::filesystem::path& extractedFmu, const std::function<FmuVariables()>& parseVariables)
+{
+    std::lock_guard<std::mutex> lock{mutex};
+
+    auto fmuVariables = variables.find(extractedFmu);
+    if (fmuVariables == variables.cend())
+    {
+        fmuVariables = variables.emplace(extractedFmu, parseVariables()).first;
+    }
+
+    return fmuVariables->second;
+}
+
+void FmuCache::CreateInstanceDirectory(const std::filesystem::path& extractedFmu, const std::filesystem::path& instanceDirectory)
+{
+    std::filesystem::create_directories(instanceDirectory);
+
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(extractedFmu))
+    {
+        const auto relativePath = std::filesystem::relative(entry.path(), extractedFmu);
+        const auto target = instanceDirectory / relativePath;
+
+        if (entry.is_directory())
+        {
+            std::filesystem::create_directories(target);
+            continue;
+        }
+
+        const bool isBinary = *relativePath.begin() == "binaries";
+
+        std::error_code error;
+        if (!isBinary)
+        {
+            std::filesystem::create_hard_link(entry.path(), target, error);
+        }
+        if (isBinary || error)
+        {
+            std::filesystem::copy_file(entry.path(), target, std::filesystem::copy_options::overwrite_existing);
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "include/fmuHandlerInterface.h"
+
+//!
+//! \brief Process wide cache of extracted FMUs
+//!
+//! Each FMU is extracted only once per process (and content), regardless of how many agents
+//! and runs use it. FMUs are identified by the hash of their content, so copies of an FMU
+//! at different paths share one extraction. The variable table parsed from the model description
+//! is shared between all instances of the same FMU.
+//!
+//! The extracted FMUs are removed when the process exits.
+//!
+class FmuCache
+{
+public:
+    //! Returns the cache of the process
+    static FmuCache& GetInstance();
+
+    ~FmuCache();
+
+    /*!
+     * \brief Returns the directory containing the extracted FMU
+     *
+     * The FMU is extracted on the first request.
+     *
+     * \param[in]   fmuPath     Absolute path of the FMU file
+     *
+     * \throws      std::runtime_error if the FMU cannot be read or extracted
+     */
+    std::filesystem::path GetExtractedFmu(const std::filesystem::path& fmuPath);
+
+    /*!
+     * \brief Returns the variables of an extracted FMU
+     *
+     * \param[in]   extractedFmu    Directory of the extracted FMU (see GetExtractedFmu)
+     * \param[in]   parseVariables  Retrieves the variables, called only on the first request
+     */
+    FmuVariables GetVariables(const std::filesystem::path& extractedFmu, const std::function<FmuVariables()>& parseVariables);
+
+    /*!
+     * \brief Creates a private directory of an extracted FMU for a single instance
+     *
+     * Shared libraries in the "binaries" folder are copied, as the dynamic loader would
+     * otherwise hand out the already loaded library. All other files are hard linked,
+     * if supported by the file system.
+     *
+     * \param[in]   extractedFmu        Directory of the extracted FMU (see GetExtractedFmu)
+     * \param[in]   instanceDirectory   Directory to be created
+     *
+     * \throws      std::runtime_error if the directory cannot be created
+     */
+    static void CreateInstanceDirectory(const std::filesystem::path& extractedFmu, const std::filesystem::path& instanceDirectory);
+
+private:
+    //! Identifies an FMU file without reading it (path, modification time, size)
+    using FileStamp = std::tuple<std::string, std::filesystem::file_time_type, std::uintmax_t>;
+
+    FmuCache();
+
+    //! Returns the hash of the file content
+    static std::string HashFile(const std::filesystem::path& fmuPath);
+
+    std::mutex mutex;
+    std::filesystem::path cacheRoot;                                    //!< All FMUs are extracted beneath this directory
+    std::map<FileStamp, std::filesystem::path> extractedFmusByFile;     //!< Avoids rehashing of known files
+    std::map<std::string, std::filesystem::path> extractedFmusByHash;
+    std::map<std::filesystem::path, FmuVariables> variables;
+};
@@ -0,0 +1,43 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "fmilib.h"
+#include "include/fmuHandlerInterface.h"
+
+//! FMU variables of one FMI base type, which are read by a single FMI call
+struct FmuValueReads
+{
+    std::vector<fmi2_value_reference_t> valueReferences;    //!< Value references (FMI 1.0 uses the same type)
+    std::vector<FmuHandlerInterface::FmuValue*> values;     //!< Targets of the read values in fmuVariableValues
+    std::vector<std::string> names;                         //!< Names of the variables (for logging)
+};
+
+/*!
+ * \brief Stores the values read by one FMI get call in the targets of the reads
+ *
+ * The read values are expected in the order of the value references of the reads.
+ *
+ * \param[in]   reads       Variables the values have been read for
+ * \param[in]   readValues  Values returned by the FMI get call
+ * \param[in]   target      Member of the FmuValue union to store the values in
+ */
+template <typename T, typename Value>
+void StoreReadValues(const FmuValueReads& reads, const std::vector<T>& readValues, Value FmuHandlerInterface::FmuValue::*target)
+{
+    for (size_t i = 0; i < readValues.size(); ++i)
+    {
+        reads.values[i]->*target = readValues[i];
+    }
+}
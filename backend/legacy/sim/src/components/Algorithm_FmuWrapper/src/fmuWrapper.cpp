@@ -10,6 +10,7 @@
  ********************************************************************************/
 
 #include "fmuWrapper.h"
+#include "fmuCache.h"
 #include "fmuFileHelper.h"
 
 #include <cstdint>
@@ -17,6 +18,7 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 #include <QtGlobal>
 
@@ -184,23 +186,45 @@ void AlgorithmFmuWrapperImplementation::SetupOutput()
 
 void AlgorithmFmuWrapperImplementation::SetupUnzip(const bool individualUnzip)
 {
-    std::filesystem::path unzipRoot = std::filesystem::temp_directory_path() / std::tmpnam(nullptr);
+    try
+    {
+        extractedFmuPath = FmuCache::GetInstance().GetExtractedFmu(FMU_absPath);
+    }
+    catch (const std::exception& exception)
+    {
+        LOGERRORANDTHROW(log_prefix(agentIdString, componentName) + exception.what());
+    }
 
     if (individualUnzip)
     {
         // make unzip folder unique for each agent by adding agentId to the path
-        unzipRoot = unzipRoot / agentIdString;
-    }
+        std::filesystem::path unzipRoot = std::filesystem::temp_directory_path() / std::tmpnam(nullptr) / agentIdString;
 
-    // make dir if not existing
-    MkDirOrThrowError(unzipRoot);
+        try
+        {
+            FmuCache::CreateInstanceDirectory(extractedFmuPath, unzipRoot);
+        }
+        catch (const std::exception& exception)
+        {
+            LOGERRORANDTHROW(log_prefix(agentIdString, componentName) + "could not create unzip folder: " + exception.what());
+        }
 
-    // set unzipPath to NULL to have the temporary folders removed in fmi1_end_handling
-    cdata.unzipPath = nullptr;
+        tmpPath = unzipRoot.string();
+    }
+    else
+    {
+        tmpPath = extractedFmuPath.string();
+    }
 
     // set unzip temporary path
-    tmpPath = unzipRoot.string();
     cdata.tmpPath = const_cast<char*>(tmpPath.c_str());
+
+    // set unzipPath to NULL to have the individual folder removed in fmi1_end_handling
+    // (the shared folder is removed by the cache at process exit)
+    cdata.unzipPath = individualUnzip ? nullptr : cdata.tmpPath;
+
+    // the FMU is already extracted by the cache
+    cdata.skipUnzip = 1;
 }
 
 AlgorithmFmuWrapperImplementation::~AlgorithmFmuWrapperImplementation()
@@ -314,7 +338,8 @@ void AlgorithmFmuWrapperImplementation::InitFmu()
     auto fmiStatus = fmuChecker(&cdata); //! unpack FMU
     HandleFmiStatus(fmiStatus, "fmuChecker");
 
-    fmuVariables = GetFmuVariables();
+    fmuVariables = FmuCache::GetInstance().GetVariables(extractedFmuPath, [this] { return GetFmuVariables(); });
+    PrepareOutputValueReads();
 
     if (fmuType == "OSMP")
     {
@@ -347,13 +372,13 @@ void AlgorithmFmuWrapperImplementation::InitFmu()
     {
         case fmi_version_1_enu:
             HandleFmiStatus(fmi1_cs_prep_init(&cdata), "prep init");
-            ReadOutputValues();
+            ReadOutputValues(true);
             fmuHandler->Init();
             fmiStatus = fmi1_cs_prep_simulate(&cdata);
             break;
         case fmi_version_2_0_enu:
             HandleFmiStatus(fmi2_cs_prep_init(&cdata), "prep init");
-            ReadOutputValues();
+            ReadOutputValues(true);
             fmuHandler->Init();
             fmiStatus = fmi2_cs_prep_simulate(&cdata);
             break;
@@ -462,113 +487,140 @@ VariableType AlgorithmFmuWrapperImplementation::FmiTypeToCType(const fmi2_base_t
     }
 }
 
-void AlgorithmFmuWrapperImplementation::ReadOutputValues()
+void AlgorithmFmuWrapperImplementation::PrepareOutputValueReads()
 {
+    static_assert(std::is_same_v<fmi1_value_reference_t, fmi2_value_reference_t>, "FMI value references are expected to have the same type");
+    static_assert(std::is_same_v<fmi1_integer_t, fmi2_integer_t> && std::is_same_v<fmi1_real_t, fmi2_real_t> && std::is_same_v<fmi1_string_t, fmi2_string_t>,
+                  "FMI integer, real and string values are expected to have the same type");
+
+    const auto addRead = [this](const std::string& fmuVarName, fmi2_value_reference_t valueReference, VariableType dataType, ValueReferenceAndType valRefAndType)
+    {
+        FmuValueReads* reads = nullptr;
+        switch(dataType)
+        {
+        case VariableType::Bool:
+            reads = &booleanReads;
+            break;
+        case VariableType::Int:
+        case VariableType::Enum:
+            reads = &integerReads;
+            break;
+        case VariableType::Double:
+            reads = &realReads;
+            break;
+        case VariableType::String:
+            reads = &stringReads;
+            break;
+        default:
+            LOGERRORANDTHROW(log_prefix(agentIdString, componentName) + "Invalid FMI datatype during PrepareOutputValueReads()");
+        }
+
+        reads->valueReferences.push_back(valueReference);
+        reads->values.push_back(&fmuVariableValues[valRefAndType]);
+        reads->names.push_back(fmuVarName);
+    };
+
     if (cdata.version == fmi_version_enu_t::fmi_version_1_enu)
     {
-        for (auto [fmuVarName, valRefAndType1] : std::get<FMI1>(fmuVariables))
+        for (const auto& [fmuVarName, valRefAndType1] : std::get<FMI1>(fmuVariables))
         {
-            // put value reference in array for get function
-            fmi1_value_reference_t value_ref[1];
-            VariableType dataType;
-            std::tie(value_ref[0], dataType) = valRefAndType1;
             ValueReferenceAndType valRefAndType;
             valRefAndType.emplace<FMI1>(valRefAndType1);
-
-            fmi1_boolean_t value_bool_out[1];
-            fmi1_integer_t value_int_out[1];
-            fmi1_real_t value_real_out[1];
-            fmi2_string_t value_string_out[1];
-
-            switch(dataType)
-            {
-            case VariableType::Bool:
-                value_bool_out[0] = false;
-                fmi1_import_get_boolean(cdata.fmu1, value_ref, 1, value_bool_out);
-                fmuVariableValues[valRefAndType].boolValue = value_bool_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "bool value '" + fmuVarName + "': " + std::to_string(value_bool_out[0]));
-                break;
-            case VariableType::Int:
-                value_int_out[0] = 0;
-                fmi1_import_get_integer(cdata.fmu1, value_ref, 1, value_int_out);
-                fmuVariableValues[valRefAndType].intValue = value_int_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "int value '" + fmuVarName + "': " + std::to_string(value_int_out[0]));
-                break;
-            case VariableType::Double:
-                value_real_out[0] = 0.0;
-                fmi1_import_get_real(cdata.fmu1, value_ref, 1, value_real_out);
-                fmuVariableValues[valRefAndType].realValue = value_real_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "real value '" + fmuVarName + "': " + std::to_string(value_real_out[0]));
-                break;
-            case VariableType::Enum:
-                value_int_out[0] = 0;
-                fmi1_import_get_integer(cdata.fmu1, value_ref, 1, value_int_out);
-                fmuVariableValues[valRefAndType].intValue = value_int_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "int value '" + fmuVarName + "': " + std::to_string(value_int_out[0]));
-                break;
-            case VariableType::String:
-                value_string_out[0] = nullptr;
-                fmi1_import_get_string(cdata.fmu1, value_ref, 1, value_string_out);
-                fmuVariableValues[valRefAndType].stringValue = value_string_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "string value '" + fmuVarName + "': " + std::string(value_string_out[0]));
-                break;
-            default:
-                LOGERRORANDTHROW(log_prefix(agentIdString, componentName) + "Invalid FMI datatype during ReadOutputValues()");
-            }
+            addRead(fmuVarName, valRefAndType1.first, valRefAndType1.second, valRefAndType);
         }
     }
     else if (cdata.version == fmi_version_enu_t::fmi_version_2_0_enu)
     {
-        for (auto [fmuVarName, valRefAndType2] : std::get<FMI2>(fmuVariables))
+        for (const auto& [fmuVarName, valRefAndType2] : std::get<FMI2>(fmuVariables))
         {
-            // put value reference in array for get function
-            fmi2_value_reference_t value_ref[1];
-            VariableType dataType;
-            std::tie(value_ref[0], dataType) = valRefAndType2;
             ValueReferenceAndType valRefAndType;
             valRefAndType.emplace<FMI2>(valRefAndType2);
+            addRead(fmuVarName, valRefAndType2.first, valRefAndType2.second, valRefAndType);
+        }
+    }
 
-            fmi2_boolean_t value_bool_out[1];
-            fmi2_integer_t value_int_out[1];
-            fmi2_real_t value_real_out[1];
-            fmi2_string_t value_string_out[1];
+    fmi1BooleanValues.assign(cdata.version == fmi_version_enu_t::fmi_version_1_enu ? booleanReads.valueReferences.size() : 0, false);
+    fmi2BooleanValues.assign(cdata.version == fmi_version_enu_t::fmi_version_2_0_enu ? booleanReads.valueReferences.size() : 0, false);
+    integerValues.assign(integerReads.valueReferences.size(), 0);
+    realValues.assign(realReads.valueReferences.size(), 0.0);
+    stringValues.assign(stringReads.valueReferences.size(), nullptr);
+}
 
-            switch(dataType)
-            {
-            case VariableType::Bool:
-                value_bool_out[0] = false;
-                fmi2_import_get_boolean(cdata.fmu2, value_ref, 1, value_bool_out);
-                fmuVariableValues[valRefAndType].boolValue = value_bool_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "bool value '" + fmuVarName + "': " + std::to_string(value_bool_out[0]));
-                break;
-            case VariableType::Int:
-                value_int_out[0] = 0;
-                fmi2_import_get_integer(cdata.fmu2, value_ref, 1, value_int_out);
-                fmuVariableValues[valRefAndType].intValue = value_int_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "int value '" + fmuVarName + "': " + std::to_string(value_int_out[0]));
-                break;
-            case VariableType::Double:
-                value_real_out[0] = 0.0;
-                fmi2_import_get_real(cdata.fmu2, value_ref, 1, value_real_out);
-                fmuVariableValues[valRefAndType].realValue = value_real_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "real value '" + fmuVarName + "': " + std::to_string(value_real_out[0]));
-                break;
-            case VariableType::Enum:
-                value_int_out[0] = 0;
-                fmi2_import_get_integer(cdata.fmu2, value_ref, 1, value_int_out);
-                fmuVariableValues[valRefAndType].intValue = value_int_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "int value '" + fmuVarName + "': " + std::to_string(value_int_out[0]));
-                break;
-            case VariableType::String:
-                value_string_out[0] = nullptr;
-                fmi2_import_get_string(cdata.fmu2, value_ref, 1, value_string_out);
-                fmuVariableValues[valRefAndType].stringValue = value_string_out[0];
-                LOGDEBUG(log_prefix(agentIdString, componentName) + "string value '" + fmuVarName + "': " + std::string(value_string_out[0]));
-                break;
-            default:
-                LOGERRORANDTHROW(log_prefix(agentIdString, componentName) + "Invalid FMI datatype during ReadOutputValues()");
-            }
+template <typename T, typename Value>
+void AlgorithmFmuWrapperImplementation::StoreValues(const FmuValueReads& reads, const std::vector<T>& readValues,
+                                                    Value FmuHandlerInterface::FmuValue::*target,
+                                                    const std::string& typeName, bool logValues)
+{
+    StoreReadValues(reads, readValues, target);
+
+    if (!logValues)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < readValues.size(); ++i)
+    {
+        if constexpr (std::is_same_v<Value, const char*>)
+        {
+            LOGDEBUG(log_prefix(agentIdString, componentName) + typeName + " value '" + reads.names[i] + "': " + std::string(readValues[i]));
+        }
+        else
+        {
+            LOGDEBUG(log_prefix(agentIdString, componentName) + typeName + " value '" + reads.names[i] + "': " + std::to_string(readValues[i]));
+        }
+    }
+}
+
+void AlgorithmFmuWrapperImplementation::ReadOutputValues(bool logValues)
+{
+    // fmi1 and fmi2 value references have the same type, but the boolean value types differ
+    if (cdata.version == fmi_version_enu_t::fmi_version_1_enu)
+    {
+        if (!fmi1BooleanValues.empty())
+        {
+            fmi1_import_get_boolean(cdata.fmu1, booleanReads.valueReferences.data(), fmi1BooleanValues.size(), fmi1BooleanValues.data());
+        }
+        if (!integerValues.empty())
+        {
+            fmi1_import_get_integer(cdata.fmu1, integerReads.valueReferences.data(), integerValues.size(), integerValues.data());
         }
+        if (!realValues.empty())
+        {
+            fmi1_import_get_real(cdata.fmu1, realReads.valueReferences.data(), realValues.size(), realValues.data());
+        }
+        if (!stringValues.empty())
+        {
+            fmi1_import_get_string(cdata.fmu1, stringReads.valueReferences.data(), stringValues.size(), stringValues.data());
+        }
+
+        StoreValues(booleanReads, fmi1BooleanValues, &FmuHandlerInterface::FmuValue::boolValue, "bool", logValues);
+        StoreValues(integerReads, integerValues, &FmuHandlerInterface::FmuValue::intValue, "int", logValues);
+        StoreValues(realReads, realValues, &FmuHandlerInterface::FmuValue::realValue, "real", logValues);
+        StoreValues(stringReads, stringValues, &FmuHandlerInterface::FmuValue::stringValue, "string", logValues);
+    }
+    else if (cdata.version == fmi_version_enu_t::fmi_version_2_0_enu)
+    {
+        if (!fmi2BooleanValues.empty())
+        {
+            fmi2_import_get_boolean(cdata.fmu2, booleanReads.valueReferences.data(), fmi2BooleanValues.size(), fmi2BooleanValues.data());
+        }
+        if (!integerValues.empty())
+        {
+            fmi2_import_get_integer(cdata.fmu2, integerReads.valueReferences.data(), integerValues.size(), integerValues.data());
+        }
+        if (!realValues.empty())
+        {
+            fmi2_import_get_real(cdata.fmu2, realReads.valueReferences.data(), realValues.size(), realValues.data());
+        }
+        if (!stringValues.empty())
+        {
+            fmi2_import_get_string(cdata.fmu2, stringReads.valueReferences.data(), stringValues.size(), stringValues.data());
+        }
+
+        StoreValues(booleanReads, fmi2BooleanValues, &FmuHandlerInterface::FmuValue::boolValue, "bool", logValues);
+        StoreValues(integerReads, integerValues, &FmuHandlerInterface::FmuValue::intValue, "int", logValues);
+        StoreValues(realReads, realValues, &FmuHandlerInterface::FmuValue::realValue, "real", logValues);
+        StoreValues(stringReads, stringValues, &FmuHandlerInterface::FmuValue::stringValue, "string", logValues);
     }
 }
 
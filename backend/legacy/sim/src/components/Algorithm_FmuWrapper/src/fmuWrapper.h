@@ -33,6 +33,7 @@ extern "C" {
 
 #include "include/fmuHandlerInterface.h"
 #include "include/fmuWrapperInterface.h"
+#include "fmuValueReads.h"
 
 
 std::string log_prefix(const std::string &agentIdString, const std::string &componentName);
@@ -79,8 +80,26 @@ public:
     void SetValue(const FmuHandlerInterface::FmuValue& fmuValue, fmi2_value_reference_t valueReference, VariableType variableType) override;
 
 private:
+    /*!
+     * \brief Groups all FMU variables by their FMI base type (see ReadOutputValues)
+     *
+     * Creates the entries of all variables in fmuVariableValues and sizes the buffers for the read values.
+     */
+    void PrepareOutputValueReads();
+
+    /*!
+     * \brief Reads the values of all FMU variables into fmuVariableValues
+     *
+     * Performs one FMI get call per base type.
+     *
+     * \param[in]   logValues   If true, each value is logged on debug level
+     */
+    void ReadOutputValues(bool logValues = false);
 
-    void ReadOutputValues();
+    //! Stores values read by one FMI get call in the targets of the reads (see StoreReadValues) and logs them
+    template <typename T, typename Value>
+    void StoreValues(const FmuValueReads& reads, const std::vector<T>& readValues, Value FmuHandlerInterface::FmuValue::*target,
+                     const std::string& typeName, bool logValues);
 
     /*!
      * \brief Constructs an output base path from the core results directory and agent id
@@ -109,19 +128,19 @@ private:
     /*!
      * \brief Sets up FMU unzipping paths and settings.
      *
-     * Default is to have the fmu unzipped only once, but if the capability
-     * \c canBeInstantiatedOnlyOncePerProcess is set to \c true, then every agent needs an
-     * unzip folder on its own.
+     * The FMU is extracted only once per process by the FmuCache. Default is to use the shared
+     * extraction, but if the capability \c canBeInstantiatedOnlyOncePerProcess is set to \c true,
+     * then every agent needs an unzip folder (with its own copy of the binaries) on its own.
      *
-     * \param[in]   individualUnzip     If false, unzip folder of existing FMU will be reused.
+     * \param[in]   individualUnzip     If false, the shared unzip folder of the FMU will be used.
      */
     void SetupUnzip(const bool individualUnzip);
 
     /*!
      * \brief Initializes the FMU
      *
-     * Calls the FMU checker which unzips and validates the FMU and parses the configuration
-     * of the FMU. The type of the FMU is detectd and stored for later use. After that an
+     * Calls the FMU checker which validates the extracted FMU and parses the configuration
+     * of the FMU (the variables are shared between instances by the FmuCache). The type of the FMU is detectd and stored for later use. After that an
      * initializing simulation step is performed on the FMU.
      *
      * Supported types of FMU are ACC and SWW
@@ -183,6 +202,7 @@ private:
     std::string FMU_absPath;        //!< Absolute path to the FMU file including
     std::string FMU_configPath;     //!< Relative path to the FMU file (originating in core config directory)
     std::string tmpPath;            //!< Temporary path used for unzipping the FMU archive
+    std::filesystem::path extractedFmuPath; //!< Shared extraction of the FMU (see FmuCache)
     std::string outputPath;         //!< Output base directory (inside core results directory)
     std::string logFileFullName;    //!< Absolute path to the log file
     std::string logFileName;        //!< Name of the log file
@@ -197,6 +217,17 @@ private:
     //! Mapping from FMI value reference and C++ type id to FmuWrapper value (union). Provided to type-specific wrapper implementation on construction.
     std::map<ValueReferenceAndType, FmuHandlerInterface::FmuValue> fmuVariableValues;
 
+    FmuValueReads booleanReads;     //!< Bool variables
+    FmuValueReads integerReads;     //!< Int and Enum variables
+    FmuValueReads realReads;        //!< Double variables
+    FmuValueReads stringReads;      //!< String variables
+
+    std::vector<fmi1_boolean_t> fmi1BooleanValues;  //!< Buffer for the values of booleanReads (FMI 1.0)
+    std::vector<fmi2_boolean_t> fmi2BooleanValues;  //!< Buffer for the values of booleanReads (FMI 2.0)
+    std::vector<fmi2_integer_t> integerValues;      //!< Buffer for the values of integerReads (FMI 1.0 uses the same type)
+    std::vector<fmi2_real_t> realValues;            //!< Buffer for the values of realReads (FMI 1.0 uses the same type)
+    std::vector<fmi2_string_t> stringValues;        //!< Buffer for the values of stringReads (FMI 1.0 uses the same type)
+
     bool isInitialized{false};                                                              //!< Specifies, if the FMU has already be initialized
     FmuHandlerInterface* fmuHandler = nullptr;                                              //!< Points to the instance of the FMU type-specific implementation
     std::string fmuType;        //!< Type of the FMU
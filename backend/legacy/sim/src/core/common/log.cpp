@@ -10,4 +10,472 @@
 
 #include "common/log.h"
 
-std::map<int, std::unique_ptr<std::ofstream>> LogOutputPolicy::logStreamMap;
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef WIN32
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr size_t RING_BUFFER_CAPACITY = 1 << 18;         //!< capacity of the ring buffer of each thread [bytes]
+constexpr std::chrono::milliseconds WRITE_INTERVAL{10}; //!< maximal time messages stay in the ring buffers
+constexpr size_t MAX_CRASH_RING_BUFFERS = 256;           //!< number of ring buffers, which are written on a crash
+
+#ifndef WIN32
+constexpr std::array<int, 5> CRASH_SIGNALS{SIGSEGV, SIGABRT, SIGFPE, SIGILL, SIGBUS};
+
+//! Writes the given bytes using write(2) only, so it can be called from a signal handler
+void WriteAll(int fd, const char *data, size_t size)
+{
+    while (size > 0)
+    {
+        const auto written = ::write(fd, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+#endif
+
+//! Lock-free ring buffer for the messages of one thread (single producer, single consumer)
+class LogRingBuffer
+{
+public:
+    //! Appends a message, if it fits completely into the free space (producer only)
+    bool TryPush(const std::string &message)
+    {
+        const size_t head = this->head.load(std::memory_order_relaxed);
+        const size_t tail = this->tail.load(std::memory_order_acquire);
+
+        if (RING_BUFFER_CAPACITY - (head - tail) < message.size())
+        {
+            return false;
+        }
+
+        const size_t start = head % RING_BUFFER_CAPACITY;
+        const size_t firstPart = std::min(message.size(), RING_BUFFER_CAPACITY - start);
+        std::memcpy(buffer.get() + start, message.data(), firstPart);
+        std::memcpy(buffer.get(), message.data() + firstPart, message.size() - firstPart);
+
+        this->head.store(head + message.size(), std::memory_order_release);
+        return true;
+    }
+
+    //! Appends all complete messages to the given batch (consumer only)
+    //!
+    //! The messages stay queued until they are released, so they are still written on a crash
+    //! while the batch is written.
+    //! \return position up to which the messages were appended
+    size_t Drain(std::string &batch) const
+    {
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+        const size_t head = this->head.load(std::memory_order_acquire);
+
+        const size_t start = tail % RING_BUFFER_CAPACITY;
+        const size_t size = head - tail;
+        const size_t firstPart = std::min(size, RING_BUFFER_CAPACITY - start);
+        batch.append(buffer.get() + start, firstPart);
+        batch.append(buffer.get(), size - firstPart);
+
+        return head;
+    }
+
+    //! Releases the messages up to the given position returned by Drain (consumer only)
+    void Release(size_t position)
+    {
+        tail.store(position, std::memory_order_release);
+    }
+
+#ifndef WIN32
+    //! Writes all queued messages to the given file descriptor (async-signal-safe)
+    void WriteQueued(int fd) const
+    {
+        const size_t tail = this->tail.load(std::memory_order_acquire);
+        const size_t head = this->head.load(std::memory_order_acquire);
+
+        const size_t start = tail % RING_BUFFER_CAPACITY;
+        const size_t size = head - tail;
+        const size_t firstPart = std::min(size, RING_BUFFER_CAPACITY - start);
+        WriteAll(fd, buffer.get() + start, firstPart);
+        WriteAll(fd, buffer.get(), size - firstPart);
+    }
+#endif
+
+    //! Returns the number of queued bytes
+    size_t GetSize() const
+    {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    std::atomic<bool> inUse{true}; //!< false, if the owning thread has finished
+
+private:
+    std::unique_ptr<char[]> buffer{new char[RING_BUFFER_CAPACITY]};
+    alignas(64) std::atomic<size_t> head{0}; //!< total number of pushed bytes
+    alignas(64) std::atomic<size_t> tail{0}; //!< total number of drained bytes
+};
+
+//! Background writer, which drains the ring buffers of all threads into the log file
+class LogWriter
+{
+public:
+    static LogWriter &GetInstance()
+    {
+        static LogWriter instance;
+        return instance;
+    }
+
+    ~LogWriter()
+    {
+        isOpen = false;
+        Stop();
+        alive = false;
+#ifndef WIN32
+        crashInstance = nullptr;
+        CloseCrashFile();
+#endif
+    }
+
+    void Open(const std::string &fileName)
+    {
+        Stop();
+
+        {
+            std::lock_guard<std::mutex> fileLock(fileMutex);
+            file.close();
+            file.clear();
+            file.open(fileName);
+            isOpen = file.is_open();
+#ifndef WIN32
+            CloseCrashFile();
+            if (isOpen)
+            {
+                crashFile = ::open(fileName.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+            }
+#endif
+        }
+
+        if (isOpen)
+        {
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                running = true;
+            }
+            writerThread = std::thread(&LogWriter::Run, this);
+#ifndef WIN32
+            crashInstance = this;
+            std::call_once(crashHandlersInstalled, InstallCrashHandlers);
+#endif
+        }
+    }
+
+    void Output(const std::string &message)
+    {
+        if (message.size() > RING_BUFFER_CAPACITY)
+        {
+            Flush();
+            std::lock_guard<std::mutex> fileLock(fileMutex);
+            file << message;
+            file.flush();
+            return;
+        }
+
+        LogRingBuffer &ringBuffer = GetThreadRingBuffer();
+        while (!ringBuffer.TryPush(message))
+        {
+            // nobody drains the ring buffer while the writer is stopped (e.g. while the file is reopened)
+            if (!running)
+            {
+                std::lock_guard<std::mutex> fileLock(fileMutex);
+                file << message;
+                file.flush();
+                return;
+            }
+
+            wakeUp.notify_one();
+            std::this_thread::yield();
+        }
+
+        if (ringBuffer.GetSize() > RING_BUFFER_CAPACITY / 2)
+        {
+            wakeUp.notify_one();
+        }
+    }
+
+    void Flush()
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        if (!running)
+        {
+            return;
+        }
+
+        const auto request = ++flushRequested;
+        wakeUp.notify_one();
+        flushed.wait(lock, [this, request] { return flushCompleted >= request || !running; });
+    }
+
+    std::atomic<bool> isOpen{false};
+
+    //! false after the writer has been destroyed at exit
+    static inline std::atomic<bool> alive{true};
+
+private:
+    //! Ring buffer of the calling thread, which is released for reuse when the thread finishes
+    class ThreadRingBuffer
+    {
+    public:
+        ThreadRingBuffer(LogRingBuffer &ringBuffer) :
+            ringBuffer(ringBuffer)
+        {}
+
+        ~ThreadRingBuffer()
+        {
+            if (alive)
+            {
+                ringBuffer.inUse.store(false, std::memory_order_release);
+            }
+        }
+
+        LogRingBuffer &ringBuffer;
+    };
+
+    LogRingBuffer &GetThreadRingBuffer()
+    {
+        thread_local ThreadRingBuffer threadRingBuffer(AcquireRingBuffer());
+        return threadRingBuffer.ringBuffer;
+    }
+
+    LogRingBuffer &AcquireRingBuffer()
+    {
+        std::lock_guard<std::mutex> lock(ringBuffersMutex);
+
+        for (auto &ringBuffer : ringBuffers)
+        {
+            bool inUse = false;
+            if (ringBuffer->inUse.compare_exchange_strong(inUse, true, std::memory_order_acq_rel))
+            {
+                return *ringBuffer;
+            }
+        }
+
+        ringBuffers.push_back(std::make_unique<LogRingBuffer>());
+
+        // published without lock for the crash handler
+        const size_t numberOfCrashRingBuffers = this->numberOfCrashRingBuffers.load(std::memory_order_relaxed);
+        if (numberOfCrashRingBuffers < MAX_CRASH_RING_BUFFERS)
+        {
+            crashRingBuffers[numberOfCrashRingBuffers].store(ringBuffers.back().get(), std::memory_order_release);
+            this->numberOfCrashRingBuffers.store(numberOfCrashRingBuffers + 1, std::memory_order_release);
+        }
+
+        return *ringBuffers.back();
+    }
+
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+
+        while (running)
+        {
+            if (flushRequested == flushCompleted && !stopRequested)
+            {
+                wakeUp.wait_for(lock, WRITE_INTERVAL);
+            }
+
+            const auto request = flushRequested;
+            const bool stop = stopRequested;
+
+            lock.unlock();
+            {
+                std::lock_guard<std::mutex> fileLock(fileMutex);
+                WriteQueuedMessages();
+            }
+            lock.lock();
+
+            flushCompleted = request;
+            if (stop)
+            {
+                running = false;
+            }
+            flushed.notify_all();
+        }
+    }
+
+    void Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            stopRequested = true;
+        }
+        wakeUp.notify_one();
+
+        if (writerThread.joinable())
+        {
+            writerThread.join();
+        }
+
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopRequested = false;
+        running = false;
+    }
+
+    //! Writes the messages of all ring buffers in one batch (fileMutex has to be locked)
+    void WriteQueuedMessages()
+    {
+        drainedPositions.clear();
+        {
+            std::lock_guard<std::mutex> lock(ringBuffersMutex);
+            for (auto &ringBuffer : ringBuffers)
+            {
+                drainedPositions.emplace_back(ringBuffer.get(), ringBuffer->Drain(batch));
+            }
+        }
+
+        if (!batch.empty())
+        {
+            file.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+            file.flush();
+            batch.clear();
+        }
+
+        for (auto &[ringBuffer, position] : drainedPositions)
+        {
+            ringBuffer->Release(position);
+        }
+    }
+
+#ifndef WIN32
+    void CloseCrashFile()
+    {
+        const int fd = crashFile.exchange(-1);
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+    }
+
+    static void InstallCrashHandlers()
+    {
+        struct sigaction action{};
+        action.sa_handler = &LogWriter::OnCrash;
+        sigemptyset(&action.sa_mask);
+
+        for (size_t i = 0; i < CRASH_SIGNALS.size(); ++i)
+        {
+            sigaction(CRASH_SIGNALS[i], &action, &previousActions[i]);
+        }
+    }
+
+    //! Writes the queued messages of all threads and passes the signal on to the previous handler
+    //!
+    //! Only lock-free atomics and write(2) are used, as the crashed thread may hold any lock.
+    //! Messages of the batch currently written by the background writer are still queued, so
+    //! they might be written twice, but are not lost.
+    static void OnCrash(int signal)
+    {
+        static std::atomic_flag crashed = ATOMIC_FLAG_INIT;
+        if (!crashed.test_and_set())
+        {
+            const LogWriter *writer = crashInstance.load(std::memory_order_acquire);
+            const int fd = writer ? writer->crashFile.load(std::memory_order_acquire) : -1;
+            if (fd >= 0)
+            {
+                const size_t numberOfRingBuffers = writer->numberOfCrashRingBuffers.load(std::memory_order_acquire);
+                for (size_t i = 0; i < numberOfRingBuffers; ++i)
+                {
+                    writer->crashRingBuffers[i].load(std::memory_order_acquire)->WriteQueued(fd);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < CRASH_SIGNALS.size(); ++i)
+        {
+            if (CRASH_SIGNALS[i] == signal)
+            {
+                sigaction(signal, &previousActions[i], nullptr);
+            }
+        }
+
+        // delivered to the previous handler as soon as this handler returns
+        raise(signal);
+    }
+
+    std::atomic<int> crashFile{-1};      //!< descriptor of the log file used on a crash
+
+    static inline std::atomic<const LogWriter *> crashInstance{nullptr};
+    static inline std::once_flag crashHandlersInstalled;
+    static inline std::array<struct sigaction, CRASH_SIGNALS.size()> previousActions{};
+#endif
+
+    std::ofstream file;
+    std::string batch;       //!< messages written at once (reused)
+    std::mutex fileMutex;    //!< protects file, batch and the ring buffers from concurrent draining
+
+    std::vector<std::unique_ptr<LogRingBuffer>> ringBuffers;
+    std::mutex ringBuffersMutex;
+    std::vector<std::pair<LogRingBuffer *, size_t>> drainedPositions;   //!< positions of the current batch (reused)
+
+    //! ring buffers readable without lock (the first MAX_CRASH_RING_BUFFERS ones)
+    std::array<std::atomic<LogRingBuffer *>, MAX_CRASH_RING_BUFFERS> crashRingBuffers{};
+    std::atomic<size_t> numberOfCrashRingBuffers{0};
+
+    std::thread writerThread;
+    std::mutex stateMutex;
+    std::condition_variable wakeUp;
+    std::condition_variable flushed;
+    std::atomic<bool> running{false};
+    bool stopRequested = false;
+    unsigned long long flushRequested = 0;
+    unsigned long long flushCompleted = 0;
+};
+
+} // namespace
+
+void LogOutputPolicy::SetFile(const std::string &fileName)
+{
+    LogWriter::GetInstance().Open(fileName);
+}
+
+bool LogOutputPolicy::IsOpen()
+{
+    return LogWriter::alive && LogWriter::GetInstance().isOpen;
+}
+
+void LogOutputPolicy::Output(const std::string &message)
+{
+    if (IsOpen())
+    {
+        LogWriter::GetInstance().Output(message);
+    }
+}
+
+void LogOutputPolicy::Flush()
+{
+    if (LogWriter::alive)
+    {
+        LogWriter::GetInstance().Flush();
+    }
+}
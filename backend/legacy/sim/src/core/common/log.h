@@ -137,6 +137,7 @@ public:
 
 protected:
     std::ostringstream os; //!< output stream of current log session
+    LogLevel level = LogLevel::Warning; //!< severity of current log session
 
 private:
     static QMutex logGuard; //!< protects output stream from concurrent access
@@ -147,6 +148,8 @@ template<typename T> QMutex Log<T>::logGuard;
 template<typename T>
 std::ostringstream &Log<T>::Get(const char *file, int line, LogLevel level)
 {
+    this->level = level;
+
 #if defined(LOG_TIME_ENABLED)
     os << Log_NowTime();
 #endif // LOG_TIME_ENABLED
@@ -169,6 +172,12 @@ Log<T>::~Log()
     os << std::endl;
     T::Output(os.str());
 //    logGuard.unlock();
+
+    // errors usually precede an abortion, so they must not remain in a buffer
+    if (level == LogLevel::Error)
+    {
+        T::Flush();
+    }
 }
 
 template <typename T>
@@ -195,19 +204,18 @@ std::string Log<T>::ToString(LogLevel level)
 }
 
 //! Handles access of file
+//!
+//! Messages are not written by the logging thread. Each thread appends its messages to an own
+//! lock-free ring buffer, which is drained by a background writer. The writer collects the messages
+//! of all threads and writes them in one batch. Messages are flushed to the file on Flush, after
+//! each error and on exit. On POSIX systems, messages still queued on a crash (SIGSEGV, SIGABRT,
+//! SIGFPE, SIGILL, SIGBUS) are written by an async-signal-safe handler, which then passes the
+//! signal on to the previously installed handler.
 class SIMULATIONCOREEXPORT LogOutputPolicy
 {
 public:
-    ~LogOutputPolicy ()
-    {
-        for (const auto &[id, stream] : logStreamMap)
-        {
-            stream->close();
-        }
-    }
-
     //-----------------------------------------------------------------------------
-    //! Initializes output file.
+    //! Initializes output file and starts the background writer.
     //!
     //! @param[in]     fileName      Name of file where logs are stored
     //-----------------------------------------------------------------------------
@@ -221,51 +229,18 @@ public:
     static bool IsOpen();
 
     //-----------------------------------------------------------------------------
-    //! Logs message into file and standard output.
+    //! Queues message for the output file.
     //!
     //! @param[in]     message      Message to be logged.
     //-----------------------------------------------------------------------------
     static void Output(const std::string &message);
 
-private:
-    static std::map<int, std::unique_ptr<std::ofstream>> logStreamMap;
+    //-----------------------------------------------------------------------------
+    //! Blocks until all messages queued before have been written to the output file.
+    //-----------------------------------------------------------------------------
+    static void Flush();
 };
 
-inline void LogOutputPolicy::SetFile(const std::string &fileName)
-{
-    long long threadId = (long long)QThread::currentThreadId();
-    std::unique_ptr<std::ofstream> logStream = std::make_unique<std::ofstream>();
-    logStream->open(fileName);
-    logStreamMap.emplace(threadId, std::move(logStream));
-}
-
-inline bool LogOutputPolicy::IsOpen()
-{
-    long long threadId = (long long)QThread::currentThreadId();
-    if (logStreamMap.find(threadId) != logStreamMap.end())
-    {
-        return logStreamMap[threadId]->is_open();
-    }
-    else
-    {
-        return false;
-    }
-}
-
-inline void LogOutputPolicy::Output(const std::string &message)
-{
-    // print to standard output
-//    std::cout << message.c_str();
-
-    // print to file
-    long long threadId = (long long)QThread::currentThreadId();
-    if (logStreamMap.find(threadId) != logStreamMap.end())
-    {
-        *logStreamMap[threadId] << message;
-        logStreamMap[threadId]->flush();
-    }
-}
-
 //! Bind logging mechanism to file
 typedef Log<LogOutputPolicy> LogFile;
 
@@ -0,0 +1,146 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \file  PoolAllocated.h
+*	\brief Recycles the memory of frequently created and destroyed objects
+*	\details Spawners create and remove thousands of agents per run, each with
+*            its components, channels and channel buffers. Classes deriving from
+*            PoolAllocated keep the memory of destroyed objects in a free list
+*            and reuse it for the next object of the same type.
+*/
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace core {
+
+//-----------------------------------------------------------------------------
+/** \brief class specific allocation from a free list of blocks of sizeof(T)
+*
+*   Each thread keeps its own free list, so no locking is needed. A block
+*   released by another thread than the allocating one is kept by the
+*   releasing thread. Objects of derived classes with a different size are
+*   allocated from the heap.
+*
+* 	\ingroup opSimulation
+*/
+//-----------------------------------------------------------------------------
+template <typename T>
+class PoolAllocated
+{
+public:
+    static void* operator new(std::size_t size)
+    {
+        if (size == sizeof(T))
+        {
+            if (auto freeList = GetFreeList(); freeList && !freeList->blocks.empty())
+            {
+                void* block = freeList->blocks.back();
+                freeList->blocks.pop_back();
+                return block;
+            }
+        }
+
+        return ::operator new(size);
+    }
+
+    static void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+    {
+        try
+        {
+            return operator new(size);
+        }
+        catch (const std::bad_alloc&)
+        {
+            return nullptr;
+        }
+    }
+
+    static void operator delete(void* block, std::size_t size) noexcept
+    {
+        if (block == nullptr)
+        {
+            return;
+        }
+
+        if (size == sizeof(T))
+        {
+            if (auto freeList = GetFreeList(); freeList && freeList->blocks.size() < MAX_FREE_BLOCKS)
+            {
+                try
+                {
+                    freeList->blocks.push_back(block);
+                    return;
+                }
+                catch (const std::bad_alloc&)
+                {
+                }
+            }
+        }
+
+        ::operator delete(block);
+    }
+
+    //! Called, if the constructor of an object allocated with std::nothrow throws
+    static void operator delete(void* block, const std::nothrow_t&) noexcept
+    {
+        ::operator delete(block);
+    }
+
+    //! Returns the number of blocks in the free list of the calling thread
+    static std::size_t GetFreeBlockCount()
+    {
+        const auto freeList = GetFreeList();
+        return freeList ? freeList->blocks.size() : 0;
+    }
+
+protected:
+    PoolAllocated() = default;
+    ~PoolAllocated() = default;
+
+private:
+    //! maximal number of blocks kept per thread
+    static constexpr std::size_t MAX_FREE_BLOCKS = 4096;
+
+    struct FreeList
+    {
+        ~FreeList()
+        {
+            for (void* block : blocks)
+            {
+                ::operator delete(block);
+            }
+            destroyed = true;
+        }
+
+        bool& destroyed;
+        std::vector<void*> blocks;
+    };
+
+    //! Returns the free list of the calling thread (nullptr while the thread is exiting)
+    static FreeList* GetFreeList()
+    {
+        thread_local bool destroyed{false};
+        if (destroyed)
+        {
+            return nullptr;
+        }
+
+        thread_local FreeList freeList{destroyed, {}};
+        return &freeList;
+    }
+};
+
+} // namespace core
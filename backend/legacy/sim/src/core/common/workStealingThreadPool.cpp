@@ -0,0 +1,196 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "workStealingThreadPool.h"
+
+//-----------------------------------------------------------------------------
+/** \file  WorkStealingThreadPool.cpp */
+//-----------------------------------------------------------------------------
+
+namespace core {
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t numberOfWorkers)
+{
+    for (size_t queueIndex = 0; queueIndex <= numberOfWorkers; ++queueIndex)
+    {
+        queues.emplace_back(std::make_unique<JobQueue>());
+    }
+
+    for (size_t queueIndex = 1; queueIndex <= numberOfWorkers; ++queueIndex)
+    {
+        workers.emplace_back(&WorkStealingThreadPool::WorkerLoop, this, queueIndex);
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        shutdown = true;
+    }
+    batchStarted.notify_all();
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+size_t WorkStealingThreadPool::GetNumberOfThreads() const
+{
+    return queues.size();
+}
+
+bool WorkStealingThreadPool::Execute(std::vector<Job> jobs)
+{
+    if (jobs.empty())
+    {
+        return true;
+    }
+
+    failed = false;
+    firstException = nullptr;
+    pendingJobs = jobs.size();
+
+    for (size_t jobIndex = 0; jobIndex < jobs.size(); ++jobIndex)
+    {
+        auto &queue = *queues[jobIndex % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(&jobs[jobIndex]);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        ++batchGeneration;
+    }
+    batchStarted.notify_all();
+
+    while (RunNextJob(0))
+    {
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        batchFinished.wait(lock, [this] { return pendingJobs == 0; });
+    }
+
+    if (firstException)
+    {
+        std::rethrow_exception(firstException);
+    }
+
+    return !failed;
+}
+
+void WorkStealingThreadPool::WorkerLoop(size_t queueIndex)
+{
+    size_t processedGeneration{0};
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            batchStarted.wait(lock, [this, processedGeneration] { return shutdown || batchGeneration != processedGeneration; });
+
+            if (shutdown)
+            {
+                return;
+            }
+
+            processedGeneration = batchGeneration;
+        }
+
+        while (RunNextJob(queueIndex))
+        {
+        }
+    }
+}
+
+bool WorkStealingThreadPool::RunNextJob(size_t queueIndex)
+{
+    Job *job = PopLocalJob(queueIndex);
+
+    if (!job)
+    {
+        job = StealJob(queueIndex);
+    }
+
+    if (!job)
+    {
+        return false;
+    }
+
+    RunJob(*job);
+    return true;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::PopLocalJob(size_t queueIndex)
+{
+    auto &queue = *queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (queue.jobs.empty())
+    {
+        return nullptr;
+    }
+
+    Job *job = queue.jobs.back();
+    queue.jobs.pop_back();
+    return job;
+}
+
+WorkStealingThreadPool::Job *WorkStealingThreadPool::StealJob(size_t thiefIndex)
+{
+    for (size_t offset = 1; offset < queues.size(); ++offset)
+    {
+        auto &queue = *queues[(thiefIndex + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (!queue.jobs.empty())
+        {
+            Job *job = queue.jobs.front();
+            queue.jobs.pop_front();
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void WorkStealingThreadPool::RunJob(Job &job)
+{
+    if (!failed)
+    {
+        try
+        {
+            if (!job())
+            {
+                failed = true;
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!firstException)
+            {
+                firstException = std::current_exception();
+            }
+            failed = true;
+        }
+    }
+
+    if (--pendingJobs == 0)
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        batchFinished.notify_all();
+    }
+}
+
+} // namespace core
@@ -0,0 +1,108 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \file  WorkStealingThreadPool.h
+*	\brief Fixed size thread pool used to execute independent jobs of a timestep
+*	\details Each thread owns a job queue. Idle threads steal jobs from the
+*            front of other queues, so long running jobs do not leave
+*            cores idle at the end of a batch.
+*/
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace core {
+
+//-----------------------------------------------------------------------------
+/** \brief executes batches of jobs on a fixed number of threads
+*
+*   The calling thread takes part in the execution of a batch, so a pool
+*   created with N worker threads executes up to N+1 jobs concurrently.
+*
+* 	\ingroup opSimulation
+*/
+//-----------------------------------------------------------------------------
+class WorkStealingThreadPool
+{
+public:
+    using Job = std::function<bool()>;
+
+    /*!
+    * \brief WorkStealingThreadPool
+    *
+    * @param[in]     numberOfWorkers    number of threads in addition to the calling thread
+    */
+    explicit WorkStealingThreadPool(size_t numberOfWorkers);
+    WorkStealingThreadPool(const WorkStealingThreadPool &) = delete;
+    WorkStealingThreadPool(WorkStealingThreadPool &&) = delete;
+    WorkStealingThreadPool &operator=(const WorkStealingThreadPool &) = delete;
+    WorkStealingThreadPool &operator=(WorkStealingThreadPool &&) = delete;
+    ~WorkStealingThreadPool();
+
+    /*!
+    * \brief Execute
+    *
+    * \details executes all given jobs and blocks until every job has finished
+    *          (barrier). After the first job reported an error, jobs which
+    *          have not been started yet are skipped. An exception thrown by a
+    *          job is rethrown on the calling thread.
+    *
+    * @param[in]     jobs     jobs to execute, order of execution is unspecified
+    * @return                 false, if a job reports error
+    */
+    bool Execute(std::vector<Job> jobs);
+
+    /*!
+    * \brief GetNumberOfThreads
+    *
+    * @return   number of threads executing a batch (including the calling thread)
+    */
+    size_t GetNumberOfThreads() const;
+
+private:
+    struct JobQueue
+    {
+        std::mutex mutex;
+        std::deque<Job *> jobs;
+    };
+
+    void WorkerLoop(size_t queueIndex);
+    bool RunNextJob(size_t queueIndex);
+    Job *PopLocalJob(size_t queueIndex);
+    Job *StealJob(size_t thiefIndex);
+    void RunJob(Job &job);
+
+    std::vector<std::unique_ptr<JobQueue>> queues;   //!< one queue per worker, index 0 belongs to the calling thread
+    std::vector<std::thread> workers;
+
+    std::mutex stateMutex;
+    std::condition_variable batchStarted;
+    std::condition_variable batchFinished;
+    size_t batchGeneration{0};
+    bool shutdown{false};
+
+    std::atomic<size_t> pendingJobs{0};
+    std::atomic<bool> failed{false};
+    std::mutex exceptionMutex;
+    std::exception_ptr firstException;
+};
+
+} // namespace core
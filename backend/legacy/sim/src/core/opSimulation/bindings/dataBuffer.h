@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "include/dataBufferInterface.h"
 #include "bindings/dataBufferBinding.h"
 
@@ -45,6 +47,7 @@ public:
     void ClearTimeStep() override;
 
     std::unique_ptr<CyclicResultInterface> GetCyclic(const std::optional<openpass::type::EntityId> entityId, const Key &key) const override;
+    std::unique_ptr<CyclicResultInterface> GetCyclics(const std::optional<openpass::type::EntityId> entityId, const KeySelection &selection) const override;
     std::unique_ptr<AcyclicResultInterface> GetAcyclic(const std::optional<openpass::type::EntityId> entityId, const Key &key) const override;
     Values GetStatic(const Key &key) const override;
     Keys GetKeys(const Key &key) const override;
@@ -52,6 +55,7 @@ public:
 private:
     DataBufferBinding *dataBufferBinding = nullptr;
     DataBufferInterface *implementation = nullptr;
+    std::mutex putMutex;    //!< serializes writes of agents executed concurrently by the scheduler
 };
 
 } // namespace core
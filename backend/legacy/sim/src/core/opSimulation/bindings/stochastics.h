@@ -21,6 +21,10 @@
 
 #ifndef SIMULATION_STOCHASTICS_DEFINED
 
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
 #include "common/log.h"
 #include "include/stochasticsInterface.h"
 #include "bindings/stochasticsBinding.h"
@@ -44,42 +48,52 @@ public:
     virtual ~Stochastics() = default;
 
     int GetBinomialDistributed(int upperRangeNum, double probSuccess){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetBinomialDistributed(upperRangeNum, probSuccess);
     }
 
     double GetUniformDistributed(double a, double b){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetUniformDistributed(a, b);
     }
 
     double GetNormalDistributed(double mean, double stdDeviation){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetNormalDistributed(mean, stdDeviation);
     }
 
     double GetExponentialDistributed(double lambda){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetExponentialDistributed(lambda);
     }
 
     double GetGammaDistributed(double mean, double stdDeviation){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetGammaDistributed(mean, stdDeviation);
     }
 
     double GetGammaDistributedShapeScale(double shape, double scale){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetGammaDistributedShapeScale(shape, scale);
     }
 
     double GetLogNormalDistributed(double mean, double stdDeviation){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetLogNormalDistributed(mean, stdDeviation);
     }
 
     double GetLogNormalDistributedMuSigma(double mu, double sigma){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetLogNormalDistributedMuSigma(mu, sigma);
     }
 
     double GetSpecialDistributed(std::string distributionName, std::vector<double> args){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetSpecialDistributed(distributionName, args);
     }
 
     double GetRandomCdfLogNormalDistributed(double mean, double stdDeviation){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->GetRandomCdfLogNormalDistributed(mean, stdDeviation);
     }
 
@@ -92,13 +106,44 @@ public:
     }
 
     void ReInit(){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->ReInit();
     }
 
     void InitGenerator(std::uint32_t seed){
+        std::lock_guard<std::mutex> lock(generatorMutex);
         return implementation->InitGenerator(seed);
     }
 
+    //! Creates the random stream of an agent executed concurrently with other agents
+    //!
+    //! The stream is seeded from the current seed and the agent id, so the draws of an
+    //! agent do not depend on the draws of other agents or on the order of their execution.
+    //!
+    //! \param agentId     id of the agent
+    //! \return stream or nullptr, if the stochastics library is not instantiated
+    virtual std::shared_ptr<StochasticsInterface> CreateAgentStream(int agentId)
+    {
+        if(!stochasticsBinding || !implementation){
+            return nullptr;
+        }
+
+        auto stream = stochasticsBinding->CreateStream();
+        if(stream){
+            stream->InitGenerator(GetAgentSeed(implementation->GetRandomSeed(), agentId));
+        }
+        return stream;
+    }
+
+    //! Derives the seed of an agent stream (SplitMix64 finalizer of seed and agent id)
+    static std::uint32_t GetAgentSeed(std::uint32_t seed, int agentId)
+    {
+        std::uint64_t z = (static_cast<std::uint64_t>(seed) << 32) + static_cast<std::uint32_t>(agentId) + 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<std::uint32_t>(z ^ (z >> 31));
+    }
+
     bool Instantiate(std::string libraryPath)
     {
         if(!stochasticsBinding){
@@ -115,6 +160,7 @@ public:
 private:
     StochasticsBinding *stochasticsBinding = nullptr;
     StochasticsInterface *implementation = nullptr;   
+    std::mutex generatorMutex;  //!< guards the shared generator; concurrent agents draw from their own streams (see CreateAgentStream)
 };
 
 } // namespace core
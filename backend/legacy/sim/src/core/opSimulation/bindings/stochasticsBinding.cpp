@@ -48,6 +48,25 @@ StochasticsInterface* StochasticsBinding::Instantiate(std::string libraryPath)
     return library->CreateStochastics();
 }
 
+std::shared_ptr<StochasticsInterface> StochasticsBinding::CreateStream()
+{
+    if (library == nullptr)
+    {
+        return nullptr;
+    }
+
+    StochasticsInterface* stream = library->CreateStream();
+    if (stream == nullptr)
+    {
+        return nullptr;
+    }
+
+    return std::shared_ptr<StochasticsInterface>(stream, [library = library](StochasticsInterface* instance)
+    {
+        library->ReleaseStream(instance);
+    });
+}
+
 void StochasticsBinding::Unload()
 {
     if (library != nullptr)
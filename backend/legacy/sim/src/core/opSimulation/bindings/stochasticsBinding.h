@@ -49,6 +49,11 @@ public:
     //-----------------------------------------------------------------------------
     StochasticsInterface *Instantiate(std::string libraryPath);
 
+    //! Creates an additional stochastics instance of the instantiated library
+    //! \note The instance keeps the library loaded until it is released
+    //! \return instance or nullptr, if the library is not instantiated
+    std::shared_ptr<StochasticsInterface> CreateStream();
+
     //-----------------------------------------------------------------------------
     //! Unloads the stochasticsInterface binding by deleting the library.
     //-----------------------------------------------------------------------------
@@ -166,4 +166,44 @@ StochasticsInterface *StochasticsLibrary::CreateStochastics()
     return stochasticsInterface;
 }
 
+StochasticsInterface *StochasticsLibrary::CreateStream()
+{
+    if(!library || !library->isLoaded())
+    {
+        return nullptr;
+    }
+
+    try
+    {
+        return createInstanceFunc(callbacks);
+    }
+    catch(std::runtime_error const &ex)
+    {
+        LOG_INTERN(LogLevel::Error) << "could not create stochastics instance: " << ex.what();
+        return nullptr;
+    }
+    catch(...)
+    {
+        LOG_INTERN(LogLevel::Error) << "could not create stochastics instance";
+        return nullptr;
+    }
+}
+
+void StochasticsLibrary::ReleaseStream(StochasticsInterface *stream)
+{
+    if(!stream || !library)
+    {
+        return;
+    }
+
+    try
+    {
+        destroyInstanceFunc(stream);
+    }
+    catch(...)
+    {
+        LOG_INTERN(LogLevel::Error) << "stochastics could not be released";
+    }
+}
+
 } // namespace core
@@ -77,6 +77,21 @@ public:
     //-----------------------------------------------------------------------------
     StochasticsInterface *CreateStochastics();
 
+    //-----------------------------------------------------------------------------
+    //! Creates an additional stochastics instance (e.g. the random stream of an
+    //! agent), which is not stored and has to be released by ReleaseStream.
+    //!
+    //! @return                         stochasticsInterface created
+    //-----------------------------------------------------------------------------
+    StochasticsInterface *CreateStream();
+
+    //-----------------------------------------------------------------------------
+    //! Deletes an instance created by CreateStream
+    //!
+    //! @param[in]  stream              instance to delete
+    //-----------------------------------------------------------------------------
+    void ReleaseStream(StochasticsInterface *stream);
+
 private:
     const std::string DllGetVersionId = "OpenPASS_GetVersion";
     const std::string DllCreateInstanceId = "OpenPASS_CreateInstance";
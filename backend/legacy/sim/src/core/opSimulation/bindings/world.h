@@ -390,6 +390,11 @@ public:
         return implementation->GetRoadStream(route);
     }
 
+    std::shared_ptr<RouteStreamCacheInterface> CreateRouteStreamCache(const RoadGraph& roadGraph) const override
+    {
+        return implementation->CreateRouteStreamCache(roadGraph);
+    }
+
     virtual RouteQueryResult<Obstruction> GetObstruction(const RoadGraph &roadGraph, RoadGraphVertex startNode, const GlobalRoadPosition &ownPosition,
                                                          const std::map<ObjectPoint, Common::Vector2d> &points, const RoadIntervals &touchedRoads) const override
     {
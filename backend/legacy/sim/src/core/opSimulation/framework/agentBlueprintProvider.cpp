@@ -45,12 +45,33 @@ AgentBlueprint AgentBlueprintProvider::SampleAgent(const std::string& agentProfi
                     .SampleVehicleComponentProfiles();
             DynamicParameters dynamicParameters = DynamicParameters::make(stochastics, sampledProfiles.vehicleProfileName, profiles)
                     .SampleSensorLatencies();
-            AgentBuildInformation agentBuildInformation = AgentBuildInformation::make(sampledProfiles, dynamicParameters, systemConfigBlueprint, profiles, vehicleModels)
-                    .SetVehicleModelParameters(assignedParameters)
-                    .GatherBasicComponents()
-                    .GatherDriverComponents()
-                    .GatherVehicleComponents()
-                    .GatherSensors();
+
+            const AgentTypeKey agentTypeKey{sampledProfiles.driverProfileName,
+                                            sampledProfiles.vehicleProfileName,
+                                            {sampledProfiles.vehicleComponentProfileNames.cbegin(), sampledProfiles.vehicleComponentProfileNames.cend()}};
+            const auto agentTypeTemplate = agentTypeTemplates.find(agentTypeKey);
+
+            DynamicAgentTypeGenerator agentTypeGenerator = AgentBuildInformation::make(sampledProfiles, dynamicParameters, systemConfigBlueprint, profiles, vehicleModels);
+            agentTypeGenerator.SetVehicleModelParameters(assignedParameters);
+
+            if (agentTypeTemplate == agentTypeTemplates.end())
+            {
+                agentTypeGenerator.GatherBasicComponents()
+                        .GatherDriverComponents()
+                        .GatherVehicleComponents()
+                        .GatherSensors();
+            }
+            else
+            {
+                agentTypeGenerator.ApplyTemplate(agentTypeTemplate->second);
+            }
+
+            AgentBuildInformation agentBuildInformation = agentTypeGenerator;
+            if (agentTypeTemplate == agentTypeTemplates.end())
+            {
+                agentTypeTemplates.emplace(agentTypeKey, agentBuildInformation);
+            }
+
             GenerateDynamicAgentBlueprint(agentBlueprint, agentBuildInformation, sampledProfiles.driverProfileName);
 
             return agentBlueprint;
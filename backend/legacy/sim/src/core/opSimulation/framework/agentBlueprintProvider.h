@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <tuple>
+
 #include "dynamicAgentTypeGenerator.h"
 #include "common/opExport.h"
 #include "include/agentBlueprintProviderInterface.h"
@@ -63,6 +67,9 @@ public:
                                       std::string vehicleModelName) const;
 
 private:
+    //! Sampled driver profile, vehicle profile and vehicle component profiles, which determine the components of a dynamic agent
+    using AgentTypeKey = std::tuple<std::string, std::string, std::map<std::string, std::string>>;
+
     StochasticsInterface& stochastics;
     const ProfilesInterface* profiles {nullptr};
     const std::unordered_map<std::string, AgentProfile>& agentProfiles;
@@ -70,4 +77,7 @@ private:
     std::shared_ptr<SystemConfigInterface> systemConfigBlueprint;
     const std::map<std::string, std::shared_ptr<SystemConfigInterface>>& systemConfigs;
 
+    //! AgentBuildInformation gathered for the first agent of each combination of sampled profiles
+    mutable std::map<AgentTypeKey, AgentBuildInformation> agentTypeTemplates;
+
 };
@@ -12,14 +12,73 @@
 
 namespace openpass::publisher {
 
+namespace {
+thread_local PublisherWriteBuffer *activeWriteBuffer{nullptr};
+} // namespace
+
 void AgentDataPublisher::Publish(const openpass::databuffer::Key &key, const openpass::databuffer::Value &value)
 {
+    if (auto writeBuffer = PublisherWriteBuffer::GetActive())
+    {
+        writeBuffer->RecordCyclic(dataBuffer, agentId, key, value);
+        return;
+    }
+
     dataBuffer->PutCyclic(agentId, key, value);
 }
 
 void AgentDataPublisher::Publish(const openpass::databuffer::Key &key, const openpass::databuffer::ComponentEvent &event)
 {
+    if (auto writeBuffer = PublisherWriteBuffer::GetActive())
+    {
+        writeBuffer->RecordAcyclic(dataBuffer, agentId, key, Acyclic(key, agentId, event.parameter));
+        return;
+    }
+
     dataBuffer->PutAcyclic(agentId, key, Acyclic(key, agentId, event.parameter));
 }
 
+PublisherWriteBuffer::Activation::Activation(PublisherWriteBuffer &buffer) :
+    previous{activeWriteBuffer}
+{
+    activeWriteBuffer = &buffer;
+}
+
+PublisherWriteBuffer::Activation::~Activation()
+{
+    activeWriteBuffer = previous;
+}
+
+PublisherWriteBuffer *PublisherWriteBuffer::GetActive()
+{
+    return activeWriteBuffer;
+}
+
+void PublisherWriteBuffer::RecordCyclic(DataBufferWriteInterface *dataBuffer, openpass::type::EntityId entityId, const openpass::databuffer::Key &key, const openpass::databuffer::Value &value)
+{
+    writes.push_back({dataBuffer, entityId, key, value});
+}
+
+void PublisherWriteBuffer::RecordAcyclic(DataBufferWriteInterface *dataBuffer, openpass::type::EntityId entityId, const openpass::databuffer::Key &key, openpass::databuffer::Acyclic acyclic)
+{
+    writes.push_back({dataBuffer, entityId, key, std::move(acyclic)});
+}
+
+void PublisherWriteBuffer::Commit()
+{
+    for (const auto &write : writes)
+    {
+        if (const auto value = std::get_if<openpass::databuffer::Value>(&write.data))
+        {
+            write.dataBuffer->PutCyclic(write.entityId, write.key, *value);
+        }
+        else
+        {
+            write.dataBuffer->PutAcyclic(write.entityId, write.key, std::get<openpass::databuffer::Acyclic>(write.data));
+        }
+    }
+
+    writes.clear();
+}
+
 } // namespace openpass::publisher
@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <variant>
+#include <vector>
+
 #include "include/dataBufferInterface.h"
 #include "include/publisherInterface.h"
 
@@ -33,4 +36,46 @@ private:
     const int agentId;
 };
 
+//! Collects the writes of all agent data publishers on the calling thread
+//!
+//! While a buffer is activated on a thread, the publishers record their writes in it instead of
+//! forwarding them to the data buffer. The scheduler uses one buffer per agent and commits them
+//! in a fixed agent order, so the rows do not depend on the execution order of concurrent agents.
+class PublisherWriteBuffer
+{
+public:
+    //! Activates a buffer on the calling thread for the lifetime of the activation
+    class Activation
+    {
+    public:
+        explicit Activation(PublisherWriteBuffer &buffer);
+        Activation(const Activation&) = delete;
+        Activation& operator=(const Activation&) = delete;
+        ~Activation();
+
+    private:
+        PublisherWriteBuffer *previous;
+    };
+
+    //! Returns the buffer activated on the calling thread (nullptr if none)
+    static PublisherWriteBuffer *GetActive();
+
+    void RecordCyclic(DataBufferWriteInterface *dataBuffer, openpass::type::EntityId entityId, const openpass::databuffer::Key &key, const openpass::databuffer::Value &value);
+    void RecordAcyclic(DataBufferWriteInterface *dataBuffer, openpass::type::EntityId entityId, const openpass::databuffer::Key &key, openpass::databuffer::Acyclic acyclic);
+
+    //! Forwards all recorded writes in recording order and clears the buffer
+    void Commit();
+
+private:
+    struct Write
+    {
+        DataBufferWriteInterface *dataBuffer;
+        openpass::type::EntityId entityId;
+        openpass::databuffer::Key key;
+        std::variant<openpass::databuffer::Value, openpass::databuffer::Acyclic> data;
+    };
+
+    std::vector<Write> writes;
+};
+
 } // namespace openpass::publisher
@@ -47,19 +47,22 @@ AgentFactory::AgentFactory(ModelBinding *modelBinding,
                            Stochastics *stochastics,
                            ObservationNetworkInterface *observationNetwork,
                            EventNetworkInterface *eventNetwork,
-                           DataBufferWriteInterface* dataBuffer) :
+                           DataBufferWriteInterface* dataBuffer,
+                           int numberOfThreads) :
     modelBinding(modelBinding),
     world(world),
     stochastics(stochastics),
     observationNetwork(observationNetwork),
     eventNetwork(eventNetwork),
-    dataBuffer(dataBuffer)
+    dataBuffer(dataBuffer),
+    useAgentStreams(numberOfThreads > 1)
 {
 }
 
 void AgentFactory::Clear()
 {
     agentList.clear();
+    agentStreams.clear();
 }
 
 Agent* AgentFactory::AddAgent(AgentBlueprintInterface* agentBlueprint)
@@ -94,9 +97,21 @@ std::unique_ptr<Agent> AgentFactory::CreateAgent(const AgentBlueprintInterface&
         LOG_INTERN(LogLevel::DebugCore) << "agent created (" << agent->GetId() << ")";
     }
 
+    // concurrently executed agents draw from their own streams, so they stay reproducible
+    std::shared_ptr<StochasticsInterface> agentStream;
+    if (useAgentStreams)
+    {
+        agentStream = stochastics->CreateAgentStream(agent->GetId());
+        if (!agentStream)
+        {
+            LOG_INTERN(LogLevel::Error) << "random stream of agent could not be created";
+            return nullptr;
+        }
+    }
+
     if (!agent->Instantiate(agentBlueprint,
                             modelBinding,
-                            stochastics,
+                            agentStream ? agentStream.get() : stochastics,
                             observationNetwork,
                             eventNetwork,
                             dataBuffer))
@@ -112,6 +127,11 @@ std::unique_ptr<Agent> AgentFactory::CreateAgent(const AgentBlueprintInterface&
         return nullptr;
     }
 
+    if (agentStream)
+    {
+        agentStreams.push_back(std::move(agentStream));
+    }
+
     return agent;
 }
 
@@ -31,6 +31,7 @@
 #include "common/opExport.h"
 
 class DataBufferWriteInterface;
+class StochasticsInterface;
 
 namespace core
 {
@@ -49,7 +50,8 @@ public:
                  Stochastics *stochastics,
                  ObservationNetworkInterface *observationNetwork,
                  core::EventNetworkInterface *eventNetwork,
-                 DataBufferWriteInterface* dataBuffer);
+                 DataBufferWriteInterface* dataBuffer,
+                 int numberOfThreads = 1);
     virtual ~AgentFactory() override = default;
 
     virtual void Clear() override;
@@ -88,7 +90,9 @@ private:
     ObservationNetworkInterface *observationNetwork;
     EventNetworkInterface *eventNetwork;
     DataBufferWriteInterface *dataBuffer;
+    const bool useAgentStreams;     //!< agents are executed concurrently and draw from their own streams
 
+    std::vector<std::shared_ptr<StochasticsInterface>> agentStreams;   //!< random streams of the agents (outlive their components)
     std::vector<std::unique_ptr<Agent>> agentList;
 };
 
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <stdexcept>
 
 #include <QCommandLineParser>
 #include <QCoreApplication>
@@ -55,6 +56,23 @@ CommandLineArguments CommandLineParser::CompileCommandLineArguments(const QComma
     parsedArguments.configsPath = commandLineParser.value("configs").toStdString();
     parsedArguments.resultsPath = commandLineParser.value("results").toStdString();
 
+    const auto invocations = commandLineParser.value("invocations");
+    if (invocations != "all")
+    {
+        const auto range = invocations.split('-');
+        bool firstValid = false;
+        bool lastValid = false;
+        const int first = range.size() == 2 ? range[0].toInt(&firstValid) : 0;
+        const int last = range.size() == 2 ? range[1].toInt(&lastValid) : 0;
+
+        if (!firstValid || !lastValid || first < 0 || first > last)
+        {
+            throw std::invalid_argument("Invalid value " + invocations.toStdString() + " for invocations, expected <first>-<last>");
+        }
+
+        parsedArguments.invocations = std::make_pair(first, last);
+    }
+
     return parsedArguments;
 }
 
@@ -117,5 +135,11 @@ const std::vector<CommandLineOption> CommandLineParser::commandLineOptions
         "Path where to put result files",
         "resultPath",
         "results"
+    },
+    {
+        "invocations",
+        "Range of invocations to execute (e.g. 100-199), used for splitting an experiment into several processes",
+        "first-last",
+        "all"
     }
 };
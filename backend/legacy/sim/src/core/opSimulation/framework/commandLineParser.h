@@ -12,7 +12,9 @@
 #pragma once
 
 #include <list>
+#include <optional>
 #include <string>
+#include <utility>
 
 #include <QString>
 #include <QStringList>
@@ -28,6 +30,7 @@ struct SIMULATIONCOREEXPORT CommandLineArguments
     std::string logFile;
     std::string configsPath;
     std::string resultsPath;
+    std::optional<std::pair<int, int>> invocations; //!< first and last invocation to execute (all invocations, if not set)
 };
 
 struct SIMULATIONCOREEXPORT CommandLineOption
@@ -41,6 +44,8 @@ struct SIMULATIONCOREEXPORT CommandLineOption
 class SIMULATIONCOREEXPORT CommandLineParser
 {
 public:
+    //! Parses the command line arguments
+    //! \throws std::invalid_argument, if the given range of invocations is invalid
     static CommandLineArguments Parse(const QStringList& arguments);
     static std::vector<std::string> GetParsingLog();
 private:
@@ -53,11 +53,13 @@ bool ConfigurationContainer::ImportAllConfigurations()
 
     //Import Scenery
     if (!SceneryImporter::Import(openpass::core::Directories::Concat(configurationFiles.configurationDir, scenario.GetSceneryPath()),
-                                 &scenery))
+                                 &scenery,
+                                 simulationConfig.GetExperimentConfig().numberOfThreads))
     {
         LOG_INTERN(LogLevel::Error) << "could not import scenery";
         return false;
     }
+    scenery.SetGeometryCacheDirectory(simulationConfig.GetExperimentConfig().geometryCacheDirectory);
 
     //Import VehicleModels
     std::string vehicleCatalogPath = "";
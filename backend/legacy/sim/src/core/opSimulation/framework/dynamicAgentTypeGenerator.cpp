@@ -10,6 +10,10 @@
 
 #include "dynamicAgentTypeGenerator.h"
 
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
 constexpr char DRIVER[] = "Driver";
 
 DynamicAgentTypeGenerator::DynamicAgentTypeGenerator(SampledProfiles& sampledProfiles,
@@ -157,6 +161,58 @@ DynamicAgentTypeGenerator& DynamicAgentTypeGenerator::GatherSensors()
     return *this;
 }
 
+DynamicAgentTypeGenerator& DynamicAgentTypeGenerator::ApplyTemplate(const AgentBuildInformation& agentTypeTemplate)
+{
+    agentBuildInformation.sensorParameters = agentTypeTemplate.sensorParameters;
+
+    if (agentBuildInformation.sensorParameters.empty())
+    {
+        agentBuildInformation.agentType = agentTypeTemplate.agentType;
+        return *this;
+    }
+
+    std::map<std::string, const openpass::parameter::ParameterSetLevel1*> sensorComponentParameters;
+    for (auto& sensor : agentBuildInformation.sensorParameters)
+    {
+        // the sampled latency is the last parameter added by GatherSensors
+        auto& parameters = sensor.profile.parameter;
+        auto latency = std::find_if(parameters.rbegin(), parameters.rend(), [](const auto& parameter)
+        { return parameter.first == "Latency"; });
+
+        if (latency == parameters.rend())
+        {
+            throw std::runtime_error("Missing latency of sensor " + std::to_string(sensor.id) + " in agent type template");
+        }
+        latency->second = dynamicParameters.sensorLatencies.at(sensor.id);
+
+        sensorComponentParameters.emplace("Sensor_" + std::to_string(sensor.id), &parameters);
+    }
+
+    auto agentType = std::make_shared<core::AgentType>();
+    for (const auto& channel : agentTypeTemplate.agentType->GetChannels())
+    {
+        agentType->AddChannel(channel);
+    }
+
+    for (const auto& [componentName, componentType] : agentTypeTemplate.agentType->GetComponents())
+    {
+        const auto sensorParameters = sensorComponentParameters.find(componentName);
+        if (sensorParameters == sensorComponentParameters.end())
+        {
+            agentType->AddComponent(componentType);
+        }
+        else
+        {
+            auto sensorComponentType = std::make_shared<core::ComponentType>(*componentType);
+            sensorComponentType->SetModelParameter(*sensorParameters->second);
+            agentType->AddComponent(sensorComponentType);
+        }
+    }
+
+    agentBuildInformation.agentType = agentType;
+    return *this;
+}
+
 DynamicAgentTypeGenerator& DynamicAgentTypeGenerator::SetVehicleModelParameters(const openScenario::Parameters& assignedParameters)
 {
     const VehicleProfile vehicleProfile = profiles->GetVehicleProfiles().at(sampledProfiles.vehicleProfileName); // Existence checked by DynamicProfileSampler
@@ -145,6 +145,19 @@ public:
      */
     DynamicAgentTypeGenerator& GatherSensors();
 
+    /*!
+     * \brief Takes the components, channels and sensors from the AgentBuildInformation of a previous agent with the same
+     * sampled profiles instead of gathering them again (replaces GatherBasicComponents, GatherDriverComponents,
+     * GatherVehicleComponents and GatherSensors).
+     *
+     * \details The AgentType is immutable after generation, so the ComponentTypes are shared with the template. Only the
+     * sensors are copied, as their sampled latency differs between agents.
+     *
+     * \param agentTypeTemplate   AgentBuildInformation gathered for the same sampled profiles
+     * \return reference to itself
+     */
+    DynamicAgentTypeGenerator& ApplyTemplate(const AgentBuildInformation& agentTypeTemplate);
+
     /*!
      * \brief Sets the VehicleModelParameters in the AgentBuildInformation depending on the vehicle model name.
      * \return  reference to itself
@@ -0,0 +1,34 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "invocations.h"
+
+#include <algorithm>
+
+#include "common/log.h"
+
+namespace core {
+
+Invocations GetInvocations(const ExperimentConfig& experimentConfig, const std::optional<std::pair<int, int>>& range)
+{
+    if (!range.has_value())
+    {
+        return {0, experimentConfig.numberOfInvocations};
+    }
+
+    const int first = std::min(range->first, experimentConfig.numberOfInvocations);
+    const int end = std::min(range->second + 1, experimentConfig.numberOfInvocations);
+
+    LOG_INTERN(LogLevel::DebugCore) << "executing invocations " << first << " to " << end - 1
+                                    << " of " << experimentConfig.numberOfInvocations;
+    return {first, end - first};
+}
+
+} // namespace core
@@ -0,0 +1,46 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+//-----------------------------------------------------------------------------
+//! @file  invocations.h
+//! @brief This file contains the selection of the invocations executed by
+//!        an instance of the simulation.
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <optional>
+#include <utility>
+
+#include "common/opExport.h"
+#include "include/simulationConfigInterface.h"
+
+namespace core {
+
+//! Consecutive invocations of the experiment
+struct Invocations
+{
+    int first;     //!< Number of the first invocation (offset of the random seed and run id)
+    int count;     //!< Number of invocations
+};
+
+//-----------------------------------------------------------------------------
+//! \brief  Gets the invocations to execute, which are either all invocations of
+//!         the experiment or the range given on the command line (e.g. by the
+//!         opSimulationManager, which splits large experiments into several processes).
+//!         The range is clamped to the invocations of the experiment.
+//! \param  experimentConfig  experiment configuration
+//! \param  range             first and last invocation given on the command line
+//! \return invocations to execute
+//-----------------------------------------------------------------------------
+SIMULATIONCOREEXPORT Invocations GetInvocations(const ExperimentConfig& experimentConfig,
+                                                const std::optional<std::pair<int, int>>& range);
+
+} // namespace core
@@ -17,6 +17,11 @@
 #include <QElapsedTimer>
 
 #include <algorithm>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include "frameworkModules.h"
 #include "configurationFiles.h"
@@ -24,6 +29,7 @@
 #include "commandLineParser.h"
 #include "configurationContainer.h"
 #include "frameworkModuleContainer.h"
+#include "invocations.h"
 #include "common/log.h"
 #include "runInstantiator.h"
 
@@ -65,6 +71,30 @@ static bool CheckWritableDir(const std::string& directory, const std::string& pr
 //-----------------------------------------------------------------------------
 static bool CheckDirectories(const openpass::core::Directories& directories);
 
+//-----------------------------------------------------------------------------
+//! \brief  Executes the invocations of the experiment in consecutive slices,
+//!         which run concurrently on own threads. Each slice has its own
+//!         framework modules (world, databuffer, stochastics, ...), while the
+//!         imported configurations (incl. the parsed scenery) and the
+//!         geometry of the road network, which is converted by the first
+//!         world only, are shared read-only. The world of each slice still
+//!         creates its own roads, lanes and localization index from them.
+//!         The results of a slice are written into the subdirectory
+//!         "Invocations_<first>-<last>" of the output directory. Their run ids
+//!         are the numbers of the invocations.
+//! \param  configurationContainer  imported configurations
+//! \param  frameworkModules        libraries of the framework modules
+//! \param  runtimeInformation      runtime information (output directory is replaced per slice)
+//! \param  callbacks               callbacks of the framework modules
+//! \param  invocations             invocations to execute
+//! \return true, if all slices were successful
+//-----------------------------------------------------------------------------
+static bool ExecuteConcurrentInvocations(Configuration::ConfigurationContainer& configurationContainer,
+                                         FrameworkModules& frameworkModules,
+                                         const openpass::common::RuntimeInformation& runtimeInformation,
+                                         CallbackInterface* callbacks,
+                                         Invocations invocations);
+
 //-----------------------------------------------------------------------------
 //! Entry point of program.
 //!
@@ -84,7 +114,16 @@ int main(int argc, char* argv[])
 
     application.setApplicationVersion(QString::fromStdString(openpass::common::framework.str()));
 
-    CommandLineArguments parsedArguments = CommandLineParser::Parse(application.arguments());
+    CommandLineArguments parsedArguments;
+    try
+    {
+        parsedArguments = CommandLineParser::Parse(application.arguments());
+    }
+    catch (const std::invalid_argument& error)
+    {
+        std::cerr << error.what() << std::endl;
+        exit(EXIT_FAILURE);
+    }
 
     SetupLogging(static_cast<LogLevel>(parsedArguments.logLevel),
                  parsedArguments.logFile,
@@ -125,16 +164,31 @@ int main(int argc, char* argv[])
     };
 
     SimulationCommon::Callbacks callbacks;
-    FrameworkModuleContainer frameworkModuleContainer(frameworkModules,
-                                                      &configurationContainer,
-                                                      runtimeInformation,
-                                                      &callbacks);
+    bool success{false};
 
-    RunInstantiator runInstantiator(configurationContainer,
-                                    frameworkModuleContainer,
-                                    frameworkModules);
+    const auto invocations = GetInvocations(configurationContainer.GetSimulationConfig()->GetExperimentConfig(),
+                                            parsedArguments.invocations);
 
-    if (runInstantiator.ExecuteRun())
+    if (configurationContainer.GetSimulationConfig()->GetExperimentConfig().numberOfConcurrentInvocations > 1)
+    {
+        success = ExecuteConcurrentInvocations(configurationContainer, frameworkModules, runtimeInformation, &callbacks, invocations);
+    }
+    else
+    {
+        FrameworkModuleContainer frameworkModuleContainer(frameworkModules,
+                                                          &configurationContainer,
+                                                          runtimeInformation,
+                                                          &callbacks);
+
+        RunInstantiator runInstantiator(configurationContainer,
+                                        frameworkModuleContainer,
+                                        frameworkModules,
+                                        invocations);
+
+        success = runInstantiator.ExecuteRun();
+    }
+
+    if (success)
     {
         LOG_INTERN(LogLevel::DebugCore) << "simulation finished successfully";
     }
@@ -152,6 +206,65 @@ int main(int argc, char* argv[])
     return 0;
 }
 
+bool ExecuteConcurrentInvocations(Configuration::ConfigurationContainer& configurationContainer,
+                                  FrameworkModules& frameworkModules,
+                                  const openpass::common::RuntimeInformation& runtimeInformation,
+                                  CallbackInterface* callbacks,
+                                  Invocations invocations)
+{
+    const auto& experimentConfig = configurationContainer.GetSimulationConfig()->GetExperimentConfig();
+    const int numberOfSlices = std::min(experimentConfig.numberOfConcurrentInvocations, invocations.count);
+
+    // the framework modules keep references to their runtime information
+    std::vector<std::unique_ptr<openpass::common::RuntimeInformation>> sliceRuntimeInformation;
+    std::vector<std::unique_ptr<FrameworkModuleContainer>> sliceFrameworkModuleContainers;
+    std::vector<std::unique_ptr<RunInstantiator>> sliceRunInstantiators;
+
+    int firstInvocation = invocations.first;
+    for (int slice = 0; slice < numberOfSlices; ++slice)
+    {
+        const int numberOfInvocations = invocations.count / numberOfSlices +
+                                        (slice < invocations.count % numberOfSlices ? 1 : 0);
+        const QString sliceDir = QString("Invocations_%1-%2").arg(firstInvocation).arg(firstInvocation + numberOfInvocations - 1);
+
+        auto& sliceInformation = sliceRuntimeInformation.emplace_back(std::make_unique<openpass::common::RuntimeInformation>(runtimeInformation));
+        sliceInformation->directories.output = QDir(QString::fromStdString(runtimeInformation.directories.output)).filePath(sliceDir).toStdString();
+        QDir().mkpath(QString::fromStdString(sliceInformation->directories.output));
+
+        auto& frameworkModuleContainer = sliceFrameworkModuleContainers.emplace_back(
+            std::make_unique<FrameworkModuleContainer>(frameworkModules, &configurationContainer, *sliceInformation, callbacks));
+
+        sliceRunInstantiators.emplace_back(std::make_unique<RunInstantiator>(
+            configurationContainer, *frameworkModuleContainer, frameworkModules, Invocations{firstInvocation, numberOfInvocations}));
+
+        LOG_INTERN(LogLevel::DebugCore) << "invocations " << firstInvocation << " to " << firstInvocation + numberOfInvocations - 1
+                                        << " write into " << sliceInformation->directories.output;
+        firstInvocation += numberOfInvocations;
+    }
+
+    std::vector<std::future<bool>> sliceResults;
+    for (auto& runInstantiator : sliceRunInstantiators)
+    {
+        sliceResults.emplace_back(std::async(std::launch::async, [&runInstantiator] { return runInstantiator->ExecuteRun(); }));
+    }
+
+    bool success = true;
+    for (auto& sliceResult : sliceResults)
+    {
+        try
+        {
+            success = sliceResult.get() && success;
+        }
+        catch (const std::exception& error)
+        {
+            LOG_INTERN(LogLevel::Error) << "invocations aborted: " << error.what();
+            success = false;
+        }
+    }
+
+    return success;
+}
+
 void SetupLogging(LogLevel logLevel, const std::string& logFile, const std::vector<std::string>& bufferedMessages)
 {
     QDir logFilePath(QString::fromStdString(logFile));
@@ -60,13 +60,18 @@ bool RunInstantiator::ExecuteRun()
         return false;
     }
 
+    const auto [firstInvocation, numberOfInvocations] = invocations.value_or(Invocations{0, experimentConfig.numberOfInvocations});
+
     dataBuffer.PutStatic("SceneryFile", scenario.GetSceneryPath(), true);
+    dataBuffer.PutStatic("EndTime", scenario.GetEndTime(), true);
+    dataBuffer.PutStatic("CycleTime", core::scheduling::Scheduler::FRAMEWORK_UPDATE_RATE, true);
+    dataBuffer.PutStatic("FirstInvocation", firstInvocation, true);   // observers number their runs from here on
     ThrowIfFalse(observationNetwork.InitAll(), "Failed to initialize ObservationNetwork");
 
-    core::scheduling::Scheduler scheduler(world, spawnPointNetwork, eventDetectorNetwork, manipulatorNetwork, observationNetwork, dataBuffer);
+    core::scheduling::Scheduler scheduler(world, spawnPointNetwork, eventDetectorNetwork, manipulatorNetwork, observationNetwork, dataBuffer, experimentConfig.numberOfThreads);
     bool scheduler_state{false};
 
-    for (auto invocation = 0; invocation < experimentConfig.numberOfInvocations; invocation++)
+    for (auto invocation = firstInvocation; invocation < firstInvocation + numberOfInvocations; invocation++)
     {
         RunResult runResult;
 
@@ -162,6 +167,7 @@ std::unique_ptr<ParameterInterface> RunInstantiator::SampleWorldParameters(const
     parameters.emplace_back("VisibilityDistance", Sampler::Sample(environmentConfig.visibilityDistances, stochastics));
     parameters.emplace_back("Friction", Sampler::Sample(environmentConfig.frictions, stochastics));
     parameters.emplace_back("Weather", Sampler::Sample(environmentConfig.weathers, stochastics));
+    parameters.emplace_back("NumberOfThreads", configurationContainer.GetSimulationConfig()->GetExperimentConfig().numberOfThreads);
 
     return openpass::parameter::make<SimulationCommon::Parameters>(runtimeInformation, parameters);
 }
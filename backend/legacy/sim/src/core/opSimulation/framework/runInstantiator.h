@@ -21,9 +21,11 @@
 
 #include "common/opExport.h"
 #include <map>
+#include <optional>
 #include <string>
 
 #include "frameworkModules.h"
+#include "invocations.h"
 
 #include "include/agentFactoryInterface.h"
 #include "include/configurationContainerInterface.h"
@@ -38,9 +40,13 @@ namespace core {
 class SIMULATIONCOREEXPORT RunInstantiator
 {
 public:
+    //-----------------------------------------------------------------------------
+    //! @param[in] invocations  Invocations executed by this instance (all invocations of the experiment, if not set)
+    //-----------------------------------------------------------------------------
     RunInstantiator(ConfigurationContainerInterface& configurationContainer,
                     FrameworkModuleContainerInterface& frameworkModuleContainer,
-                    FrameworkModules& frameworkModules) :
+                    FrameworkModules& frameworkModules,
+                    std::optional<Invocations> invocations = std::nullopt) :
         configurationContainer(configurationContainer),
         observationNetwork(*frameworkModuleContainer.GetObservationNetwork()),
         agentFactory(*frameworkModuleContainer.GetAgentFactory()),
@@ -52,7 +58,8 @@ public:
         eventDetectorNetwork(*frameworkModuleContainer.GetEventDetectorNetwork()),
         manipulatorNetwork(*frameworkModuleContainer.GetManipulatorNetwork()),
         dataBuffer(*frameworkModuleContainer.GetDataBuffer()),
-        frameworkModules{frameworkModules}
+        frameworkModules{frameworkModules},
+        invocations{invocations}
     {}
 
     //-----------------------------------------------------------------------------
@@ -109,6 +116,7 @@ private:
     ManipulatorNetworkInterface& manipulatorNetwork;
     DataBufferInterface& dataBuffer;
     FrameworkModules& frameworkModules;
+    std::optional<Invocations> invocations;
 
     std::unique_ptr<ParameterInterface> worldParameter;
 };
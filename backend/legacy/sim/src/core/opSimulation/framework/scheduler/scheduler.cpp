@@ -11,8 +11,11 @@
 
 #include "scheduler.h"
 
+#include <unordered_map>
+
 #include "common/log.h"
 #include "agent.h"
+#include "agentDataPublisher.h"
 #include "agentParser.h"
 #include "eventNetwork.h"
 #include "runResult.h"
@@ -27,7 +30,8 @@ Scheduler::Scheduler(WorldInterface &world,
                      EventDetectorNetworkInterface &eventDetectorNetwork,
                      ManipulatorNetworkInterface &manipulatorNetwork,
                      ObservationNetworkInterface &observationNetwork,
-                     DataBufferInterface &dataInterface) :
+                     DataBufferInterface &dataInterface,
+                     int numberOfThreads) :
     world(world),
     spawnPointNetwork(spawnPointNetwork),
     eventDetectorNetwork(eventDetectorNetwork),
@@ -35,6 +39,11 @@ Scheduler::Scheduler(WorldInterface &world,
     observationNetwork(observationNetwork),
     dataInterface(dataInterface)
 {
+    if (numberOfThreads > 1)
+    {
+        threadPool = std::make_unique<WorkStealingThreadPool>(static_cast<size_t>(numberOfThreads - 1));
+        LOG_INTERN(LogLevel::DebugCore) << "Scheduler: executing agent tasks on " << numberOfThreads << " threads";
+    }
 }
 
 bool Scheduler::Run(
@@ -90,8 +99,8 @@ bool Scheduler::Run(
         UpdateAgents(taskList, world);
 
         if (!ExecuteTasks(taskList.GetPreAgentTasks(currentTime)) ||
-            !ExecuteTasks(taskList.ConsumeNonRecurringAgentTasks(currentTime)) ||
-            !ExecuteTasks(taskList.GetRecurringAgentTasks(currentTime)) ||
+            !ExecuteAgentTasks(taskList.ConsumeNonRecurringAgentTasks(currentTime)) ||
+            !ExecuteAgentTasks(taskList.GetRecurringAgentTasks(currentTime)) ||
             !ExecuteTasks(taskList.GetSynchronizeTasks(currentTime)))
         {
             return Scheduler::FAILURE;
@@ -120,7 +129,7 @@ bool Scheduler::Run(
 template <typename T>
 bool Scheduler::ExecuteTasks(T tasks)
 {
-    for (const auto &task : tasks)
+    for (const TaskItem &task : tasks)
     {
         if (task.func() == false)
         {
@@ -130,6 +139,57 @@ bool Scheduler::ExecuteTasks(T tasks)
     return true;
 }
 
+template <typename T>
+bool Scheduler::ExecuteAgentTasks(const T &tasks)
+{
+    if (!threadPool)
+    {
+        return ExecuteTasks(tasks);
+    }
+
+    std::vector<std::vector<const TaskItem *>> agentTaskGroups;
+    std::unordered_map<int, size_t> groupIndexByAgentId;
+
+    for (const TaskItem &task : tasks)
+    {
+        const auto [groupIndex, isNewAgent] = groupIndexByAgentId.try_emplace(task.agentId, agentTaskGroups.size());
+        if (isNewAgent)
+        {
+            agentTaskGroups.emplace_back();
+        }
+        agentTaskGroups[groupIndex->second].push_back(&task);
+    }
+
+    // writes are committed in the order of the groups, independent of the execution order
+    std::vector<openpass::publisher::PublisherWriteBuffer> writeBuffers(agentTaskGroups.size());
+    std::vector<WorkStealingThreadPool::Job> jobs;
+    jobs.reserve(agentTaskGroups.size());
+
+    for (size_t groupIndex = 0; groupIndex < agentTaskGroups.size(); ++groupIndex)
+    {
+        jobs.emplace_back([&agentTasks = agentTaskGroups[groupIndex], &writeBuffer = writeBuffers[groupIndex]] {
+            openpass::publisher::PublisherWriteBuffer::Activation activation(writeBuffer);
+            for (const auto *task : agentTasks)
+            {
+                if (task->func() == false)
+                {
+                    return false;
+                }
+            }
+            return true;
+        });
+    }
+
+    const bool success = threadPool->Execute(std::move(jobs));
+
+    for (auto &writeBuffer : writeBuffers)
+    {
+        writeBuffer.Commit();
+    }
+
+    return success;
+}
+
 void Scheduler::UpdateAgents(SchedulerTasks &taskList, WorldInterface &world)
 {
     for (const auto &agent : spawnPointNetwork.ConsumeNewAgents())
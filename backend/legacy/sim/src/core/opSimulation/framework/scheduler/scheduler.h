@@ -14,6 +14,7 @@
 #include <functional>
 #include <memory>
 
+#include "common/workStealingThreadPool.h"
 #include "include/worldInterface.h"
 #include "schedulerTasks.h"
 
@@ -36,6 +37,9 @@ namespace scheduling {
 * 	\details The scheduler triggers TaskBuilder to build up common tasks and
 *           SchedulerTasks to manage sorting of all tasks. Each timestep all
 *           given tasks are executed.
+*           If more than one thread is requested, the tasks of the agent phase
+*           are grouped by agent and the groups are executed concurrently.
+*           All agent groups are finished before the synchronize tasks start.
 *
 * 	\ingroup opSimulation
 */
@@ -52,7 +56,8 @@ public:
               core::EventDetectorNetworkInterface &eventDetectorNetwork,
               core::ManipulatorNetworkInterface &manipulatorNetwork,
               core::ObservationNetworkInterface &observationNetwork,
-              DataBufferInterface& dataInterface);
+              DataBufferInterface& dataInterface,
+              int numberOfThreads = 1);
 
     /*!
     * \brief Run
@@ -89,6 +94,8 @@ private:
     ObservationNetworkInterface &observationNetwork;
     DataBufferInterface& dataInterface;
 
+    std::unique_ptr<WorkStealingThreadPool> threadPool;
+
     int currentTime;
 
     /*!
@@ -112,6 +119,23 @@ private:
     */
     template <typename T>
     bool ExecuteTasks(T tasks);
+
+    /*!
+    * \brief ExecuteAgentTasks
+    *
+    * \details execute tasks of the agent phase. Without thread pool the
+    *          tasks are executed in the given order. Otherwise the tasks are
+    *          grouped by agent id, keeping the order within each agent, and
+    *          the groups are executed concurrently.
+    *          The published data of each agent is then buffered and
+    *          committed in the order of the first task of each agent, so the
+    *          data buffer content does not depend on the execution order.
+    *
+    * @param[in]     tasks     agent tasks of the current timestamp
+    * @return                  false, if a task reports error
+    */
+    template <typename T>
+    bool ExecuteAgentTasks(const T &tasks);
 };
 
 } // namespace scheduling
@@ -43,7 +43,11 @@ SchedulerTasks::SchedulerTasks(std::vector<TaskItem> bootstrapTasks,
 
 void SchedulerTasks::ScheduleNewRecurringTasks(std::vector<TaskItem> newTasks)
 {
-    ScheduleNewTasks(recurringAgentTasks, std::move(newTasks));
+    for (const auto &newTask : newTasks)
+    {
+        recurringAgentSchedule.Add(recurringAgentTasks.AddTask(newTask));
+        UpdateScheduledTimestamps(newTask.cycletime, newTask.delay);
+    }
 }
 
 void SchedulerTasks::ScheduleNewNonRecurringTasks(std::vector<TaskItem> newTasks)
@@ -105,8 +109,13 @@ void SchedulerTasks::CreateNewScheduledTimestamps()
     scheduledTimestamps.insert(upperBoundOfScheduledTimestamps);
 
     UpdateScheduledTimestamps(spawningTasks.tasks);
-    UpdateScheduledTimestamps(recurringAgentTasks.tasks);
     UpdateScheduledTimestamps(nonRecurringAgentTasks.tasks);
+
+    // recurring agent tasks mostly share few schedules
+    for (const auto &[schedule, numberOfTasks] : recurringAgentSchedule.GetSchedules())
+    {
+        UpdateScheduledTimestamps(schedule.first, schedule.second);
+    }
 }
 
 int SchedulerTasks::GetNextTimestamp(int timestamp)
@@ -135,19 +144,19 @@ void SchedulerTasks::ExpandUpperBoundary(int timestamp)
     // we are not time travelling.. backwards is illogical
 }
 
-void SchedulerTasks::GetTasks(int timestamp, std::multiset<TaskItem> &tasks, std::vector<TaskItem> &currentTasks)
+void SchedulerTasks::GetTasks(int timestamp, std::multiset<TaskItem> &tasks, TaskItemRefs &currentTasks)
 {
     for (const auto &task : tasks)
     {
         if (task.cycletime == 0)
         {
-            currentTasks.push_back(task);
+            currentTasks.emplace_back(task);
             continue;
         }
 
         if ((timestamp - task.delay) % task.cycletime == 0)
         {
-            currentTasks.push_back(task);
+            currentTasks.emplace_back(task);
         }
     }
 }
@@ -162,24 +171,30 @@ std::vector<TaskItem> SchedulerTasks::GetTasks(int timestamp)
         return currentTasks;
     }
 
-    GetTasks(timestamp, spawningTasks.tasks, currentTasks);
+    TaskItemRefs spawningTaskRefs;
+    GetTasks(timestamp, spawningTasks.tasks, spawningTaskRefs);
+    currentTasks.assign(spawningTaskRefs.cbegin(), spawningTaskRefs.cend());
+
     PullNonRecurringTasks(timestamp, currentTasks);
-    GetTasks(timestamp, recurringAgentTasks.tasks, currentTasks);
-    GetTasks(timestamp, synchronizeTasks.tasks, currentTasks);
+
+    TaskItemRefs agentTaskRefs;
+    recurringAgentSchedule.GetDueTasks(timestamp, agentTaskRefs);
+    GetTasks(timestamp, synchronizeTasks.tasks, agentTaskRefs);
+    currentTasks.insert(currentTasks.end(), agentTaskRefs.cbegin(), agentTaskRefs.cend());
 
     return currentTasks;
 }
 
-std::vector<TaskItem> SchedulerTasks::GetSpawningTasks(int timestamp)
+TaskItemRefs SchedulerTasks::GetSpawningTasks(int timestamp)
 {
-    std::vector<TaskItem> currentTasks;
+    TaskItemRefs currentTasks;
     GetTasks(timestamp, spawningTasks.tasks, currentTasks);
     return currentTasks;
 }
 
-std::vector<TaskItem> SchedulerTasks::GetPreAgentTasks(int timestamp)
+TaskItemRefs SchedulerTasks::GetPreAgentTasks(int timestamp)
 {
-    std::vector<TaskItem> currentTasks;
+    TaskItemRefs currentTasks;
     GetTasks(timestamp, preAgentTasks.tasks, currentTasks);
     return currentTasks;
 }
@@ -191,23 +206,26 @@ std::vector<TaskItem> SchedulerTasks::ConsumeNonRecurringAgentTasks(int timestam
     return currentTasks;
 }
 
-std::vector<TaskItem> SchedulerTasks::GetRecurringAgentTasks(int timestamp)
+TaskItemRefs SchedulerTasks::GetRecurringAgentTasks(int timestamp)
 {
-    std::vector<TaskItem> currentTasks;
-    GetTasks(timestamp, recurringAgentTasks.tasks, currentTasks);
+    TaskItemRefs currentTasks;
+    recurringAgentSchedule.GetDueTasks(timestamp, currentTasks);
     return currentTasks;
 }
 
-std::vector<TaskItem> SchedulerTasks::GetSynchronizeTasks(int timestamp)
+TaskItemRefs SchedulerTasks::GetSynchronizeTasks(int timestamp)
 {
-    std::vector<TaskItem> currentTasks;
+    TaskItemRefs currentTasks;
     GetTasks(timestamp, synchronizeTasks.tasks, currentTasks);
     return currentTasks;
 }
 
 void SchedulerTasks::PullNonRecurringTasks(int timestamp, std::vector<TaskItem> &currentTasks)
 {
-    GetTasks(timestamp, nonRecurringAgentTasks.tasks, currentTasks);
+    // copied, as the tasks are cleared
+    TaskItemRefs nonRecurringTaskRefs;
+    GetTasks(timestamp, nonRecurringAgentTasks.tasks, nonRecurringTaskRefs);
+    currentTasks.insert(currentTasks.end(), nonRecurringTaskRefs.cbegin(), nonRecurringTaskRefs.cend());
     ClearNonrecurringTasks();
 }
 
@@ -236,6 +254,7 @@ void SchedulerTasks::DeleteAgentTasks(std::vector<int> &agentIds)
 {
     for (const auto &agentId : agentIds)
     {
+        recurringAgentSchedule.Remove(agentId);
         recurringAgentTasks.DeleteTasks(agentId);
         nonRecurringAgentTasks.DeleteTasks(agentId); //if agent immediately will be removed after spawning
     }
@@ -27,6 +27,10 @@ namespace core::scheduling {
 * 	\details The SchedulerTasks class sorts tasks for each phase (bbootstrap,
 *           common, nonrecurring, recurring, finalize recurring, finalize)
 *           Returns all tasks for given timestamp.
+*           Recurring agent tasks are additionally bucketed by their next due
+*           timestamp (see TaskSchedule), so only due tasks are visited.
+*           Tasks of the phases are returned as references to the stored tasks,
+*           which stay valid until the tasks are deleted.
 *
 * 	\ingroup opSimulation
 */
@@ -42,6 +46,10 @@ public:
                    std::vector<TaskItem> finalizeTasks,
                    int scheduledTimestampsInterval);
 
+    //! The recurring agent schedule references the stored tasks
+    SchedulerTasks(const SchedulerTasks &) = delete;
+    SchedulerTasks &operator=(const SchedulerTasks &) = delete;
+
     /*!
     * \brief ScheduleNewRecurringTasks
     *
@@ -102,9 +110,9 @@ public:
     * @param[in]     int                timestamp
     * @return    list of TaskItems  all common tasks for given timestamp
     */
-    std::vector<TaskItem> GetSpawningTasks(int timestamp);
+    TaskItemRefs GetSpawningTasks(int timestamp);
 
-    std::vector<TaskItem> GetPreAgentTasks(int timestamp);
+    TaskItemRefs GetPreAgentTasks(int timestamp);
 
     /*!
     * \brief ConsumeNonRecurringTasks
@@ -129,12 +137,14 @@ public:
     /*!
     * \brief GetRecurringTasks
     *
+    * \details timestamps have to be passed in ascending order
+    *
     * @param[in]    int                timestamp
     * @return       list of TaskItems  all recurring tasks for given timestamp
     */
-    std::vector<TaskItem> GetRecurringAgentTasks(int timestamp);
+    TaskItemRefs GetRecurringAgentTasks(int timestamp);
 
-    std::vector<TaskItem> GetSynchronizeTasks(int timestamp);
+    TaskItemRefs GetSynchronizeTasks(int timestamp);
 
     /*!
     * \brief GetBootstrapTasks
@@ -177,7 +187,7 @@ private:
     * @param[in]     tasks              tasks to filter by current timestamp
     * @param[out]    list of TaskItems  filtered tasks
     */
-    void GetTasks(int timestamp, std::multiset<TaskItem> &tasks, std::vector<TaskItem> &currentTasks);
+    void GetTasks(int timestamp, std::multiset<TaskItem> &tasks, TaskItemRefs &currentTasks);
 
     /*!
     * \brief UpdateScheduledTimestamps
@@ -224,6 +234,8 @@ private:
     */
     void ExpandUpperBoundary(int timestamp);
 
+    TaskSchedule recurringAgentSchedule;   //!< recurringAgentTasks by next due timestamp
+
     int scheduledTimestampsInterval;
     int upperBoundOfScheduledTimestamps;
     int lowerBoundOfScheduledTimestamps;
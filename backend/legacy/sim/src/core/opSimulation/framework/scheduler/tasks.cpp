@@ -10,15 +10,17 @@
 
 #include "tasks.h"
 
+#include <algorithm>
+
 //-----------------------------------------------------------------------------
 /** \file  Tasks.cpp */
 //-----------------------------------------------------------------------------
 
 namespace core::scheduling {
 
-void Tasks::AddTask(const TaskItem &newTask)
+const TaskItem &Tasks::AddTask(const TaskItem &newTask)
 {
-    tasks.insert(newTask);
+    return *tasks.insert(newTask);
 }
 
 void Tasks::DeleteTasks(int agentId)
@@ -37,6 +39,103 @@ void Tasks::DeleteTasks(int agentId)
     }
 }
 
+void TaskSchedule::Add(const TaskItem &task)
+{
+    const Entry entry{&task, nextSequenceNumber++};
+
+    if (task.cycletime == 0)
+    {
+        everyTimestampTasks.push_back(entry);
+    }
+    else
+    {
+        unplacedTasks.push_back(entry);
+    }
+
+    ++schedules[{task.cycletime, task.delay}];
+}
+
+void TaskSchedule::Remove(int agentId)
+{
+    const auto removeTasks = [this, agentId](std::vector<Entry> &entries) {
+        entries.erase(std::remove_if(entries.begin(), entries.end(), [this, agentId](const Entry &entry) {
+                          if (entry.task->agentId != agentId)
+                          {
+                              return false;
+                          }
+
+                          const auto schedule = schedules.find({entry.task->cycletime, entry.task->delay});
+                          if (--schedule->second == 0)
+                          {
+                              schedules.erase(schedule);
+                          }
+                          return true;
+                      }),
+                      entries.end());
+    };
+
+    removeTasks(unplacedTasks);
+    removeTasks(everyTimestampTasks);
+
+    auto bucket = buckets.begin();
+    while (bucket != buckets.end())
+    {
+        removeTasks(bucket->second);
+        bucket = bucket->second.empty() ? buckets.erase(bucket) : std::next(bucket);
+    }
+}
+
+void TaskSchedule::GetDueTasks(int timestamp, TaskItemRefs &dueTasks)
+{
+    std::vector<Entry> dueEntries{everyTimestampTasks};
+
+    for (const auto &entry : unplacedTasks)
+    {
+        Place(entry, timestamp, dueEntries);
+    }
+    unplacedTasks.clear();
+
+    while (!buckets.empty() && buckets.begin()->first <= timestamp)
+    {
+        const auto bucket = buckets.extract(buckets.begin());
+        for (const auto &entry : bucket.mapped())
+        {
+            Place(entry, timestamp, dueEntries);
+        }
+    }
+
+    std::sort(dueEntries.begin(), dueEntries.end(), [](const Entry &lhs, const Entry &rhs) {
+        return *lhs.task < *rhs.task ||
+               (!(*rhs.task < *lhs.task) && lhs.sequenceNumber < rhs.sequenceNumber);
+    });
+
+    for (const auto &entry : dueEntries)
+    {
+        dueTasks.emplace_back(*entry.task);
+    }
+}
+
+void TaskSchedule::Place(const Entry &entry, int timestamp, std::vector<Entry> &dueEntries)
+{
+    const int cycleTime = entry.task->cycletime;
+    const int nextDueTimestamp = timestamp + ((entry.task->delay - timestamp) % cycleTime + cycleTime) % cycleTime;
+
+    if (nextDueTimestamp == timestamp)
+    {
+        dueEntries.push_back(entry);
+        buckets[timestamp + cycleTime].push_back(entry);
+    }
+    else
+    {
+        buckets[nextDueTimestamp].push_back(entry);
+    }
+}
+
+const std::map<TaskSchedule::Schedule, size_t> &TaskSchedule::GetSchedules() const
+{
+    return schedules;
+}
+
 bool TaskItem::operator<(const TaskItem &rhs) const
 {
     return (priority > rhs.priority ||
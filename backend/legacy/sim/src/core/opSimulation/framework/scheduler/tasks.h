@@ -20,7 +20,10 @@
 
 #include <exception>
 #include <functional>
+#include <map>
 #include <set>
+#include <utility>
+#include <vector>
 
 namespace core::scheduling {
 
@@ -200,8 +203,9 @@ public:
     *
     *
     * @param[in]     TaskItem    subclass of taskItem
+    * @return        stored taskItem (valid until it is deleted)
     */
-    void AddTask(const TaskItem &newTask);
+    const TaskItem &AddTask(const TaskItem &newTask);
 
     /*!
     * \brief DeleteTasks
@@ -216,4 +220,76 @@ public:
     std::multiset<TaskItem> tasks;
 };
 
+using TaskItemRefs = std::vector<std::reference_wrapper<const TaskItem>>;   //!< references to stored tasks
+
+//-----------------------------------------------------------------------------
+/** \brief buckets stored tasks by their next due timestamp
+*   \details A task is due at every timestamp t with (t - delay) % cycletime == 0,
+*           tasks with cycletime 0 are due at every timestamp.
+*           Retrieving the due tasks only touches the buckets up to the given
+*           timestamp, so its cost depends on the number of due tasks and not on
+*           the number of stored tasks.
+*           The tasks are referenced, not copied, and have to outlive the schedule.
+*
+*   \ingroup opSimulation
+*/
+//-----------------------------------------------------------------------------
+
+class TaskSchedule
+{
+public:
+    using Schedule = std::pair<int, int>;   //!< cycletime and delay
+
+    /*!
+    * \brief Add
+    *
+    * \details add given task, which is placed into its bucket at the next
+    *          call of GetDueTasks
+    *
+    * @param[in]     task    stored task
+    */
+    void Add(const TaskItem &task);
+
+    /*!
+    * \brief Remove
+    *
+    * \details remove all tasks of given agent (before they are deleted from storage)
+    *
+    * @param[in]     agentId    id of removed agent
+    */
+    void Remove(int agentId);
+
+    /*!
+    * \brief GetDueTasks
+    *
+    * \details appends all tasks due at given timestamp in order of the task
+    *          multiset (see TaskItem::operator<, then order of adding) and moves
+    *          them into the bucket of their next due timestamp.
+    *          Timestamps have to be passed in ascending order. Tasks of skipped
+    *          timestamps are moved on without being returned.
+    *
+    * @param[in]     timestamp    current timestamp
+    * @param[out]    dueTasks     tasks due at timestamp
+    */
+    void GetDueTasks(int timestamp, TaskItemRefs &dueTasks);
+
+    //! Returns the number of contained tasks by schedule (cycletime and delay)
+    const std::map<Schedule, size_t> &GetSchedules() const;
+
+private:
+    struct Entry
+    {
+        const TaskItem *task;
+        size_t sequenceNumber;   //!< order of adding, keeps equivalent tasks in order
+    };
+
+    void Place(const Entry &entry, int timestamp, std::vector<Entry> &dueEntries);
+
+    std::map<int, std::vector<Entry>> buckets;   //!< tasks by next due timestamp
+    std::vector<Entry> unplacedTasks;            //!< tasks added since the last call of GetDueTasks
+    std::vector<Entry> everyTimestampTasks;      //!< tasks with cycletime 0
+    std::map<Schedule, size_t> schedules;
+    size_t nextSequenceNumber{0};
+};
+
 } // namespace openpass::scheduling
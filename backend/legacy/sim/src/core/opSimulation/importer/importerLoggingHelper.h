@@ -433,10 +433,13 @@ namespace openpass::importer::xml::simulationConfigImporter::tag
     constexpr char experiment[] {"Experiment"};
     constexpr char friction[] {"Friction"};
     constexpr char frictions[] {"Frictions"};
+    constexpr char geometryCacheDirectory[] {"GeometryCacheDirectory"};
     constexpr char homogenities[] {"Homogenities"};
     constexpr char homogenity[] {"Homogenity"};
     constexpr char libraries[] {"Libraries"};
     constexpr char library[] {"Library"};
+    constexpr char numberOfConcurrentInvocations[] {"NumberOfConcurrentInvocations"};
+    constexpr char numberOfThreads[] {"NumberOfThreads"};
     constexpr char observation[] {"Observation"};
     constexpr char observations[] {"Observations"};
     constexpr char parameters[] {"Parameters"};
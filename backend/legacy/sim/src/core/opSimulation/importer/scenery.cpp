@@ -33,6 +33,7 @@ void Scenery::Clear()
     }
 
     roads.clear();
+    contentHash.clear();
 }
 
 RoadInterface *Scenery::AddRoad(const std::string &id)
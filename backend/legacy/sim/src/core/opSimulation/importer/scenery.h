@@ -130,9 +130,42 @@ public:
         return road;
     }
 
+    //-----------------------------------------------------------------------------
+    //! Sets the hash of the content of the file the scenery was imported from.
+    //!
+    //! @param[in]  hash                hex encoded hash
+    //-----------------------------------------------------------------------------
+    void SetContentHash(const std::string& hash)
+    {
+        contentHash = hash;
+    }
+
+    std::string GetContentHash() const
+    {
+        return contentHash;
+    }
+
+    //-----------------------------------------------------------------------------
+    //! Sets the directory, in which the converted road geometry is cached.
+    //!
+    //! @param[in]  directory           cache directory (empty disables the cache)
+    //-----------------------------------------------------------------------------
+    void SetGeometryCacheDirectory(const std::string& directory)
+    {
+        geometryCacheDirectory = directory;
+    }
+
+    std::string GetGeometryCacheDirectory() const
+    {
+        return geometryCacheDirectory;
+    }
+
 private:
     std::map<std::string, RoadInterface*> roads;
 
+    std::string contentHash;
+    std::string geometryCacheDirectory;
+
     std::map<std::string, JunctionInterface*> junctions;
 };
 
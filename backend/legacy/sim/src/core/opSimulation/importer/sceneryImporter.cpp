@@ -18,13 +18,17 @@
 #include <iostream>
 #include <string>
 #include <memory>
+#include <QCryptographicHash>
 #include <QFile>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 
 #include "scenery.h"
 #include "sceneryImporter.h"
 #include "importer/importerCommon.h"
 #include "common/commonTools.h"
 #include "importerLoggingHelper.h"
+#include "common/workStealingThreadPool.h"
 
 using namespace Configuration;
 
@@ -1154,32 +1158,38 @@ void SceneryImporter::ParseRoads(QDomElement& documentRoot,
         RoadInterface* road = scenery->AddRoad(id);
         ThrowIfFalse(road != nullptr, roadElement, "Could not add Road");
 
-        std::string junctionId;
-        if (!SimulationCommon::ParseAttributeString(roadElement, ATTRIBUTE::junction, junctionId))
-        {
-            junctionId = "-1";
-        }
-        road->SetJunctionId(junctionId);
+        ParseRoad(roadElement, road);
 
+        roadElement = roadElement.nextSiblingElement(TAG::road);
+    } // road loop
+}
+
+void SceneryImporter::ParseRoad(QDomElement& roadElement,
+                                RoadInterface* road)
+{
+    std::string junctionId;
+    if (!SimulationCommon::ParseAttributeString(roadElement, ATTRIBUTE::junction, junctionId))
+    {
+        junctionId = "-1";
+    }
+    road->SetJunctionId(junctionId);
 
-        LOG_INTERN(LogLevel::DebugCore) << "road: id: " << id;
 
-        ParseGeometries(roadElement, road);
+    LOG_INTERN(LogLevel::DebugCore) << "road: id: " << road->GetId();
 
-        ParseElevationProfile(roadElement, road);
+    ParseGeometries(roadElement, road);
 
-        ParseRoadLinks(roadElement, road);
+    ParseElevationProfile(roadElement, road);
 
-        ParseRoadLanes(roadElement, road); // parsing laneOffset is included here
+    ParseRoadLinks(roadElement, road);
 
-        ParseObjects(roadElement, road);
+    ParseRoadLanes(roadElement, road); // parsing laneOffset is included here
 
-        ParseSignals(roadElement, road);
+    ParseObjects(roadElement, road);
 
-        ParseRoadTypes(roadElement, road);
+    ParseSignals(roadElement, road);
 
-        roadElement = roadElement.nextSiblingElement(TAG::road);
-    } // road loop
+    ParseRoadTypes(roadElement, road);
 }
 
 void SceneryImporter::ParseJunctions(QDomElement& documentRoot, Scenery* scenery)
@@ -1190,31 +1200,228 @@ void SceneryImporter::ParseJunctions(QDomElement& documentRoot, Scenery* scenery
     {
         while (!junctionElement.isNull())
         {
-            std::string id;
-            ThrowIfFalse(SimulationCommon::ParseAttributeString(junctionElement, ATTRIBUTE::id, id),
-                         junctionElement, "Attribute " + std::string(ATTRIBUTE::id) + " is missing.");
+            ParseJunction(junctionElement, scenery);
 
-            JunctionInterface* junction = scenery->AddJunction(id);
+            junctionElement = junctionElement.nextSiblingElement(TAG::junction);
+        }
+    }
+}
+
+void SceneryImporter::ParseJunction(QDomElement& junctionElement, Scenery* scenery)
+{
+    std::string id;
+    ThrowIfFalse(SimulationCommon::ParseAttributeString(junctionElement, ATTRIBUTE::id, id),
+                 junctionElement, "Attribute " + std::string(ATTRIBUTE::id) + " is missing.");
 
-            ParseJunctionConnections(junctionElement, junction);
-            ParseJunctionPriorities(junctionElement, junction);
+    JunctionInterface* junction = scenery->AddJunction(id);
 
-            junctionElement = junctionElement.nextSiblingElement(TAG::junction);
+    ParseJunctionConnections(junctionElement, junction);
+    ParseJunctionPriorities(junctionElement, junction);
+}
+
+namespace {
+
+//! Size of the chunks read from the OpenDRIVE file
+constexpr qint64 CHUNK_SIZE = 4 * 1024 * 1024;
+
+//! Roads are parsed as soon as the collected road elements exceed this size (in bytes)
+constexpr int ROAD_BATCH_SIZE = 32 * 1024 * 1024;
+
+//! Number of jobs per thread a batch of roads is split into (for load balancing)
+constexpr size_t JOBS_PER_THREAD = 4;
+
+//! Returns the DOM of a single element, which has been copied from the stream
+QDomElement ParseElement(const QByteArray& element, QDomDocument& document)
+{
+    QString errorMsg {};
+    int errorLine {};
+    ThrowIfFalse(document.setContent(element, &errorMsg, &errorLine),
+                 "Invalid xml format in line " + std::to_string(errorLine) + " of element: " + errorMsg.toStdString());
+
+    return document.documentElement();
+}
+
+//! Road element, which has been read but not parsed yet
+struct PendingRoad
+{
+    RoadInterface* road;
+    QByteArray element;
+};
+
+//! Parses the collected roads (concurrently, if a thread pool is given)
+void ParseRoadBatch(std::vector<PendingRoad>& roads, core::WorkStealingThreadPool* threadPool)
+{
+    const auto parseRoads = [&roads](size_t begin, size_t end) {
+        for (size_t index = begin; index < end; ++index)
+        {
+            QDomDocument document;
+            QDomElement roadElement = ParseElement(roads[index].element, document);
+            SceneryImporter::ParseRoad(roadElement, roads[index].road);
+        }
+        return true;
+    };
+
+    if (threadPool == nullptr || roads.size() < 2)
+    {
+        parseRoads(0, roads.size());
+    }
+    else
+    {
+        const size_t numberOfJobs = std::min(roads.size(), threadPool->GetNumberOfThreads() * JOBS_PER_THREAD);
+        std::vector<core::WorkStealingThreadPool::Job> jobs;
+        jobs.reserve(numberOfJobs);
+
+        for (size_t job = 0; job < numberOfJobs; ++job)
+        {
+            const size_t begin = roads.size() * job / numberOfJobs;
+            const size_t end = roads.size() * (job + 1) / numberOfJobs;
+            jobs.emplace_back([parseRoads, begin, end] { return parseRoads(begin, end); });
         }
+
+        threadPool->Execute(std::move(jobs));
     }
+
+    roads.clear();
 }
 
+//! Reads the OpenDRIVE file token by token and copies each road and junction
+//! element into a separate buffer, which is parsed as DOM
+class SceneryStreamParser
+{
+public:
+    SceneryStreamParser(Scenery* scenery, core::WorkStealingThreadPool* threadPool) :
+        scenery{scenery},
+        threadPool{threadPool}
+    {}
+
+    //! Processes all complete tokens, which have been added to the reader
+    //!
+    //! Returns at the end of the document or when the reader needs more data
+    //! (PrematureEndOfDocumentError) or has an error.
+    void ParseTokens(QXmlStreamReader& reader)
+    {
+        for (auto token = reader.readNext(); token != QXmlStreamReader::Invalid; token = reader.readNext())
+        {
+            if (token == QXmlStreamReader::StartElement)
+            {
+                ++depth;
+                hasRootElement = true;
+
+                if (depth == 2 && (reader.name() == QLatin1String(TAG::road) || reader.name() == QLatin1String(TAG::junction)))
+                {
+                    StartElement(reader);
+                }
+            }
+
+            if (writer)
+            {
+                writer->writeCurrentToken(reader);
+            }
+
+            if (token == QXmlStreamReader::EndElement)
+            {
+                if (depth == 2 && writer)
+                {
+                    FinishElement();
+                }
+
+                --depth;
+            }
+
+            if (token == QXmlStreamReader::EndDocument)
+            {
+                return;
+            }
+        }
+    }
+
+    //! Parses the remaining roads
+    void Finish()
+    {
+        ParseRoadBatch(pendingRoads, threadPool);
+    }
+
+    bool HasRootElement() const
+    {
+        return hasRootElement;
+    }
+
+    bool HasRoads() const
+    {
+        return !scenery->GetRoads().empty();
+    }
+
+private:
+    void StartElement(const QXmlStreamReader& reader)
+    {
+        ThrowIfFalse(reader.attributes().hasAttribute(QLatin1String(ATTRIBUTE::id)),
+                     "Attribute " + std::string(ATTRIBUTE::id) + " is missing in line " + std::to_string(reader.lineNumber()) + ".");
+
+        isRoad = reader.name() == QLatin1String(TAG::road);
+        id = reader.attributes().value(QLatin1String(ATTRIBUTE::id)).toString().toStdString();
+
+        element.clear();
+        writer = std::make_unique<QXmlStreamWriter>(&element);
+    }
+
+    void FinishElement()
+    {
+        writer.reset();
+
+        if (isRoad)
+        {
+            RoadInterface* road = scenery->AddRoad(id);
+            ThrowIfFalse(road != nullptr, "Could not add Road " + id);
+
+            pendingBatchSize += element.size();
+            pendingRoads.push_back({road, std::move(element)});
+
+            if (pendingBatchSize >= ROAD_BATCH_SIZE)
+            {
+                ParseRoadBatch(pendingRoads, threadPool);
+                pendingBatchSize = 0;
+            }
+        }
+        else
+        {
+            QDomDocument document;
+            QDomElement junctionElement = ParseElement(element, document);
+            SceneryImporter::ParseJunction(junctionElement, scenery);
+        }
+
+        element = QByteArray{};
+    }
+
+    Scenery* scenery;
+    core::WorkStealingThreadPool* threadPool;
+
+    int depth{0};
+    bool hasRootElement{false};
+
+    std::unique_ptr<QXmlStreamWriter> writer;    //!< copies the tokens of the current road or junction (if any)
+    QByteArray element;
+    bool isRoad{false};
+    std::string id;
+
+    std::vector<PendingRoad> pendingRoads;
+    int pendingBatchSize{0};
+};
+
+} // namespace
+
 //-----------------------------------------------------------------------------
 //! Imports a scenery from a given file
 //!
 //!
 //! @param[in]  filename            DOM element containing e.g. OPENDrive road
 //! @param[out] globalObjects       Target container for the scenery data
+//! @param[in]  numberOfThreads     Number of threads parsing roads
 //!
 //! @return                         False if an error occurred, true otherwise
 //-----------------------------------------------------------------------------
 bool SceneryImporter::Import(const std::string& filename,
-                             Scenery* scenery)
+                             Scenery* scenery,
+                             int numberOfThreads)
 {
     try
     {
@@ -1224,24 +1431,39 @@ bool SceneryImporter::Import(const std::string& filename,
         ThrowIfFalse(xmlFile.open(QIODevice::ReadOnly),
                      "an error occurred during scenery import");
 
-        QByteArray xmlData(xmlFile.readAll());
-        QDomDocument document;
-        QString errorMsg {};
-        int errorLine {};
-        ThrowIfFalse(document.setContent(xmlData, &errorMsg, &errorLine),
-                     "Invalid xml file format of file " + filename + " in line " + std::to_string(errorLine) + " : " + errorMsg.toStdString());
+        std::unique_ptr<core::WorkStealingThreadPool> threadPool;
+        if (numberOfThreads > 1)
+        {
+            threadPool = std::make_unique<core::WorkStealingThreadPool>(static_cast<size_t>(numberOfThreads - 1));
+        }
+
+        QCryptographicHash contentHash{QCryptographicHash::Sha256};
+        QXmlStreamReader reader;
+        SceneryStreamParser parser{scenery, threadPool.get()};
+
+        do
+        {
+            const QByteArray chunk = xmlFile.read(CHUNK_SIZE);
+            contentHash.addData(chunk);
+            reader.addData(chunk);
+
+            parser.ParseTokens(reader);
+            ThrowIfFalse(!reader.hasError() || reader.error() == QXmlStreamReader::PrematureEndOfDocumentError,
+                         "Invalid xml file format of file " + filename + " in line " + std::to_string(reader.lineNumber()) + " : " + reader.errorString().toStdString());
+        } while (!xmlFile.atEnd());
 
-        QDomElement documentRoot = document.documentElement();
-        if (documentRoot.isNull())
+        if (!parser.HasRootElement())
         {
             return false;
         }
 
-        // parse junctions
-        ParseJunctions(documentRoot, scenery);
+        ThrowIfFalse(!reader.hasError(),
+                     "Invalid xml file format of file " + filename + " in line " + std::to_string(reader.lineNumber()) + " : " + reader.errorString().toStdString());
+
+        parser.Finish();
+        ThrowIfFalse(parser.HasRoads(), "Tag " + std::string(TAG::road) + " is missing.");
 
-        // parse roads
-        ParseRoads(documentRoot, scenery);
+        scenery->SetContentHash(contentHash.result().toHex().toStdString());
 
         return true;
     }
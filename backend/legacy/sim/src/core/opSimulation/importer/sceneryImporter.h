@@ -75,11 +75,19 @@ public:
     //-----------------------------------------------------------------------------
     //! Imports data structures from the scenery configuration file e.g. OpenDrive file
     //!
-    //! @param[in]  filename       path to OpenDrive file
-    //! @return                    true on success
+    //! The file is read as stream. Only the road or junction currently parsed is held
+    //! as DOM, so the memory needed does not depend on the size of the file.
+    //! Roads are collected in batches, which are parsed concurrently, if more
+    //! than one thread is given.
+    //!
+    //! @param[in]  filename        path to OpenDrive file
+    //! @param[out] scenery         Target container for the scenery data
+    //! @param[in]  numberOfThreads number of threads parsing roads
+    //! @return                     true on success
     //-----------------------------------------------------------------------------
     static bool Import(const std::string &filename,
-                       Scenery *scenery);
+                       Scenery *scenery,
+                       int numberOfThreads = 1);
 
     //-----------------------------------------------------------------------------
     //! @brief Parses roads into a scenery object.
@@ -95,6 +103,17 @@ public:
     static void ParseRoads(QDomElement &documentRoot,
                            Scenery *scenery);
 
+    //-----------------------------------------------------------------------------
+    //! @brief Parses the content of a single road element into a road object.
+    //!
+    //! Only modifies the given road, so different roads can be parsed concurrently.
+    //!
+    //! @param[in]  roadElement         DOM element of the OpenDRIVE road
+    //! @param[out] road                Road with the contents of the DOM element
+    //-----------------------------------------------------------------------------
+    static void ParseRoad(QDomElement &roadElement,
+                          RoadInterface *road);
+
     //-----------------------------------------------------------------------------
     //! @brief Parses junctions into a scenery object.
     //! @note  Use this entry point only for testing or within the class context
@@ -106,6 +125,15 @@ public:
     static void ParseJunctions(QDomElement &documentRoot,
                            Scenery *scenery);
 
+    //-----------------------------------------------------------------------------
+    //! @brief Parses a single junction element into a scenery object.
+    //!
+    //! @param[in]  junctionElement     DOM element of the OpenDRIVE junction
+    //! @param[out] scenery             Scenery with the contents of the DOM element
+    //-----------------------------------------------------------------------------
+    static void ParseJunction(QDomElement &junctionElement,
+                              Scenery *scenery);
+
     //-----------------------------------------------------------------------------
     //! @brief Parses connections into a junction object.
     //! @note  Use this entry point only for testing or within the class context
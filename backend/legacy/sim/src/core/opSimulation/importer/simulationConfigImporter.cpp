@@ -72,6 +72,29 @@ void SimulationConfigImporter::ImportExperiment(QDomElement experimentElement,
 
     experimentConfig.randomSeed = static_cast<std::uint32_t>(randomSeed);
 
+    QDomElement numberOfThreadsElement;
+    if (GetFirstChildElement(experimentElement, TAG::numberOfThreads, numberOfThreadsElement))
+    {
+        ThrowIfFalse(ParseInt(experimentElement, TAG::numberOfThreads, experimentConfig.numberOfThreads) &&
+                     experimentConfig.numberOfThreads > 0,
+                     numberOfThreadsElement, "NumberOfThreads not valid.");
+    }
+
+    QDomElement numberOfConcurrentInvocationsElement;
+    if (GetFirstChildElement(experimentElement, TAG::numberOfConcurrentInvocations, numberOfConcurrentInvocationsElement))
+    {
+        ThrowIfFalse(ParseInt(experimentElement, TAG::numberOfConcurrentInvocations, experimentConfig.numberOfConcurrentInvocations) &&
+                     experimentConfig.numberOfConcurrentInvocations > 0,
+                     numberOfConcurrentInvocationsElement, "NumberOfConcurrentInvocations not valid.");
+    }
+
+    QDomElement geometryCacheDirectoryElement;
+    if (GetFirstChildElement(experimentElement, TAG::geometryCacheDirectory, geometryCacheDirectoryElement))
+    {
+        ThrowIfFalse(ParseString(experimentElement, TAG::geometryCacheDirectory, experimentConfig.geometryCacheDirectory),
+                     geometryCacheDirectoryElement, "GeometryCacheDirectory not valid.");
+    }
+
     experimentConfig.libraries = ImportLibraries(experimentElement);
 
     simulationConfig.SetExperimentConfig(experimentConfig);
@@ -26,6 +26,7 @@
 #include "include/stochasticsInterface.h"
 #include "include/agentInterface.h"
 #include "include/componentInterface.h"
+#include "common/poolAllocated.h"
 
 class DataBufferWriteInterface;
 class AgentBlueprintInterface;
@@ -40,7 +41,7 @@ class SpawnPoint;
 class ObservationNetworkInterface;
 class SpawnItemParameter;
 
-class Agent
+class Agent : public PoolAllocated<Agent>
 {
 public:
     Agent(WorldInterface *world, const AgentBlueprintInterface& agentBlueprint);
@@ -23,6 +23,7 @@
 #include <cstddef>
 #include "include/modelInterface.h"
 #include "include/componentInterface.h"
+#include "common/poolAllocated.h"
 
 namespace core
 {
@@ -30,7 +31,7 @@ namespace core
 class Agent;
 class ChannelBuffer;
 
-class Channel
+class Channel : public PoolAllocated<Channel>
 {
 public:
     // index within tuple to identify (link/component pair) of channel targets
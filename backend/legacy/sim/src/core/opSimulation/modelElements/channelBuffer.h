@@ -19,11 +19,12 @@
 #include <memory>
 #include "include/modelInterface.h"
 #include "common/log.h"
+#include "common/poolAllocated.h"
 
 namespace core
 {
 
-class ChannelBuffer
+class ChannelBuffer : public PoolAllocated<ChannelBuffer>
 {
 public:
     ChannelBuffer(int id) :
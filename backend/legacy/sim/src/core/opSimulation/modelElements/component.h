@@ -22,6 +22,7 @@
 #include "include/modelInterface.h"
 #include "include/observationInterface.h"
 #include "include/publisherInterface.h"
+#include "common/poolAllocated.h"
 
 namespace core {
 
@@ -31,7 +32,7 @@ class Agent;
 class ChannelBuffer;
 class ObservationModule;
 
-class Component : public ComponentInterface
+class Component : public ComponentInterface, public PoolAllocated<Component>
 {
 public:
     Component(std::string name,
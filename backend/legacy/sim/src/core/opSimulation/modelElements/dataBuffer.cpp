@@ -38,16 +38,19 @@ bool DataBuffer::isInstantiated() const
 
 void DataBuffer::PutCyclic(const EntityId agentId, const Key &key, const Value &value)
 {
+    std::lock_guard<std::mutex> lock(putMutex);
     return implementation->PutCyclic(agentId, key, value);
 }
 
 void DataBuffer::PutAcyclic(const EntityId agentId, const Key &key, const Acyclic &acyclic)
 {
+    std::lock_guard<std::mutex> lock(putMutex);
     return implementation->PutAcyclic(agentId, key, acyclic);
 }
 
 void DataBuffer::PutStatic(const Key &key, const Value &value, bool persist)
 {
+    std::lock_guard<std::mutex> lock(putMutex);
     return implementation->PutStatic(key, value, persist);
 }
 
@@ -66,6 +69,11 @@ std::unique_ptr<CyclicResultInterface> DataBuffer::GetCyclic(const std::optional
     return implementation->GetCyclic(entityId, key);
 }
 
+std::unique_ptr<CyclicResultInterface> DataBuffer::GetCyclics(const std::optional<openpass::type::EntityId> entityId, const KeySelection &selection) const
+{
+    return implementation->GetCyclics(entityId, selection);
+}
+
 std::unique_ptr<AcyclicResultInterface> DataBuffer::GetAcyclic(const std::optional<openpass::type::EntityId> entityId, const Key &key) const
 {
     return implementation->GetAcyclic(entityId, key);
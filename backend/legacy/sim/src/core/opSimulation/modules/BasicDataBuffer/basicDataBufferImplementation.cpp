@@ -14,7 +14,9 @@
 
 #include "basicDataBufferImplementation.h"
 
+#include <algorithm>
 #include <memory>
+#include <set>
 #include <utility>
 
 #include "common/commonTools.h"
@@ -55,6 +57,67 @@ static bool TokensMatch(const Tokens& matcher, const Tokens& reference)
     return true;
 }
 
+KeyId KeyRegistry::Intern(const Key &key)
+{
+    const auto [it, inserted] = ids.try_emplace(key, keys.size());
+
+    if (inserted)
+    {
+        keys.push_back(key);
+        tokens.push_back(CommonHelper::TokenizeString(key, SEPARATOR));
+    }
+
+    return it->second;
+}
+
+const Tokens &KeyRegistry::GetTokens(KeyId keyId) const
+{
+    return tokens.at(keyId);
+}
+
+size_t KeyRegistry::size() const
+{
+    return keys.size();
+}
+
+const std::vector<KeyId> &KeyRegistry::Match(const Key &key) const
+{
+    auto [it, inserted] = queryMatches.try_emplace(key);
+    auto &queryMatch = it->second;
+
+    if (inserted)
+    {
+        queryMatch.tokens = CommonHelper::TokenizeString(key, SEPARATOR);
+    }
+
+    // only keys interned since the last query need to be checked
+    for (; queryMatch.checkedKeys < tokens.size(); ++queryMatch.checkedKeys)
+    {
+        if (TokensMatch(queryMatch.tokens, tokens[queryMatch.checkedKeys]))
+        {
+            queryMatch.keyIds.push_back(queryMatch.checkedKeys);
+        }
+    }
+
+    return queryMatch.keyIds;
+}
+
+const std::vector<KeyId> &KeyRegistry::Match(const KeySelection &selection) const
+{
+    auto &selectionMatch = selectionMatches[selection.GetSignature()];
+
+    // only keys interned since the last query need to be checked
+    for (; selectionMatch.checkedKeys < keys.size(); ++selectionMatch.checkedKeys)
+    {
+        if (selection.Matches(keys[selectionMatch.checkedKeys]))
+        {
+            selectionMatch.keyIds.push_back(selectionMatch.checkedKeys);
+        }
+    }
+
+    return selectionMatch.keyIds;
+}
+
 CyclicResult::CyclicResult(const CyclicStore& store, const CyclicRowRefs& elements) :
     store{store},
     elements{elements}
@@ -112,49 +175,96 @@ BasicDataBufferImplementation::BasicDataBufferImplementation(const openpass::com
 {
 }
 
-template <>
-std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetIndexed<EntityId>(const std::optional<EntityId> entityId, const Tokens &tokens) const
+template <typename ColumnAccessor>
+std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetColumns(const std::vector<KeyId> &keyIds, ColumnAccessor &&getColumn) const
 {
+    RowIndices rowIndices;
+
+    for (const auto keyId : keyIds)
+    {
+        if (const RowIndices *column = getColumn(keyId))
+        {
+            rowIndices.insert(rowIndices.end(), column->cbegin(), column->cend());
+        }
+    }
+
+    if (keyIds.size() > 1)
+    {
+        // restore order of insertion across several keys
+        std::sort(rowIndices.begin(), rowIndices.end());
+    }
+
     CyclicRowRefs rowRefs;
+    rowRefs.reserve(rowIndices.size());
+
+    for (const auto rowIndex : rowIndices)
+    {
+        rowRefs.emplace_back(cyclicStore[rowIndex]);
+    }
 
-    auto range = entityIdIndex.equal_range(entityId.value());
+    return std::make_unique<CyclicResult>(cyclicStore, rowRefs);
+}
 
-    for (auto it = range.first; it != range.second; ++it)
+std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetIndexed(const EntityId entityId, const Key &key) const
+{
+    if (key == WILDCARD)
     {
-        const auto& storeValue = cyclicStore.at(it->second);
+        CyclicRowRefs rowRefs;
+        const auto rowIndices = entityIdIndex.find(entityId);
 
-        if (TokensMatch(tokens, storeValue.tokens))
+        if (rowIndices != entityIdIndex.cend())
         {
-            rowRefs.emplace_back(storeValue);
+            rowRefs.reserve(rowIndices->second.size());
+
+            for (const auto rowIndex : rowIndices->second)
+            {
+                rowRefs.emplace_back(cyclicStore[rowIndex]);
+            }
         }
+
+        return std::make_unique<CyclicResult>(cyclicStore, rowRefs);
     }
 
-    return std::make_unique<CyclicResult>(cyclicStore, rowRefs);
+    return GetMatched(entityId, keyRegistry.Match(key));
 }
 
-std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetCyclic(const Key& key) const
+std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetMatched(const std::optional<EntityId> entityId, const std::vector<KeyId> &keyIds) const
 {
-    const Tokens tokens = CommonHelper::TokenizeString(key, SEPARATOR);
-    CyclicRowRefs rowRefs;
+    if (entityId.has_value())
+    {
+        return GetColumns(keyIds, [this, entityId](KeyId keyId) -> const RowIndices* {
+            const auto& entityColumns = keyEntityIndex[keyId];
+            const auto column = entityColumns.find(entityId.value());
+            return column != entityColumns.cend() ? &column->second : nullptr;
+        });
+    }
+
+    return GetColumns(keyIds, [this](KeyId keyId) -> const RowIndices* {
+        return &keyIndex[keyId];
+    });
+}
 
-    for (const auto& storeValue : cyclicStore)
+std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetCyclic(const Key& key) const
+{
+    if (key == WILDCARD)
     {
-        if (TokensMatch(tokens, storeValue.tokens))
-        {
-            rowRefs.emplace_back(storeValue);
-        }
+        CyclicRowRefs rowRefs{cyclicStore.cbegin(), cyclicStore.cend()};
+        return std::make_unique<CyclicResult>(cyclicStore, rowRefs);
     }
 
-    return std::make_unique<CyclicResult>(cyclicStore, rowRefs);
+    return GetMatched(std::nullopt, keyRegistry.Match(key));
 }
 
-std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetCyclic(const std::optional<EntityId> entityId, const Key &key) const
+std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetCyclics(const std::optional<EntityId> entityId, const KeySelection &selection) const
 {
-    const Tokens tokens = CommonHelper::TokenizeString(key, SEPARATOR);
+    return GetMatched(entityId, keyRegistry.Match(selection));
+}
 
+std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetCyclic(const std::optional<EntityId> entityId, const Key &key) const
+{
     if (entityId.has_value())
     {
-        return GetIndexed<EntityId>(entityId, tokens);
+        return GetIndexed(entityId.value(), key);
     }
     else
     {
@@ -164,10 +274,20 @@ std::unique_ptr<CyclicResultInterface> BasicDataBufferImplementation::GetCyclic(
 
 void BasicDataBufferImplementation::PutCyclic(const EntityId agentId, const Key &key, const Value &value)
 {
+    const KeyId keyId = keyRegistry.Intern(key);
+
+    if (keyId >= keyIndex.size())
+    {
+        keyIndex.resize(keyId + 1);
+        keyEntityIndex.resize(keyId + 1);
+    }
+
     cyclicStore.emplace_back(agentId, key, value);
 
     size_t newValueIndex = cyclicStore.size() - 1;
-    entityIdIndex.emplace(agentId, newValueIndex);
+    entityIdIndex[agentId].push_back(newValueIndex);
+    keyIndex[keyId].push_back(newValueIndex);
+    keyEntityIndex[keyId][agentId].push_back(newValueIndex);
 }
 
 void BasicDataBufferImplementation::PutAcyclic(const EntityId entityId, const Key &key, const Acyclic &acyclic)
@@ -187,6 +307,11 @@ void BasicDataBufferImplementation::ClearRun()
 {
     ClearTimeStep();
 
+    for (auto& entityColumns : keyEntityIndex)
+    {
+        entityColumns.clear();
+    }
+
     auto it = staticStore.begin();
 
     while (it != staticStore.end())
@@ -207,6 +332,20 @@ void BasicDataBufferImplementation::ClearTimeStep()
     cyclicStore.clear();
     entityIdIndex.clear();
     acyclicStore.clear();
+
+    // keep the columns (and their capacity) for the next timestep
+    for (auto& column : keyIndex)
+    {
+        column.clear();
+    }
+
+    for (auto& entityColumns : keyEntityIndex)
+    {
+        for (auto& [entityId, column] : entityColumns)
+        {
+            column.clear();
+        }
+    }
 }
 
 std::unique_ptr<AcyclicResultInterface> BasicDataBufferImplementation::GetAcyclic(const Key& key) const
@@ -266,16 +405,22 @@ Keys BasicDataBufferImplementation::GetKeys(const Key &key) const
     {
         if (tokens.size() == 1)
         {
-            Keys keys;
-            EntityId lastEntityId{-1};
+            std::vector<EntityId> entityIds;
+            entityIds.reserve(entityIdIndex.size());
+
+            for (const auto& [entityId, rowIndices] : entityIdIndex)
+            {
+                entityIds.push_back(entityId);
+            }
 
-            auto it = entityIdIndex.cbegin();
+            std::sort(entityIds.begin(), entityIds.end());
 
-            while (it != entityIdIndex.cend())
+            Keys keys;
+            keys.reserve(entityIds.size());
+
+            for (const auto entityId : entityIds)
             {
-                lastEntityId = std::get<0>(it->first);
-                keys.push_back(std::to_string(lastEntityId));
-                it = entityIdIndex.upper_bound(lastEntityId);
+                keys.push_back(std::to_string(entityId));
             }
 
             return keys;
@@ -283,20 +428,26 @@ Keys BasicDataBufferImplementation::GetKeys(const Key &key) const
         else
         {
             std::set<Key> result;
-            Tokens searchKeyTokens{tokens.cbegin() + 2, tokens.cend()};
-
-            const auto entries = GetIndexed<EntityId>(std::stod(tokens.at(1)), searchKeyTokens);
+            const Tokens searchKeyTokens{tokens.cbegin() + 2, tokens.cend()};
+            const EntityId entityId = std::stod(tokens.at(1));
 
-            for (const auto& entry : *entries)
+            for (KeyId keyId = 0; keyId < keyRegistry.size(); ++keyId)
             {
-                const auto& row = entry.get();
+                const auto& keyTokens = keyRegistry.GetTokens(keyId);
+
+                if (keyTokens.size() <= searchKeyTokens.size() ||
+                    !std::equal(searchKeyTokens.cbegin(), searchKeyTokens.cend(), keyTokens.cbegin()))   // match given tokens against currently processed key
+                {
+                    continue;
+                }
 
-                size_t tokenCount = searchKeyTokens.size();
+                const auto& entityColumns = keyEntityIndex[keyId];
+                const auto column = entityColumns.find(entityId);
 
-                if (searchKeyTokens == Tokens{row.tokens.cbegin(), std::next(row.tokens.cbegin(), static_cast<ssize_t>(tokenCount))})   // match given tokens against currently processed store entry
+                if (column != entityColumns.cend() && !column->second.empty())
                 {
                     // retrieve the token following the last matched one
-                    result.insert(row.tokens.at(searchKeyTokens.size()));
+                    result.insert(keyTokens.at(searchKeyTokens.size()));
                 }
             }
 
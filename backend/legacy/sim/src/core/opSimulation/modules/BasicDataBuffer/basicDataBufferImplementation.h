@@ -17,6 +17,7 @@
 #pragma once
 
 #include <map>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -32,8 +33,82 @@ using StaticStore = std::unordered_map<Key, std::tuple<Value, Persistence>>;
 using CyclicStore = std::vector<CyclicRow>;
 using AcyclicStore = std::vector<AcyclicRow>;
 
-template <typename... Ts>
-using StoreIndex = std::multimap<std::tuple<Ts...>, size_t>;
+using KeyId = size_t;                                                           //!< Dense id of an interned key
+using RowIndices = std::vector<size_t>;                                         //!< Indices into the cyclic store (in order of insertion)
+//! Hash of entity ids for unordered indices
+struct EntityIdHash
+{
+    size_t operator()(const openpass::type::EntityId &entityId) const noexcept
+    {
+        return std::hash<decltype(entityId.value)>{}(entityId.value);
+    }
+};
+
+using EntityIndex = std::unordered_map<openpass::type::EntityId, RowIndices, EntityIdHash>;   //!< Rows of each entity
+
+/*!
+ * \brief Interns databuffer keys
+ *
+ * Each key is mapped to a dense id and tokenized only once, when it is published for the first time.
+ * The keys matched by a query are cached, so that repeated queries do not need to tokenize and compare keys again.
+ */
+class KeyRegistry
+{
+public:
+    /*!
+     * \brief Retrieves the id of a key, registering it if it is unknown
+     *
+     * \param[in]   key   Key to intern
+     *
+     * \return Dense id of the key
+     */
+    KeyId Intern(const Key &key);
+
+    //! \brief Returns the tokenized key of the given id
+    const Tokens &GetTokens(KeyId keyId) const;
+
+    //! \brief Returns the number of interned keys
+    size_t size() const;
+
+    /*!
+     * \brief Retrieves the ids of all interned keys matching the query key
+     *
+     * See TokensMatch for the matching rules. The result is cached per query key and
+     * only extended by keys interned after the previous call.
+     *
+     * \param[in]   key   Query key (may contain wildcards)
+     *
+     * \return Ids of the matching keys (ascending)
+     */
+    const std::vector<KeyId> &Match(const Key &key) const;
+
+    /*!
+     * \brief Retrieves the ids of all interned keys selected by the key selection
+     *
+     * The result is cached per selection (see KeySelection::GetSignature) and
+     * only extended by keys interned after the previous call.
+     *
+     * \param[in]   selection   Selected keys
+     *
+     * \return Ids of the selected keys (ascending)
+     */
+    const std::vector<KeyId> &Match(const KeySelection &selection) const;
+
+private:
+    //! Matched keys of a query and the number of interned keys already checked
+    struct QueryMatch
+    {
+        Tokens tokens;
+        size_t checkedKeys{0};
+        std::vector<KeyId> keyIds;
+    };
+
+    std::unordered_map<Key, KeyId> ids;
+    std::vector<Key> keys;
+    std::vector<Tokens> tokens;
+    mutable std::unordered_map<Key, QueryMatch> queryMatches;
+    mutable std::unordered_map<std::string, QueryMatch> selectionMatches;   //!< Matched keys by selection signature (tokens unused)
+};
 
 class CyclicResult : public CyclicResultInterface
 {
@@ -72,6 +147,10 @@ private:
  *
  * Data is stored in a simple mapping usign the timestamp and agent id as keys,
  * values are stored as key/value pairs.
+ *
+ * Cyclic keys are interned at publish time. Besides the rows in order of insertion,
+ * the row indices are stored in columns per key and per key and entity, so that queries
+ * only visit the rows of the matching keys.
  */
 class BasicDataBufferImplementation : public DataBufferInterface
 {
@@ -97,6 +176,8 @@ public:
 
     std::unique_ptr<CyclicResultInterface> GetCyclic(const std::optional<openpass::type::EntityId> entityId, const Key &key) const override;
 
+    std::unique_ptr<CyclicResultInterface> GetCyclics(const std::optional<openpass::type::EntityId> entityId, const KeySelection &selection) const override;
+
     std::unique_ptr<AcyclicResultInterface> GetAcyclic(const std::optional<openpass::type::EntityId> entityId, const Key &key) const override;
 
     Values GetStatic(const Key &key) const override;
@@ -108,11 +189,20 @@ protected:
     CyclicStore cyclicStore;     //!< Container for DataBuffer cyclic values
     AcyclicStore acyclicStore;   //!< Container for DataBuffer acyclic values
 
-    StoreIndex<openpass::type::EntityId> entityIdIndex;                                     //!< Index for entity id based cyclics access
+    KeyRegistry keyRegistry;                     //!< Interned cyclic keys (kept between timesteps and runs)
+    EntityIndex entityIdIndex;                   //!< Index for entity id based cyclics access
+    std::vector<RowIndices> keyIndex;            //!< Rows of each key (indexed by KeyId)
+    std::vector<EntityIndex> keyEntityIndex;     //!< Rows of each key and entity (indexed by KeyId)
 
 private:
-    template <typename... Ts>
-    std::unique_ptr<CyclicResultInterface> GetIndexed(const std::optional<openpass::type::EntityId> entityId, const Tokens &tokens) const;
+    //! Collects the rows of the given columns in order of insertion
+    template <typename ColumnAccessor>
+    std::unique_ptr<CyclicResultInterface> GetColumns(const std::vector<KeyId> &keyIds, ColumnAccessor &&getColumn) const;
+
+    std::unique_ptr<CyclicResultInterface> GetIndexed(const openpass::type::EntityId entityId, const Key &key) const;
+
+    //! Collects the rows of the given keys (of the given entity, if set)
+    std::unique_ptr<CyclicResultInterface> GetMatched(const std::optional<openpass::type::EntityId> entityId, const std::vector<KeyId> &keyIds) const;
 
     std::unique_ptr<CyclicResultInterface> GetCyclic(const Key& key) const;
     std::unique_ptr<AcyclicResultInterface> GetAcyclic(const Key& key) const;
@@ -15,6 +15,10 @@
 
 #include "CollisionDetector.h"
 
+#include <algorithm>
+
+#include <boost/iterator/function_output_iterator.hpp>
+
 #include "include/agentInterface.h"
 #include "include/trafficObjectInterface.h"
 #include "include/worldObjectInterface.h"
@@ -38,16 +42,42 @@ CollisionDetector::CollisionDetector(WorldInterface *world,
 
 void CollisionDetector::Trigger(int time)
 {
-    // accumulate collisions
-    auto agents = world->GetAgents();
-    for (auto it = agents.cbegin(); it != agents.cend(); ++it)
+    if (!trafficObjectTreeValid)
+    {
+        BuildTrafficObjectTree();
+    }
+
+    const auto agentMap = world->GetAgents();
+    std::vector<AgentInterface *> agents;
+    std::vector<BoxedObject> agentBoxes;
+    agents.reserve(agentMap.size());
+    agentBoxes.reserve(agentMap.size());
+
+    for (const auto &[id, agent] : agentMap)
     {
-        AgentInterface *agent = it->second;
         assert(agent != nullptr);
 
-        for (auto otherIt = std::next(it); otherIt != agents.cend(); ++otherIt)
+        // agents without bounding box cannot collide
+        if (!agent->GetBoundingBox2D().outer().empty())
+        {
+            agentBoxes.emplace_back(bg::return_envelope<box_t>(agent->GetBoundingBox2D()), agents.size());
+            agents.push_back(agent);
+        }
+    }
+
+    // agents move, so their tree is rebuilt every cycle (packing construction)
+    const BoxTree agentTree(agentBoxes.cbegin(), agentBoxes.cend());
+
+    // accumulate collisions
+    for (size_t agentIndex = 0; agentIndex < agents.size(); ++agentIndex)
+    {
+        AgentInterface *agent = agents[agentIndex];
+        const auto &agentBox = agentBoxes[agentIndex].first;
+
+        // only agents after the current one, so that every pair is checked once
+        for (const auto otherIndex : GetCandidates(agentTree, agentBox, agentIndex + 1))
         {
-            AgentInterface *other = otherIt->second;
+            AgentInterface *other = agents[otherIndex];
             if (!DetectCollision(other, agent))
             {
                 continue;
@@ -60,14 +90,9 @@ void CollisionDetector::Trigger(int time)
         }
 
         // second loop to avoid comparing traffic objects with traffic objects
-        for (auto trafficObjectIt = trafficObjects->begin(); trafficObjectIt != trafficObjects->end(); ++trafficObjectIt)
+        for (const auto trafficObjectIndex : GetCandidates(trafficObjectTree, agentBox))
         {
-            const TrafficObjectInterface *otherObject = *trafficObjectIt;
-            if (!otherObject)
-            {
-                LOG(CbkLogLevel::Warning, "collision detection aborted");
-                throw std::runtime_error("Invalid other worldObject. Collision detection cancled.");
-            }
+            const TrafficObjectInterface *otherObject = trafficObjects->at(trafficObjectIndex);
             if (!DetectCollision(otherObject, agent))
             {
                 continue;
@@ -80,6 +105,48 @@ void CollisionDetector::Trigger(int time)
     }
 }
 
+void CollisionDetector::Reset()
+{
+    trafficObjectTree.clear();
+    trafficObjectTreeValid = false;
+}
+
+void CollisionDetector::BuildTrafficObjectTree()
+{
+    std::vector<BoxedObject> trafficObjectBoxes;
+    trafficObjectBoxes.reserve(trafficObjects->size());
+
+    for (size_t trafficObjectIndex = 0; trafficObjectIndex < trafficObjects->size(); ++trafficObjectIndex)
+    {
+        const TrafficObjectInterface *trafficObject = trafficObjects->at(trafficObjectIndex);
+        if (!trafficObject)
+        {
+            LOG(CbkLogLevel::Warning, "collision detection aborted");
+            throw std::runtime_error("Invalid other worldObject. Collision detection cancled.");
+        }
+        if (!trafficObject->GetBoundingBox2D().outer().empty())
+        {
+            trafficObjectBoxes.emplace_back(bg::return_envelope<box_t>(trafficObject->GetBoundingBox2D()), trafficObjectIndex);
+        }
+    }
+
+    trafficObjectTree = BoxTree(trafficObjectBoxes.cbegin(), trafficObjectBoxes.cend());
+    trafficObjectTreeValid = true;
+}
+
+std::vector<size_t> CollisionDetector::GetCandidates(const BoxTree &tree, const box_t &box, size_t firstIndex)
+{
+    std::vector<size_t> candidates;
+
+    tree.query(boost::geometry::index::intersects(box) &&
+               boost::geometry::index::satisfies([firstIndex](const BoxedObject &object) { return object.second >= firstIndex; }),
+               boost::make_function_output_iterator([&candidates](const BoxedObject &object) { candidates.push_back(object.second); }));
+
+    // collision events are created in the same order as without broad phase
+    std::sort(candidates.begin(), candidates.end());
+    return candidates;
+}
+
 template <typename T>
 bool IsInVector(const std::vector<T> &v, T element)
 {
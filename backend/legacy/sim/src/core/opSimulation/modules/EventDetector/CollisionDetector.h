@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include "EventDetectorCommonBase.h"
 
 #include "common/boostGeometryCommon.h"
@@ -93,6 +95,13 @@ public:
     */
     virtual void Trigger(int time);
 
+    /*!
+    * \brief Resets the initial state of the CollisionDetector.
+    *
+    * \details The spatial index of the traffic objects is rebuilt in the next cycle.
+    */
+    void Reset() override;
+
     //-----------------------------------------------------------------------------
     /*! Check For Collision between worldObjects
     *
@@ -107,6 +116,32 @@ public:
     const std::vector<const TrafficObjectInterface*> *trafficObjects = nullptr;
 
 private:
+    //! Axis aligned bounding box of a world object and the index of the object in its list
+    using BoxedObject = std::pair<box_t, size_t>;
+    using BoxTree = boost::geometry::index::rtree<BoxedObject, boost::geometry::index::quadratic<16>>;
+
+    //-----------------------------------------------------------------------------
+    /*! Inserts the axis aligned bounding boxes of all traffic objects into trafficObjectTree
+    *
+    * @throws std::runtime_error if a traffic object is invalid */
+    //-----------------------------------------------------------------------------
+    void BuildTrafficObjectTree();
+
+    //-----------------------------------------------------------------------------
+    /*! Broad phase: returns the indices of all objects in the tree, whose axis aligned bounding box
+    *   intersects (or touches) the given box. Only these objects can collide with the owner of the box.
+    *
+    * @param[in]  tree           spatial index of the objects
+    * @param[in]  box            axis aligned bounding box
+    * @param[in]  firstIndex     smallest index to return
+    *
+    * @return                    indices in ascending order */
+    //-----------------------------------------------------------------------------
+    static std::vector<size_t> GetCandidates(const BoxTree &tree, const box_t &box, size_t firstIndex = 0);
+
+    BoxTree trafficObjectTree;              //!< traffic objects do not move, so the tree is built once per run
+    bool trafficObjectTreeValid {false};
+
     //-----------------------------------------------------------------------------
     /*! Creates a CollisionEvent and inserts it into the event network
     *
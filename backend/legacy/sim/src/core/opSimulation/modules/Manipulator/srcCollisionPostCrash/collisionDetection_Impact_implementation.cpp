@@ -8,9 +8,12 @@
  * SPDX-License-Identifier: EPL-2.0
  ********************************************************************************/
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <limits>
 #include <array>
+#include <utility>
 
 #include "collisionDetection_Impact_implementation.h"
 #include "components/common/vehicleProperties.h"
@@ -26,6 +29,49 @@ typedef enum {
     NumberCorners
 } CornerType;
 
+//! Vertices closer than this to the contact plane belong to the touching feature [m]
+constexpr double CONTACT_FEATURE_TOLERANCE = 1E-6;
+
+//! Touching feature (vertex or edge) of a polygon at the first contact
+struct ContactFeature
+{
+    double position;    //!< position of the feature along the contact normal
+    double tangentMin;  //!< start of the feature along the contact plane
+    double tangentMax;  //!< end of the feature along the contact plane
+};
+
+std::pair<double, double> Project(const std::vector<Common::Vector2d> &corners, const Common::Vector2d &axis)
+{
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    for (const auto &corner : corners) {
+        const double projection = axis.Dot(corner);
+        min = std::min(min, projection);
+        max = std::max(max, projection);
+    }
+    return {min, max};
+}
+
+ContactFeature GetContactFeature(const std::vector<Common::Vector2d> &corners, const Common::Vector2d &shift,
+                                 const Common::Vector2d &axis, bool lowerSide)
+{
+    const Common::Vector2d tangent(-axis.y, axis.x);
+    const auto [min, max] = Project(corners, axis);
+
+    ContactFeature feature{(lowerSide ? min : max) + axis.Dot(shift),
+                           std::numeric_limits<double>::infinity(),
+                           -std::numeric_limits<double>::infinity()};
+
+    for (const auto &corner : corners) {
+        if (std::abs(axis.Dot(corner) - (lowerSide ? min : max)) < CONTACT_FEATURE_TOLERANCE) {
+            const double position = tangent.Dot(corner + shift);
+            feature.tangentMin = std::min(feature.tangentMin, position);
+            feature.tangentMax = std::max(feature.tangentMax, position);
+        }
+    }
+    return feature;
+}
+
 } // namespace
 
 CollisionDetectionPostCrash::~CollisionDetectionPostCrash()
@@ -388,18 +434,97 @@ bool CollisionDetectionPostCrash::GetIntersectionPoint(Common::Vector2d n1,
 }
 
 bool CollisionDetectionPostCrash::GetFirstContact(const AgentInterface *agent1,
-                                                         const AgentInterface *agent2,
-                                                         int &timeFirstContact)
+                                                  const AgentInterface *agent2,
+                                                  FirstContact &firstContact)
 {
-    std::vector<Common::Vector2d> agent1Corners = GetAgentCorners(agent1);
-    std::vector<Common::Vector2d> agent2Corners = GetAgentCorners(agent2);
+    return CalculateFirstContact(GetAgentCorners(agent1), GetAgentCorners(agent2),
+                                 GetAgentVelocityVector(agent1), GetAgentVelocityVector(agent2),
+                                 firstContact);
+}
+
+bool CollisionDetectionPostCrash::CalculateFirstContact(const std::vector<Common::Vector2d> &corners1,
+                                                        const std::vector<Common::Vector2d> &corners2,
+                                                        const Common::Vector2d &velocity1,
+                                                        const Common::Vector2d &velocity2,
+                                                        FirstContact &firstContact)
+{
+    const Common::Vector2d relativeVelocity = velocity2 - velocity1;
+
+    // Check if velocities are nearly same. If true, time of first contact will be very high
+    // (infinity if velocities are exactly the same)
+    if (relativeVelocity.Length() < 1E-5) {
+        return false;
+    }
+
+    double timeEnter = -std::numeric_limits<double>::infinity();
+    double timeExit = std::numeric_limits<double>::infinity();
+    Common::Vector2d contactAxis;
+    bool approachFromBelow = false; // second polygon approaches the first one from lower projections on the contact axis
+
+    for (const auto *corners : {&corners1, &corners2}) {
+        for (size_t i = 0; i < corners->size(); ++i) {
+            const Common::Vector2d &start = (*corners)[i];
+            const Common::Vector2d &end = (*corners)[(i + 1) % corners->size()];
+
+            Common::Vector2d axis(end.y - start.y, -(end.x - start.x));
+            if (!axis.Norm()) {
+                continue;
+            }
+
+            const auto [min1, max1] = Project(corners1, axis);
+            const auto [min2, max2] = Project(corners2, axis);
+            const double approachVelocity = axis.Dot(relativeVelocity);
+
+            if (std::abs(approachVelocity) < std::numeric_limits<double>::epsilon()) {
+                if (min2 > max1 || min1 > max2) {
+                    // separated on this axis at any time
+                    return false;
+                }
+                continue;
+            }
 
-    Polygon agent1Polygon(agent1Corners);
+            // the projections overlap while min2 + approachVelocity * t <= max1 and min1 <= max2 + approachVelocity * t
+            const double timeUpperTouch = (max1 - min2) / approachVelocity;
+            const double timeLowerTouch = (min1 - max2) / approachVelocity;
+            const double axisEnter = std::min(timeUpperTouch, timeLowerTouch);
+            const double axisExit = std::max(timeUpperTouch, timeLowerTouch);
 
-    Polygon agent2Polygon(agent2Corners);
+            if (axisEnter > timeEnter) {
+                timeEnter = axisEnter;
+                contactAxis = axis;
+                approachFromBelow = approachVelocity > 0;
+            }
+            timeExit = std::min(timeExit, axisExit);
+        }
+    }
 
-    Common::Vector2d agent1VelocityVector = GetAgentVelocityVector(agent1);
-    Common::Vector2d agent2VelocityVector = GetAgentVelocityVector(agent2);
+    if (std::isinf(timeEnter) || timeEnter > 0 || timeEnter > timeExit) {
+        return false;
+    }
+
+    // the touching features lie on opposite sides of the contact plane
+    const ContactFeature feature1 = GetContactFeature(corners1, velocity1 * timeEnter, contactAxis, approachFromBelow);
+    const ContactFeature feature2 = GetContactFeature(corners2, velocity2 * timeEnter, contactAxis, !approachFromBelow);
+
+    const Common::Vector2d tangent(-contactAxis.y, contactAxis.x);
+    const double normalPosition = (feature1.position + feature2.position) / 2;
+    const double tangentPosition = (std::max(feature1.tangentMin, feature2.tangentMin) +
+                                    std::min(feature1.tangentMax, feature2.tangentMax)) / 2;
+
+    firstContact.time = timeEnter;
+    firstContact.point = contactAxis * normalPosition + tangent * tangentPosition;
+
+    return true;
+}
+
+bool CollisionDetectionPostCrash::CalculateFirstContactIterative(const std::vector<Common::Vector2d> &corners1,
+                                                                 const std::vector<Common::Vector2d> &corners2,
+                                                                 const Common::Vector2d &velocity1,
+                                                                 const Common::Vector2d &velocity2,
+                                                                 int &timeFirstContact)
+{
+    Polygon polygon1(corners1);
+    Polygon polygon2(corners2);
 
     int cycleTime = 100;       // assumption
 
@@ -408,7 +533,7 @@ bool CollisionDetectionPostCrash::GetFirstContact(const AgentInterface *agent1,
 
     // Check if velocities are nearly same. If true, time of first contact will be very high
     // (infinity if velocities are exactly the same)
-    if ((agent1VelocityVector - agent2VelocityVector).Length() < 1E-5) {
+    if ((velocity1 - velocity2).Length() < 1E-5) {
         return false;
     }
 
@@ -417,9 +542,9 @@ bool CollisionDetectionPostCrash::GetFirstContact(const AgentInterface *agent1,
     while (intersected) {
         timeFirstContact = lastTimeNoContact;
         lastTimeNoContact -= cycleTime; // one cycleTime to the past --> negative
-        intersected = ShiftPolygonsAndCheckIntersection(agent1Polygon, agent2Polygon,
-                                                        agent1VelocityVector * (static_cast<double>(lastTimeNoContact) / 1000),
-                                                        agent2VelocityVector * (static_cast<double>(lastTimeNoContact) / 1000));
+        intersected = ShiftPolygonsAndCheckIntersection(polygon1, polygon2,
+                                                        velocity1 * (static_cast<double>(lastTimeNoContact) / 1000),
+                                                        velocity2 * (static_cast<double>(lastTimeNoContact) / 1000));
     }
 
     bool everIntersected = false;
@@ -427,9 +552,9 @@ bool CollisionDetectionPostCrash::GetFirstContact(const AgentInterface *agent1,
     while (std::abs(timeFirstContact - lastTimeNoContact) > 1) {
         int nextTime = lastTimeNoContact - (lastTimeNoContact - timeFirstContact) / 2;
 
-        intersected = ShiftPolygonsAndCheckIntersection(agent1Polygon, agent2Polygon,
-                                                        agent1VelocityVector * (static_cast<double>(nextTime) / 1000),
-                                                        agent2VelocityVector * (static_cast<double>(nextTime) / 1000));
+        intersected = ShiftPolygonsAndCheckIntersection(polygon1, polygon2,
+                                                        velocity1 * (static_cast<double>(nextTime) / 1000),
+                                                        velocity2 * (static_cast<double>(nextTime) / 1000));
 
         if (intersected) {
             timeFirstContact = nextTime;
@@ -513,14 +638,14 @@ bool CollisionDetectionPostCrash::ShiftPolygonsAndCheckIntersection(Polygon poly
 
 void CollisionDetectionPostCrash::CalculateCollisionAngles(const AgentInterface *agent1,
                                                            const AgentInterface *agent2,
-                                                           int timeShift)
+                                                           const FirstContact &firstContact)
 {
     std::vector<Common::Vector2d> agentCorners1 = GetAgentCorners(agent1);
     std::vector<Common::Vector2d> agentCorners2 = GetAgentCorners(agent2);
     Polygon polygon1(agentCorners1);
     Polygon polygon2(agentCorners2);
-    polygon1.Translate(GetAgentVelocityVector(agent1) * (static_cast<double>(timeShift) / 1000));
-    polygon2.Translate(GetAgentVelocityVector(agent2) * (static_cast<double>(timeShift) / 1000));
+    polygon1.Translate(GetAgentVelocityVector(agent1) * firstContact.time);
+    polygon2.Translate(GetAgentVelocityVector(agent2) * firstContact.time);
 
     Common::Vector2d centroid1;
     Common::Vector2d centroid2;
@@ -528,11 +653,7 @@ void CollisionDetectionPostCrash::CalculateCollisionAngles(const AgentInterface
     polygon1.CalculateCentroid(centroid1);
     polygon2.CalculateCentroid(centroid2);
 
-    std::vector<Common::Vector2d> intersectionPoints = CalculateAllIntersectionPoints(polygon1.GetVertices(), polygon2.GetVertices());
-    Polygon intersectionPolygon(intersectionPoints);
-
-    Common::Vector2d FPOC; // first point of contact
-    intersectionPolygon.CalculateCentroid(FPOC);
+    const Common::Vector2d &FPOC = firstContact.point; // first point of contact
 
     double hostYaw = agent1->GetYaw();
     double oppYaw = agent2->GetYaw();
@@ -589,11 +710,14 @@ bool CollisionDetectionPostCrash::CreatePostCrashDynamics(const AgentInterface *
                                                           int &timeOfFirstContact)
 {
     timeOfFirstContact = 0;
-    if (!GetFirstContact(agent1, agent2, timeOfFirstContact)) {
+    FirstContact firstContact;
+    if (!GetFirstContact(agent1, agent2, firstContact)) {
         return false;
     }
-    //
-    CalculateCollisionAngles(agent1, agent2, timeOfFirstContact);
+    // first full millisecond at which the agents intersect
+    timeOfFirstContact = static_cast<int>(std::ceil(firstContact.time * 1000 - 1E-6));
+
+    CalculateCollisionAngles(agent1, agent2, firstContact);
 
     Common::Vector2d resultAgent1COG = Common::Vector2d(-1, -1);
     Common::Vector2d resultAgent2COG = Common::Vector2d(-1, -1);
@@ -113,6 +113,60 @@ public:
      */
     void SetCollisionAngles(double OYA, double HCPAo, double OCPAo, double HCPA, double OCPA);
 
+    //! First contact of two agents
+    struct FirstContact
+    {
+        double time;             //!< time of first contact relative to the current time [s], negative since in the past
+        Common::Vector2d point;  //!< first point of contact
+    };
+
+    /*!
+     * \brief calculates first contact of two moving convex polygons
+     * Swept separating axis test: For each edge normal of both polygons the projections of the
+     * polygons move linearly in time, so the time interval in which the projections overlap
+     * can be calculated directly. The polygons overlap in the intersection of these intervals,
+     * which starts at the time of first contact. The axis of the latest entry is the normal of
+     * the contact plane. The first point of contact is the center of the touching features
+     * (vertex or edge) of both polygons on this axis, which is the limit of the centroid of the
+     * intersection polygon at the time of first contact.
+     *
+     * The time is given relative to the time of the given corners.
+     *
+     * \param[in] corners1               corners of first polygon
+     * \param[in] corners2               corners of second polygon
+     * \param[in] velocity1              velocity of first polygon
+     * \param[in] velocity2              velocity of second polygon
+     * \param[out] firstContact          first contact of the polygons
+     * \return                           false, if the polygons do not touch at or before the time of the corners
+     */
+    bool CalculateFirstContact(const std::vector<Common::Vector2d> &corners1,
+                               const std::vector<Common::Vector2d> &corners2,
+                               const Common::Vector2d &velocity1,
+                               const Common::Vector2d &velocity2,
+                               FirstContact &firstContact);
+
+    /*!
+     * \brief calculates time of first contact of two moving polygons iteratively
+     * The time of the first contact is estimated by stepping back in time in steps of 100 ms
+     * until the polygons do not intersect anymore and bisecting the last step down to 1 ms
+     * afterwards. This is the reference for validating CalculateFirstContact.
+     *
+     * The time is given relative to the time of the given corners. The time at this timestep
+     * is 0, so the time in the past will be negative.
+     *
+     * \param[in] corners1               corners of first polygon
+     * \param[in] corners2               corners of second polygon
+     * \param[in] velocity1              velocity of first polygon
+     * \param[in] velocity2              velocity of second polygon
+     * \param[out] timeFirstContact      time of first contact --> negative since in the past [ms]
+     * \return                           flag indicating if calculation could be done correctly
+     */
+    bool CalculateFirstContactIterative(const std::vector<Common::Vector2d> &corners1,
+                                        const std::vector<Common::Vector2d> &corners2,
+                                        const Common::Vector2d &velocity1,
+                                        const Common::Vector2d &velocity2,
+                                        int &timeFirstContact);
+
 protected:
     /*!
      * \brief logs messages
@@ -180,36 +234,32 @@ private:
                               Common::Vector2d &intersectionPoint);
 
     /*!
-     * \brief calculates time of first constact
-     * The time of the first contact of two colliding agents is estimated.
+     * \brief calculates time and point of first contact
+     * The first contact of two colliding agents is calculated by CalculateFirstContact.
      * It is assumed that the velocity vectors between the time of first contact and
      * the current time (where a collision has been detected) are constant.
      * Yaw velocities are not taken into account since they are not provided by openPASS currently.
      *
-     * The time is given relative to the current time. The time at this timestep is 0, so the
-     * time in the past will be negative.
-     *
      * \param[in] agent1                 first agent to consider
      * \param[in] agent2                 other agent to consider
-     * \param[out] firstTimeContact      time of first contact --> negative since in the past [ms]
+     * \param[out] firstContact          first contact of the agents
      * \return                           flag indicating if calculation could be done correctly
      */
     bool GetFirstContact(const AgentInterface *agent1, const AgentInterface *agent2,
-                               int &timeFirstContact);
+                         FirstContact &firstContact);
 
     /*!
      * \brief calculates collision angles
-     * The time of the first contact of two colliding agents is used to calculate the
-     * first point of contact. Based on this first point of contact, the collision angles
-     * are calculated.
+     * The collision angles are calculated from the first point of contact and the
+     * centroids of both agents at the time of first contact.
      *
      * \param[in] agent1                 first agent to consider
      * \param[in] agent2                 other agent to consider
-     * \param[in] firstTimeContact       time of first contact --> negative since in the past [ms]
+     * \param[in] firstContact           first contact of the agents
      */
     void CalculateCollisionAngles(const AgentInterface *agent1,
                                   const AgentInterface *agent2,
-                                  int timeFirstContact);
+                                  const FirstContact &firstContact);
 
     /*!
      * \brief Calculates contact plane of two colliding agents
@@ -327,7 +377,7 @@ private:
                               double &phi,
                               int timeFirstContact);
 
-    const CallbackInterface *callbacks;
+    const CallbackInterface *callbacks = nullptr;
 
     /** \name Internal Parameter
      *  Parameters for model of post-crash dynamics
@@ -72,6 +72,11 @@ ObservationEntityRepositoryImplementation::ObservationEntityRepositoryImplementa
 
 void ObservationEntityRepositoryImplementation::OpSimulationPreHook()
 {
+    // runs are numbered by their invocation, also if only a part of the invocations is executed
+    const auto firstInvocation = dataBuffer->GetStatic("FirstInvocation");
+    firstRunNumber = firstInvocation.empty() ? 0 : std::get<int>(firstInvocation.front());
+    runNumber = firstRunNumber;
+
     QDirIterator it(directory, QStringList() << filenamePrefix + "_*.csv", QDir::Files, QDirIterator::NoIteratorFlags);
     while (it.hasNext())
     {
@@ -93,7 +98,7 @@ void ObservationEntityRepositoryImplementation::OpSimulationPostRunHook(const Ru
     LOGDEBUG("Getting non-persistent entities");
     const auto non_persistent = GetEntities(NON_PERSISTENT_ENTITIES);
 
-    if (writePersitent && runNumber == 0)
+    if (writePersitent && runNumber == firstRunNumber)
     {
         LOGDEBUG("Getting persistent entities");
         persistentEntities = GetEntities(PERSISTENT_ENTITIES);
@@ -130,7 +135,7 @@ void ObservationEntityRepositoryImplementation::OpSimulationPostRunHook(const Ru
     {
         if (persistentInSeparateFile)
         {
-            if (runNumber == 0)
+            if (runNumber == firstRunNumber)
             {
                 LOGDEBUG("Writing persistent entities (once only)");
                 QString filename = filenamePrefix + "_Persistent.csv";
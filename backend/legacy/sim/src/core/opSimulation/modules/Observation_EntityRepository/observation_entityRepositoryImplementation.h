@@ -168,6 +168,7 @@ private:
 
     DataBufferReadInterface *dataBuffer;
     int runNumber = 0;
+    int firstRunNumber = 0;     //!< number of the first run (first executed invocation)
     QString directory;
     QString filenamePrefix{"Repository"};
     bool writePersitent{true};
@@ -0,0 +1,280 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \file  ObservationColumnarCyclics.cpp */
+//-----------------------------------------------------------------------------
+
+#include "observationColumnarCyclics.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <QByteArray>
+
+namespace {
+
+using Column = ObservationCyclics::Column;
+
+//! Columns of a cyclic key by entity id
+using EntityColumns = std::map<int, const Column *>;
+
+//! Row of the long table (index of the timestep, entity id)
+struct Row
+{
+    size_t timeStepIndex;
+    int entityId;
+};
+
+template <typename T>
+constexpr char TypeCode()
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        return '?';
+    }
+    else if constexpr (std::is_same_v<T, char>)
+    {
+        return 'b';
+    }
+    else if constexpr (std::is_same_v<T, int>)
+    {
+        return 'i';
+    }
+    else if constexpr (std::is_same_v<T, size_t>)
+    {
+        return 'Q';
+    }
+    else if constexpr (std::is_same_v<T, float>)
+    {
+        return 'f';
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        return 'd';
+    }
+    else
+    {
+        return 's';
+    }
+}
+
+//! Appends the value as little endian
+template <typename T>
+void Append(std::string &buffer, T value)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        Append(buffer, bits);
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        Append(buffer, bits);
+    }
+    else
+    {
+        const auto bits = static_cast<std::make_unsigned_t<T>>(value);
+        for (size_t byte = 0; byte < sizeof(T); ++byte)
+        {
+            buffer.push_back(static_cast<char>((bits >> (8 * byte)) & 0xFF));
+        }
+    }
+}
+
+void Append(std::string &buffer, bool value)
+{
+    buffer.push_back(value ? 1 : 0);
+}
+
+void Append(std::string &buffer, const std::string &value)
+{
+    Append(buffer, static_cast<uint32_t>(value.size()));
+    buffer.append(value);
+}
+
+//! Returns the type code of the key (string, if the entities have samples of different types)
+char GetTypeCode(const EntityColumns &entityColumns)
+{
+    const auto &firstSamples = entityColumns.cbegin()->second->GetSamples();
+
+    for (const auto &[entityId, column] : entityColumns)
+    {
+        if (column->GetSamples().index() != firstSamples.index())
+        {
+            return TypeCode<std::string>();
+        }
+    }
+
+    return std::visit([](const auto &samples) {
+        return TypeCode<typename std::decay_t<decltype(samples)>::value_type>();
+    }, firstSamples);
+}
+
+//! Returns the sample of the row, converted into T (default value, if there is no sample)
+template <typename T>
+T GetValue(const EntityColumns &entityColumns, const Row &row)
+{
+    const auto column = entityColumns.find(row.entityId);
+
+    if (column == entityColumns.cend() || !column->second->IsSet(row.timeStepIndex))
+    {
+        return T{};
+    }
+
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        return column->second->Get(row.timeStepIndex);
+    }
+    else
+    {
+        return std::get<std::vector<T>>(column->second->GetSamples())[row.timeStepIndex - column->second->GetFirstTimeStepIndex()];
+    }
+}
+
+template <typename T>
+std::string CreatePayload(const EntityColumns &entityColumns, const std::vector<Row> &rows)
+{
+    std::string payload;
+
+    for (const auto &row : rows)
+    {
+        const auto column = entityColumns.find(row.entityId);
+        Append(payload, column != entityColumns.cend() && column->second->IsSet(row.timeStepIndex));
+    }
+
+    for (const auto &row : rows)
+    {
+        Append(payload, GetValue<T>(entityColumns, row));
+    }
+
+    return payload;
+}
+
+std::string CreatePayload(const EntityColumns &entityColumns, const std::vector<Row> &rows, char typeCode)
+{
+    switch (typeCode)
+    {
+    case TypeCode<bool>():
+        return CreatePayload<bool>(entityColumns, rows);
+    case TypeCode<char>():
+        return CreatePayload<char>(entityColumns, rows);
+    case TypeCode<int>():
+        return CreatePayload<int>(entityColumns, rows);
+    case TypeCode<size_t>():
+        return CreatePayload<size_t>(entityColumns, rows);
+    case TypeCode<float>():
+        return CreatePayload<float>(entityColumns, rows);
+    case TypeCode<double>():
+        return CreatePayload<double>(entityColumns, rows);
+    default:
+        return CreatePayload<std::string>(entityColumns, rows);
+    }
+}
+
+void WriteColumn(std::ofstream &file, const std::string &name, char typeCode, const std::string &payload)
+{
+    // QByteArray (and the uncompressed size stored by qCompress) cannot hold 2 GiB or more
+    if (payload.size() > static_cast<size_t>(std::numeric_limits<int>::max()))
+    {
+        throw std::runtime_error("ObservationColumnarCyclics cannot compress column " + name + " of " +
+                                 std::to_string(payload.size()) + " bytes (limit: 2 GiB)");
+    }
+
+    const QByteArray compressedPayload = qCompress(QByteArray::fromRawData(payload.data(), static_cast<int>(payload.size())));
+    if (compressedPayload.isEmpty())
+    {
+        throw std::runtime_error("ObservationColumnarCyclics could not compress column " + name);
+    }
+
+    std::string header;
+    Append(header, name);
+    header.push_back(typeCode);
+    Append(header, static_cast<uint64_t>(compressedPayload.size()));
+
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    file.write(compressedPayload.constData(), compressedPayload.size());
+}
+
+} // namespace
+
+void ObservationColumnarCyclics::Write(const std::string &filepath, const ObservationCyclics &cyclics)
+{
+    std::map<std::string, EntityColumns> columnsByKey;
+    std::map<int, std::vector<const Column *>> columnsByEntity;
+
+    for (const auto &[prefixedKey, column] : cyclics.GetColumns())
+    {
+        const auto separator = prefixedKey.find(':');
+        const int entityId = std::stoi(prefixedKey.substr(0, separator));
+
+        columnsByKey[prefixedKey.substr(separator + 1)].emplace(entityId, &column);
+        columnsByEntity[entityId].push_back(&column);
+    }
+
+    std::vector<Row> rows;
+    std::vector<int> timeSteps(cyclics.GetTimeSteps().cbegin(), cyclics.GetTimeSteps().cend());
+
+    for (size_t timeStepIndex = 0; timeStepIndex < timeSteps.size(); ++timeStepIndex)
+    {
+        for (const auto &[entityId, columns] : columnsByEntity)
+        {
+            if (std::any_of(columns.cbegin(), columns.cend(), [timeStepIndex](const auto column) { return column->IsSet(timeStepIndex); }))
+            {
+                rows.push_back({timeStepIndex, entityId});
+            }
+        }
+    }
+
+    std::ofstream file{filepath, std::ios::out | std::ios::binary | std::ios::trunc};
+    if (!file.is_open())
+    {
+        throw std::runtime_error("ObservationColumnarCyclics could not create file: " + filepath);
+    }
+
+    std::string header{MAGIC};
+    Append(header, FORMAT_VERSION);
+    Append(header, static_cast<uint32_t>(rows.size()));
+    Append(header, static_cast<uint32_t>(columnsByKey.size() + 2));
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+    std::string timeStepPayload(rows.size(), 1);
+    std::string entityIdPayload(rows.size(), 1);
+    for (const auto &row : rows)
+    {
+        Append(timeStepPayload, timeSteps[row.timeStepIndex]);
+        Append(entityIdPayload, row.entityId);
+    }
+
+    WriteColumn(file, "Timestep", TypeCode<int>(), timeStepPayload);
+    WriteColumn(file, "AgentId", TypeCode<int>(), entityIdPayload);
+
+    for (const auto &[key, entityColumns] : columnsByKey)
+    {
+        const auto typeCode = GetTypeCode(entityColumns);
+        WriteColumn(file, key, typeCode, CreatePayload(entityColumns, rows, typeCode));
+    }
+
+    file.close();
+
+    if (!file)
+    {
+        throw std::runtime_error("ObservationColumnarCyclics could not write file: " + filepath);
+    }
+}
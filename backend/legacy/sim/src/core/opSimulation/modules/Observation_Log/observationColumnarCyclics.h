@@ -0,0 +1,55 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "observationCyclics.h"
+
+//!
+//! \brief Writes the cyclics of a run into a compressed, column oriented binary file
+//!
+//! In contrast to the csv output, the table is in long format: one row per timestep and entity,
+//! with the typed columns "Timestep", "AgentId" and one column per cyclic key (without entity prefix).
+//! Rows are ordered by timestep and entity id. Entities without any sample in a timestep have no row.
+//!
+//! All numbers are little endian. The file consists of
+//! - "OPCY", format version (uint32), number of rows (uint32), number of columns (uint32)
+//! - for each column: name length (uint32), name, type code (char), payload size (uint64), payload
+//!
+//! The payload is compressed by qCompress (uncompressed size as big endian uint32 followed by a zlib stream).
+//! Uncompressed, it contains one validity byte per row (0: no sample), followed by the values of all rows
+//! (also rows without sample). Type codes follow the python struct module: '?' bool, 'b' int8, 'i' int32,
+//! 'Q' uint64, 'f' float32, 'd' float64 and 's' string (uint32 length and UTF-8 bytes).
+//! A key with samples of different types (also between entities) is written as string column.
+//!
+//! The format can be read column wise without reading the whole file,
+//! see tests/endToEndTests/pyOpenPASS/cyclics_reader.py
+//!
+class ObservationColumnarCyclics
+{
+public:
+    static constexpr char FILE_EXTENSION[] = "ocyc";
+    static constexpr char MAGIC[] = "OPCY";
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    /*!
+     * \brief Writes the cyclics of a run
+     *
+     * \param[in]    filepath    Path of the output file
+     * \param[in]    cyclics     Cyclics of the run (keys prefixed by entity id, e.g. "01:VelocityEgo")
+     *
+     * \throws std::runtime_error if the file cannot be written or the uncompressed payload
+     *         of a column is 2 GiB or larger
+     */
+    static void Write(const std::string &filepath, const ObservationCyclics &cyclics);
+};
@@ -14,6 +14,117 @@
 
 #include "observationCyclics.h"
 
+#include <type_traits>
+
+#include "common/openPassUtils.h"
+
+#include <algorithm>
+
+//! Maximum number of timesteps reserved at once for a column
+static constexpr size_t RESERVE_CHUNK_SIZE = 1000;
+
+template <typename T>
+static void SetSample(std::vector<T> &values, size_t index, T value, size_t reserveChunkSize)
+{
+    if (index >= values.size())
+    {
+        if (index >= values.capacity() && reserveChunkSize > 0)
+        {
+            values.reserve(index + reserveChunkSize);
+        }
+
+        values.resize(index + 1);
+    }
+
+    values[index] = std::move(value);
+}
+
+ObservationCyclics::Column::Column(const Value &value, size_t firstTimeStepIndex, size_t remainingTimeSteps) :
+    firstTimeStepIndex{firstTimeStepIndex},
+    reserveChunkSize{std::min(remainingTimeSteps, RESERVE_CHUNK_SIZE)}
+{
+    std::visit([this](const auto &firstValue) {
+        using T = std::decay_t<decltype(firstValue)>;
+
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            samples = std::vector<T>{};
+        }
+        else
+        {
+            samples = std::vector<std::string>{};
+        }
+    }, value);
+
+    std::visit([this](auto &values) { values.reserve(reserveChunkSize); }, samples);
+    isSet.reserve(reserveChunkSize);
+}
+
+void ObservationCyclics::Column::Set(size_t timeStepIndex, const Value &value)
+{
+    const size_t index = timeStepIndex - firstTimeStepIndex;
+
+    // the sample is marked after it is stored, so a conversion only reads existing samples
+    std::visit([this, index](const auto &newValue) {
+        using T = std::decay_t<decltype(newValue)>;
+
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            if (auto *values = std::get_if<std::vector<T>>(&samples))
+            {
+                SetSample(*values, index, newValue, reserveChunkSize);
+                return;
+            }
+        }
+
+        ConvertToStrings();
+        SetSample(std::get<std::vector<std::string>>(samples), index, openpass::utils::FlatParameter::to_string()(newValue), reserveChunkSize);
+    }, value);
+
+    SetSample(isSet, index, true, reserveChunkSize);
+}
+
+std::string ObservationCyclics::Column::Get(size_t timeStepIndex) const
+{
+    if (!IsSet(timeStepIndex))
+    {
+        return {};
+    }
+
+    const size_t index = timeStepIndex - firstTimeStepIndex;
+
+    return std::visit([index](const auto &values) -> std::string {
+        if constexpr (std::is_same_v<std::decay_t<decltype(values)>, std::vector<std::string>>)
+        {
+            return values[index];
+        }
+        else
+        {
+            return std::to_string(values[index]);
+        }
+    }, samples);
+}
+
+void ObservationCyclics::Column::ConvertToStrings()
+{
+    if (std::holds_alternative<std::vector<std::string>>(samples))
+    {
+        return;
+    }
+
+    const size_t numberOfSamples = std::visit([](const auto &values) { return values.size(); }, samples);
+
+    std::vector<std::string> formattedSamples;
+    formattedSamples.reserve(std::max(numberOfSamples, isSet.capacity()));
+
+    for (size_t index = 0; index < numberOfSamples; ++index)
+    {
+        formattedSamples.push_back(Get(firstTimeStepIndex + index));
+    }
+
+    samples = std::move(formattedSamples);
+}
+
 std::string ObservationCyclics::GetHeader() const
 {
     std::string header;
@@ -29,28 +140,54 @@ std::string ObservationCyclics::GetHeader() const
     return header;
 }
 
+std::vector<std::string> ObservationCyclics::GetKeys() const
+{
+    std::vector<std::string> keys;
+    keys.reserve(samples.size());
+
+    for (const auto &[key, column] : samples)
+    {
+        keys.push_back(key);
+    }
+
+    return keys;
+}
+
+std::vector<std::string> ObservationCyclics::GetSamples(std::uint32_t timeStepNumber) const
+{
+    std::vector<std::string> sampleValues;
+    sampleValues.reserve(samples.size());
+
+    for (const auto &[key, column] : samples)
+    {
+        sampleValues.push_back(column.Get(timeStepNumber));
+    }
+
+    return sampleValues;
+}
+
 std::string ObservationCyclics::GetSamplesLine(std::uint32_t timeStepNumber) const
 {
     std::string sampleLine;
     for (auto it = samples.begin(); it != samples.end(); ++it)
     {
-        const std::vector<std::string>& values = it->second;
-
         if (it != samples.begin())
         {
             sampleLine += ", ";
         }
 
         // not all channels are sampled until end of simulation time
-        if (timeStepNumber < values.size())
-        {
-            sampleLine += values.at(timeStepNumber);
-        }
+        sampleLine += it->second.Get(timeStepNumber);
     }
 
     return sampleLine;
 }
 
+void ObservationCyclics::Reserve(size_t numberOfTimeSteps)
+{
+    capacity = numberOfTimeSteps;
+}
+
 void ObservationCyclics::Clear()
 {
     timeSteps.clear();
@@ -61,21 +198,17 @@ void ObservationCyclics::Clear()
 //! Called by Observation Log Implementation
 //! to log all Sample values in output.xml
 //-----------------------------------------------------------------------------
-void ObservationCyclics::Insert(int time, const std::string &key, const std::string &value)
+void ObservationCyclics::Insert(int time, const std::string &key, const Value &value)
 {
     timeSteps.insert(timeSteps.end(), time);
+    const size_t timeStepIndex = timeSteps.size() - 1;
 
     auto it = samples.find(key);
 
     if (it == samples.end())
     {
-        auto [newIt, newElement] = samples.emplace(key, timeSteps.size() - 1);
-        newIt->second.push_back(value);
-    }
-    else
-    {
-        // fill up skipped time steps (e.g. another agent has been instantiated in between -> inserted new time step in scheduling)
-        it->second.resize(timeSteps.size() - 1);
-        it->second.push_back(value);
+        it = samples.try_emplace(key, value, timeStepIndex, capacity > timeStepIndex ? capacity - timeStepIndex : 0).first;
     }
+
+    it->second.Set(timeStepIndex, value);
 }
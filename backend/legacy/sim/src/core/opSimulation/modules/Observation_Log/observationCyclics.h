@@ -11,46 +11,76 @@
 
 #pragma once
 
+#include <map>
+#include <set>
 #include <string>
+#include <variant>
+#include <vector>
 
+#include "common/openPassTypes.h"
 #include "include/eventNetworkInterface.h"
 
 //!
 //! \brief The ObservationCyclics stores the samples which are logged by various modules
 //! and written into the cyclics tag of the simulationOutput.xml
 //!
+//! Samples are stored column wise in their native type and are only converted
+//! into strings when the samples are written.
+//!
 class ObservationCyclics
 {
 public:
+    using Value = openpass::type::FlatParameterValue;
+
     ObservationCyclics()
     {
     }
 
     ObservationCyclics(const ObservationCyclics&) = delete;
-    ObservationCyclics(ObservationCyclics&&) = delete;
+    ObservationCyclics(ObservationCyclics&&) = default;
     ObservationCyclics& operator=(const ObservationCyclics&) = delete;
-    ObservationCyclics& operator=(ObservationCyclics&&) = delete;
+    ObservationCyclics& operator=(ObservationCyclics&&) = default;
 
     ~ObservationCyclics() = default;
 
     /*!
     * Inserts a parameter into the samples.
     * If the key does not exist yet, it inserts it into the list of keys
-    * and all previous timesteps are filled with an empty string.
+    * and all previous timesteps are left empty.
     * If the key exists, but some timesteps are missing for this key, then
-    * missing timesteps are filled with an empty string.
+    * missing timesteps are left empty.
     *
     * @param[in]     time       Timestep in milliseconds.
     * @param[in]     key        Name of parameter as string.
-    * @param[in]     value      Value of parameter as string.
+    * @param[in]     value      Value of parameter.
     */
-    void Insert(int time, const std::string &key, const std::string &value);
+    void Insert(int time, const std::string &key, const Value &value);
+
+    /*!
+     * \brief Sets the expected number of timesteps of a run
+     *
+     * Columns store their samples from the timestep of their first sample on and
+     * reserve at most the remaining timesteps, in chunks of limited size.
+     *
+     * \param[in]    numberOfTimeSteps   Expected number of timesteps of a run
+     */
+    void Reserve(size_t numberOfTimeSteps);
 
     /*!
      * \brief Returns the string header that is written into the simulationOuput.xml
      */
     std::string GetHeader() const;
 
+    /*!
+     * \brief Returns the keys of all columns in the order of the header
+     */
+    std::vector<std::string> GetKeys() const;
+
+    /*!
+     * \brief Returns the formatted samples of all columns for the given timestep in the order of the header
+     */
+    std::vector<std::string> GetSamples(uint32_t timeStepNumber) const;
+
     /*!
      * \brief Returns a single line of samples for the given timestep for writing into the simulationOutput
      */
@@ -69,9 +99,70 @@ public:
      */
     void Clear();
 
+    //!
+    //! \brief Samples of a single column
+    //!
+    //! Scalar values are stored in a vector of their type. Strings and vectors are stored formatted.
+    //! If a column receives a value of another type, all samples of the column are converted into strings.
+    //!
+    class Column
+    {
+    public:
+        using Samples = std::variant<std::vector<bool>,
+                                     std::vector<char>,
+                                     std::vector<int>,
+                                     std::vector<size_t>,
+                                     std::vector<float>,
+                                     std::vector<double>,
+                                     std::vector<std::string>>;
+
+        Column(const Value &value, size_t firstTimeStepIndex, size_t remainingTimeSteps);
+
+        //! Sets the sample of the timestep with the given index
+        void Set(size_t timeStepIndex, const Value &value);
+
+        //! Returns the formatted sample of the timestep with the given index (empty, if there is none)
+        std::string Get(size_t timeStepIndex) const;
+
+        //! Returns true, if there is a sample for the timestep with the given index
+        bool IsSet(size_t timeStepIndex) const
+        {
+            return timeStepIndex >= firstTimeStepIndex &&
+                   timeStepIndex - firstTimeStepIndex < isSet.size() &&
+                   isSet[timeStepIndex - firstTimeStepIndex];
+        }
+
+        //! Returns the index of the timestep of the first sample
+        size_t GetFirstTimeStepIndex() const
+        {
+            return firstTimeStepIndex;
+        }
+
+        //! Returns the samples from the first timestep on (the value of timesteps without sample is undefined)
+        const Samples& GetSamples() const
+        {
+            return samples;
+        }
+
+    private:
+        void ConvertToStrings();
+
+        size_t firstTimeStepIndex;  //!< Index of the timestep of samples[0]
+        size_t reserveChunkSize;    //!< Number of timesteps reserved at once
+        Samples samples;
+        std::vector<bool> isSet;    //!< Marks the timesteps with a sample
+    };
+
+    /*!
+     * \brief Returns the columns of all keys
+     */
+    const std::map<std::string, Column>& GetColumns() const
+    {
+        return samples;
+    }
+
 private:
     std::set<int> timeSteps;
-    std::map<std::string, std::vector<std::string>> samples;
+    std::map<std::string, Column> samples;
+    size_t capacity{0};
 };
-
-
@@ -0,0 +1,215 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+//-----------------------------------------------------------------------------
+/** \file  ObservationCyclicsWriter.cpp */
+//-----------------------------------------------------------------------------
+
+#include "observationCyclicsWriter.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+ObservationCyclicsWriter::ObservationCyclicsWriter() :
+    thread{&ObservationCyclicsWriter::Run, this}
+{
+}
+
+ObservationCyclicsWriter::~ObservationCyclicsWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stop = true;
+    }
+
+    taskAvailable.notify_one();
+    thread.join();
+}
+
+void ObservationCyclicsWriter::StartRun(const std::string &filepath)
+{
+    Enqueue([this, filepath] {
+        this->filepath = filepath;
+        columns.clear();
+        columnIds.clear();
+
+        csvFile.open(filepath, std::ios::out | std::ios::trunc);
+        if (!csvFile.is_open())
+        {
+            throw std::runtime_error(COMPONENTNAME + " could not create file: " + filepath);
+        }
+    });
+}
+
+void ObservationCyclicsWriter::Write(ObservationCyclics &&block)
+{
+    // std::function requires a copyable callable
+    auto sharedBlock = std::make_shared<ObservationCyclics>(std::move(block));
+
+    Enqueue([this, sharedBlock] {
+        AppendBlock(*sharedBlock);
+    });
+}
+
+void ObservationCyclicsWriter::FinishRun()
+{
+    Enqueue([this] {
+        WriteHeader();
+    });
+}
+
+void ObservationCyclicsWriter::Wait()
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    taskFinished.wait(lock, [this] { return tasks.empty() && !busy; });
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void ObservationCyclicsWriter::Enqueue(std::function<void()> task)
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    taskFinished.wait(lock, [this] { return tasks.size() < MAX_PENDING_TASKS || error; });
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+
+    tasks.push_back(std::move(task));
+    lock.unlock();
+
+    taskAvailable.notify_one();
+}
+
+void ObservationCyclicsWriter::Run()
+{
+    while (true)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            taskAvailable.wait(lock, [this] { return stop || !tasks.empty(); });
+
+            if (tasks.empty())
+            {
+                return;
+            }
+
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            busy = true;
+        }
+
+        std::exception_ptr taskError;
+
+        // after an error, the remaining tasks are discarded
+        if (!error)
+        {
+            try
+            {
+                task();
+            }
+            catch (...)
+            {
+                taskError = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            busy = false;
+
+            if (taskError)
+            {
+                error = taskError;
+            }
+        }
+
+        taskFinished.notify_all();
+    }
+}
+
+void ObservationCyclicsWriter::AppendBlock(const ObservationCyclics &block)
+{
+    std::vector<size_t> blockColumnIds;
+    for (const auto &key : block.GetKeys())
+    {
+        const auto [column, inserted] = columnIds.try_emplace(key, columns.size());
+        if (inserted)
+        {
+            columns.push_back(key);
+        }
+        blockColumnIds.push_back(column->second);
+    }
+
+    // columns which appear in later blocks are not contained in the lines of this block
+    std::vector<std::string> line;
+    uint32_t timeStepNumber = 0;
+
+    for (const auto timeStep : block.GetTimeSteps())
+    {
+        line.assign(columns.size(), {});
+
+        auto samples = block.GetSamples(timeStepNumber);
+        for (size_t column = 0; column < samples.size(); ++column)
+        {
+            line[blockColumnIds[column]] = std::move(samples[column]);
+        }
+
+        csvFile << timeStep;
+        for (const auto &sample : line)
+        {
+            csvFile << ", " << sample;
+        }
+        csvFile << '\n';
+
+        ++timeStepNumber;
+    }
+
+    csvFile.flush();
+
+    if (!csvFile)
+    {
+        throw std::runtime_error(COMPONENTNAME + " could not write file: " + filepath);
+    }
+}
+
+void ObservationCyclicsWriter::WriteHeader()
+{
+    csvFile.close();
+
+    if (!csvFile)
+    {
+        throw std::runtime_error(COMPONENTNAME + " could not write file: " + filepath);
+    }
+
+    const std::string headerFilepath = filepath + HEADER_SUFFIX;
+    std::ofstream headerFile{headerFilepath, std::ios::out | std::ios::trunc};
+
+    headerFile << "Timestep";
+    for (const auto &key : columns)
+    {
+        headerFile << ", " << key;
+    }
+    headerFile << '\n';
+
+    headerFile.close();
+
+    if (!headerFile)
+    {
+        throw std::runtime_error(COMPONENTNAME + " could not write file: " + headerFilepath);
+    }
+}
@@ -0,0 +1,107 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "observationCyclics.h"
+
+//!
+//! \brief Writes the cyclics of a run block wise into a csv file from a background thread
+//!
+//! Each block of samples is appended to the csv file of the run, so every sample is written once.
+//! As the columns of a run are only known at its end, the header is written into a separate file
+//! (csv file path + HEADER_SUFFIX) when the run is finished. The columns are ordered by their first
+//! appearance, so the rows written before a column appeared end before it.
+//!
+//! All file operations are executed on the writer thread in the order they are requested.
+//! At most MAX_PENDING_TASKS operations are queued, so that the samples kept in memory are limited.
+//! An error on the writer thread is rethrown on the calling thread by any later call.
+//!
+class ObservationCyclicsWriter
+{
+public:
+    const std::string COMPONENTNAME = "ObservationCyclicsWriter";
+    static constexpr char HEADER_SUFFIX[] = ".header";   //!< Appended to the csv file path for the header file
+
+    ObservationCyclicsWriter();
+    ObservationCyclicsWriter(const ObservationCyclicsWriter&) = delete;
+    ObservationCyclicsWriter(ObservationCyclicsWriter&&) = delete;
+    ObservationCyclicsWriter& operator=(const ObservationCyclicsWriter&) = delete;
+    ObservationCyclicsWriter& operator=(ObservationCyclicsWriter&&) = delete;
+
+    //! Finishes all queued operations and stops the writer thread
+    ~ObservationCyclicsWriter();
+
+    /*!
+     * \brief Starts writing the cyclics of a new run
+     *
+     * \param[in]    filepath    Path of the csv file of the run
+     */
+    void StartRun(const std::string &filepath);
+
+    /*!
+     * \brief Appends a block of samples to the current run
+     *
+     * Blocks the caller while the queue of the writer thread is full.
+     *
+     * \param[in]    block       Samples of consecutive timesteps following the previous block
+     */
+    void Write(ObservationCyclics &&block);
+
+    /*!
+     * \brief Closes the csv file of the current run and writes its header file
+     */
+    void FinishRun();
+
+    /*!
+     * \brief Waits until all queued operations are finished
+     *
+     * \throws std::runtime_error if an operation failed on the writer thread
+     */
+    void Wait();
+
+private:
+    static constexpr size_t MAX_PENDING_TASKS = 2;
+
+    void Enqueue(std::function<void()> task);
+    void Run();
+
+    //! Appends the samples of the block to the csv file (writer thread)
+    void AppendBlock(const ObservationCyclics &block);
+
+    //! Closes the csv file and writes the header file (writer thread)
+    void WriteHeader();
+
+    // state of the writer thread
+    std::string filepath;
+    std::ofstream csvFile;
+    std::vector<std::string> columns;   //!< Keys of the columns in the csv file (order of first appearance)
+    std::map<std::string, size_t> columnIds;   //!< Position of each key in columns
+
+    std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable taskFinished;
+    std::deque<std::function<void()>> tasks;
+    bool busy{false};
+    bool stop{false};
+    std::exception_ptr error;
+    std::thread thread;
+};
@@ -34,7 +34,9 @@ ObservationFileHandler::ObservationFileHandler(const DataBufferReadInterface& da
 
 void ObservationFileHandler::WriteStartOfFile(const std::string& frameworkVersion)
 {
-    runNumber = 0;
+    // runs are numbered by their invocation, also if only a part of the invocations is executed
+    const auto firstInvocation = dataBuffer.GetStatic("FirstInvocation");
+    runNumber = firstInvocation.empty() ? 0 : std::get<int>(firstInvocation.front());
 
     // setup environment
     QDir dir(folder);
@@ -51,7 +53,7 @@ void ObservationFileHandler::WriteStartOfFile(const std::string& frameworkVersio
         QFile::remove(finalPath);
     }
 
-    RemoveCsvCyclics(folder);
+    RemoveCyclicsFiles(folder);
 
     auto fileNameWithoutType = finalFilename.split(".").front();
     xmlFile = std::make_unique<QTemporaryFile>(folder + "/" + fileNameWithoutType + "_XXXXXX.tmp");
@@ -101,19 +103,26 @@ void ObservationFileHandler::WriteRun([[maybe_unused]] const RunResultInterface&
     // write CyclicsTag
     xmlFileStream->writeStartElement(outputTags.CYCLICS);
 
-    QString runPrefix = "";
-    if (runNumber < 10)
+    if (cyclicsWriter)
     {
-        runPrefix = "00";
+        AddReference(GetCyclicsFilename("csv"));
+
+        WriteCyclics(cyclics);
+        cyclicsWriter->FinishRun();
     }
-    else if (runNumber < 100)
+    else if (writeCyclicsToColumnar)
     {
-        runPrefix = "0";
-    }
+        const QString columnarFilename = GetCyclicsFilename(ObservationColumnarCyclics::FILE_EXTENSION);
+
+        AddReference(columnarFilename);
+
+        const QString path = folder + QDir::separator() + columnarFilename;
 
-    if (writeCyclicsToCsv)
+        ObservationColumnarCyclics::Write(path.toStdString(), cyclics);
+    }
+    else if (writeCyclicsToCsv)
     {
-        const QString csvFilename = "Cyclics_Run_" + runPrefix + QString::number(runNumber) + ".csv";
+        const QString csvFilename = GetCyclicsFilename("csv");
 
         AddReference(csvFilename);
 
@@ -136,8 +145,28 @@ void ObservationFileHandler::WriteRun([[maybe_unused]] const RunResultInterface&
     ++runNumber;
 }
 
+void ObservationFileHandler::WriteStartOfRun()
+{
+    if (cyclicsWriter)
+    {
+        const QString path = folder + QDir::separator() + GetCyclicsFilename("csv");
+        cyclicsWriter->StartRun(path.toStdString());
+    }
+}
+
+void ObservationFileHandler::WriteCyclics(ObservationCyclics& cyclics)
+{
+    cyclicsWriter->Write(std::move(cyclics));
+    cyclics.Clear();
+}
+
 void ObservationFileHandler::WriteEndOfFile()
 {
+    if (cyclicsWriter)
+    {
+        cyclicsWriter->Wait();
+    }
+
     // close RunResultsTag
     xmlFileStream->writeEndElement();
 
@@ -311,20 +340,37 @@ void ObservationFileHandler::AddReference(QString filename)
     xmlFileStream->writeEndElement();
 }
 
-void ObservationFileHandler::RemoveCsvCyclics(QString directory)
+void ObservationFileHandler::RemoveCyclicsFiles(QString directory)
 {
-    QDirIterator it(directory, QStringList() << "Cyclics_Run*.csv", QDir::Files, QDirIterator::NoIteratorFlags);
+    const QString columnarSuffix = ObservationColumnarCyclics::FILE_EXTENSION;
+
+    QDirIterator it(directory, QStringList() << "Cyclics_Run*.csv" << "Cyclics_Run*." + columnarSuffix, QDir::Files, QDirIterator::NoIteratorFlags);
     while (it.hasNext())
     {
         it.next();
         QFileInfo fileInfo = it.fileInfo();
-        if (fileInfo.baseName().startsWith("Cyclics_Run_") && fileInfo.suffix() == "csv")
+        if (fileInfo.baseName().startsWith("Cyclics_Run_") && (fileInfo.suffix() == "csv" || fileInfo.suffix() == columnarSuffix))
         {
             QFile::remove(fileInfo.filePath());
         }
     }
 }
 
+QString ObservationFileHandler::GetCyclicsFilename(const QString &extension) const
+{
+    QString runPrefix = "";
+    if (runNumber < 10)
+    {
+        runPrefix = "00";
+    }
+    else if (runNumber < 100)
+    {
+        runPrefix = "0";
+    }
+
+    return "Cyclics_Run_" + runPrefix + QString::number(runNumber) + "." + extension;
+}
+
 void ObservationFileHandler::WriteCsvCyclics(const QString& filepath, const ObservationCyclics &cyclics)
 {
     QFile csvFile{filepath};
@@ -23,7 +23,9 @@
 #include "include/eventNetworkInterface.h"
 #include "include/observationInterface.h"
 #include "include/dataBufferInterface.h"
+#include "observationColumnarCyclics.h"
 #include "observationCyclics.h"
+#include "observationCyclicsWriter.h"
 #include "observationLogConstants.h"
 #include "runStatistic.h"
 
@@ -84,6 +86,42 @@ public:
         writeCyclicsToCsv = writeCsv;
     }
 
+    /*!
+     * \brief Enables writing the cyclics into columnar binary files instead of csv files
+     *
+     * \see ObservationColumnarCyclics
+     */
+    void SetColumnarOutput(bool writeColumnar)
+    {
+        writeCyclicsToColumnar = writeColumnar;
+    }
+
+    /*!
+     * \brief Enables writing the cyclics csv files block wise during the runs
+     *
+     * The header of a streamed csv file is written into a separate header file.
+     * Cyclics written into the xml file cannot be streamed, as they follow the
+     * events and agents of the run, which are only known at its end.
+     *
+     * \see ObservationCyclicsWriter
+     */
+    void SetCsvStreaming()
+    {
+        cyclicsWriter = std::make_unique<ObservationCyclicsWriter>();
+    }
+
+    /*!
+     * \brief Starts the cyclics csv file of the upcoming run, if streaming is enabled
+     */
+    void WriteStartOfRun();
+
+    /*!
+     * \brief Appends the cyclics collected so far to the cyclics csv file of the current run
+     *
+     * \param[in]    cyclics    samples since the last call (moved into the writer)
+     */
+    void WriteCyclics(ObservationCyclics& cyclics);
+
     /*!
      * \brief Creates the output file as simulationOutput.tmp and writes the basic header information
      */
@@ -113,6 +151,7 @@ protected:
     std::string sceneryFile;
 
     bool writeCyclicsToCsv{false};
+    bool writeCyclicsToColumnar{false};
 
     OutputAttributes outputAttributes;
     OutputTags outputTags;
@@ -123,6 +162,7 @@ protected:
     QString tmpPath;
     QString finalPath;
     std::unique_ptr<QTemporaryFile> xmlFile;
+    std::unique_ptr<ObservationCyclicsWriter> cyclicsWriter;   //!< set, if the cyclics are streamed into the csv files
 
     //add infos to the file stream
     /*!
@@ -195,11 +235,18 @@ protected:
     void AddReference(QString filename);
 
     /*!
-    * \brief Removes old cyclic files from directory.
+    * \brief Removes old cyclic files (csv and columnar) from directory.
     *
     * @param[in]    directory           directory to delete the cyclic files
     */
-    void RemoveCsvCyclics(QString directory);
+    void RemoveCyclicsFiles(QString directory);
+
+    /*!
+    * \brief Returns the name of the cyclics file of the current run.
+    *
+    * @param[in]    extension           file extension (without dot)
+    */
+    QString GetCyclicsFilename(const QString &extension) const;
 
     /*!
     * \brief Writes the cyclics of one run to a csv.
@@ -12,6 +12,7 @@
 /** \file  observation_LogImplementation */
 //-----------------------------------------------------------------------------
 
+#include <type_traits>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -71,6 +72,23 @@ void ObservationLogImplementation::OpSimulationPreHook()
         throw std::runtime_error(msg);
     }
 
+    const bool writeColumnar = helper::map::query(GetParameters()->GetParametersBool(), "LoggingCyclicsToColumnar").value_or(false);
+    fileHandler.SetColumnarOutput(writeColumnar);
+
+    const auto chunkSize = helper::map::query(GetParameters()->GetParametersInt(), "LoggingCyclicsChunkSize");
+    if (chunkSize.value_or(0) > 0)
+    {
+        if (GetParameters()->GetParametersBool().at("LoggingCyclicsToCsv") && !writeColumnar)
+        {
+            cyclicsChunkSize = chunkSize.value();
+            fileHandler.SetCsvStreaming();
+        }
+        else
+        {
+            LOG(CbkLogLevel::Warning, "'LoggingCyclicsChunkSize' requires 'LoggingCyclicsToCsv' without 'LoggingCyclicsToColumnar'. Cyclics are written at the end of each run.");
+        }
+    }
+
     std::unordered_map<std::string, std::vector<std::string>> loggingGroups;
     for (const auto& [key, value]: GetParameters()->GetParametersStringVector())
     {
@@ -89,15 +107,7 @@ void ObservationLogImplementation::OpSimulationPreHook()
                 const auto& groupColumns = loggingGroups.at(loggingGroup);
                 for (const std::string& column : groupColumns)
                 {
-                    auto pos = column.find('*');
-                    if (pos == std::string::npos)
-                    {
-                        selectedColumns.push_back(column);
-                    }
-                    else
-                    {
-                        selectedRegexColumns.push_back({column.substr(0,pos),column.substr(pos+1)});
-                    }
+                    selectedColumns.Add(column);
                 }
             }
             catch (const std::out_of_range&)
@@ -113,6 +123,17 @@ void ObservationLogImplementation::OpSimulationPreHook()
         LOG(CbkLogLevel::Error, "No LoggingGroups configured");
     }
 
+    const auto endTime = dataBuffer->GetStatic("EndTime");
+    const auto cycleTime = dataBuffer->GetStatic("CycleTime");
+    if (cyclicsChunkSize > 0)
+    {
+        cyclics.Reserve(static_cast<size_t>(cyclicsChunkSize));
+    }
+    else if (!endTime.empty() && !cycleTime.empty() && std::get<int>(cycleTime.front()) > 0)
+    {
+        cyclics.Reserve(static_cast<size_t>(std::get<int>(endTime.front()) / std::get<int>(cycleTime.front())) + 1);
+    }
+
     fileHandler.SetOutputLocation(runtimeInformation.directories.output, filename);
     fileHandler.SetSceneryFile(std::get<std::string>(dataBuffer->GetStatic("SceneryFile").at(0)));
     fileHandler.WriteStartOfFile(runtimeInformation.versions.framework.str());
@@ -123,6 +144,9 @@ void ObservationLogImplementation::OpSimulationPreRunHook()
     runStatistic = RunStatistic(GetStochastics()->GetRandomSeed());
     cyclics.Clear();
     events.clear();
+    timeStepsInChunk = 0;
+
+    fileHandler.WriteStartOfRun();
 }
 
 void GetAgentValues(const std::string& key, const DataBufferReadInterface* dataBuffer, std::map<std::string, double>& result)
@@ -141,29 +165,38 @@ void GetAgentValues(const std::string& key, const DataBufferReadInterface* dataB
     }
 }
 
+bool IsLoggedCyclic(const openpass::databuffer::Value& value)
+{
+    return std::visit([](const auto& sample)
+    {
+        using T = std::decay_t<decltype(sample)>;
+        if constexpr (std::is_arithmetic_v<T> || std::is_same_v<T, std::string>)
+        {
+            return true;
+        }
+        else
+        {
+            return !sample.empty();
+        }
+    }, value);
+}
+
 void ObservationLogImplementation::OpSimulationUpdateHook(int time, [[maybe_unused]] RunResultInterface& runResult)
 {
-    const auto dsCyclics = dataBuffer->GetCyclic(std::nullopt, "*");
+    const auto dsCyclics = dataBuffer->GetCyclics(std::nullopt, selectedColumns);
 
     for (const CyclicRow& dsCyclic : *dsCyclics)
     {
-        std::visit(openpass::utils::FlatParameter::to_string([this, &dsCyclic, &time](const std::string& valueStr)
+        if (IsLoggedCyclic(dsCyclic.value))
         {
-            if (std::any_of(selectedColumns.cbegin(), selectedColumns.cend(),
-                            [&dsCyclic](const std::string& column)
-                            {
-                                return dsCyclic.key == column;
-                            }) ||
-                std::any_of(selectedRegexColumns.cbegin(), selectedRegexColumns.cend(),
-                            [&dsCyclic](const auto& column)
-                            {
-                                return dsCyclic.key.find(column.first) == 0 &&
-                                       dsCyclic.key.find(column.second, dsCyclic.key.size() - column.second.size()) == dsCyclic.key.size() - column.second.size();
-                            }))
-            {
-                cyclics.Insert(time, (dsCyclic.entityId < 10 ? "0" : "") + std::to_string(dsCyclic.entityId) + ":" + dsCyclic.key, valueStr);
-            }
-        }), dsCyclic.value);
+            cyclics.Insert(time, (dsCyclic.entityId < 10 ? "0" : "") + std::to_string(dsCyclic.entityId) + ":" + dsCyclic.key, dsCyclic.value);
+        }
+    }
+
+    if (cyclicsChunkSize > 0 && ++timeStepsInChunk == cyclicsChunkSize)
+    {
+        fileHandler.WriteCyclics(cyclics);
+        timeStepsInChunk = 0;
     }
 
     GetAgentValues("TotalDistanceTraveled", dataBuffer, runStatistic.distanceTraveled);
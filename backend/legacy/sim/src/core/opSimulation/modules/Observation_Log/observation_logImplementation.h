@@ -51,6 +51,15 @@ class EventNetworkInterface;
  */
 extern void GetAgentValues(const std::string& key, const DataBufferReadInterface* dataBuffer, std::map<std::string, double>& result);
 
+/*!
+ * \brief Returns true, if a cyclic value is logged
+ *
+ * Empty vectors are not logged, all other values (including empty strings) are.
+ *
+ * \param[in]    value        Value of the cyclic
+ */
+extern bool IsLoggedCyclic(const openpass::databuffer::Value& value);
+
 //-----------------------------------------------------------------------------
 /** \brief This class adds the RunStatistic information to the simulation output.
 *   \details This class inherits the ObservationLogGeneric which creates the basic simulation output
@@ -98,8 +107,9 @@ private:
     ObservationCyclics cyclics;
     Events events;
     RunStatistic runStatistic = RunStatistic(-1);
-    std::vector<std::string> selectedColumns;
-    std::vector<std::pair<std::string,std::string>> selectedRegexColumns;
+    KeySelection selectedColumns;    //!< Cyclic keys of all configured LoggingGroups
+    int cyclicsChunkSize{0};    //!< Number of timesteps written at once during a run (0: cyclics are written at the end of the run)
+    int timeStepsInChunk{0};
 };
 
 
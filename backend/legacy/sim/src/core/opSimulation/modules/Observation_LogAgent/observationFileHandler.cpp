@@ -34,7 +34,9 @@ ObservationFileHandler::ObservationFileHandler(const DataBufferReadInterface& da
 
 void ObservationFileHandler::WriteStartOfFile(const std::string& frameworkVersion)
 {
-    runNumber = 0;
+    // runs are numbered by their invocation, also if only a part of the invocations is executed
+    const auto firstInvocation = dataBuffer.GetStatic("FirstInvocation");
+    runNumber = firstInvocation.empty() ? 0 : std::get<int>(firstInvocation.front());
 
     // setup environment
     QDir dir(folder);
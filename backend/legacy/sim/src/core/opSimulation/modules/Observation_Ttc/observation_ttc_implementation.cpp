@@ -9,7 +9,9 @@
  ********************************************************************************/
 
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 #include <sstream>
 #include <iostream>
 #include <fstream>
@@ -22,15 +24,16 @@
 Observation_Ttc_Implementation::Observation_Ttc_Implementation(StochasticsInterface *stochastics,
                                                                WorldInterface *world,
                                                                const ParameterInterface *parameters,
-                                                               const CallbackInterface *callbacks) :
-    ObservationInterface(stochastics, world, parameters, callbacks)
+                                                               const CallbackInterface *callbacks,
+                                                               DataBufferReadInterface *dataBuffer) :
+    ObservationInterface(stochastics, world, parameters, callbacks, dataBuffer)
 {
     // read parameters
     try
     {
-        Par_resultFolderName = GetParameters()->GetParametersString().at(0);
-        Par_tempFileName = GetParameters()->GetParametersString().at(1);
-        Par_finalFileName = GetParameters()->GetParametersString().at(2);
+        Par_resultFolderName = GetParameters()->GetParametersString().at("0");
+        Par_tempFileName = GetParameters()->GetParametersString().at("1");
+        Par_finalFileName = GetParameters()->GetParametersString().at("2");
     }
     catch(...)
     {
@@ -40,9 +43,8 @@ Observation_Ttc_Implementation::Observation_Ttc_Implementation(StochasticsInterf
     }
 }
 
-void Observation_Ttc_Implementation::OpSimulationPreHook(const std::string &path)
+void Observation_Ttc_Implementation::OpSimulationPreHook()
 {
-    Q_UNUSED(path);
     QString resultFolderName = QString::fromStdString(Par_resultFolderName);
     if(!QDir().exists(resultFolderName))
     {
@@ -58,7 +60,6 @@ void Observation_Ttc_Implementation::OpSimulationPreHook(const std::string &path
 
 void Observation_Ttc_Implementation::OpSimulationPreRunHook()
 {
-    agentsMinTtc.clear();
     agentsTtc.clear();
     timeVector.clear();
 }
@@ -78,18 +79,19 @@ void Observation_Ttc_Implementation::OpSimulationUpdateHook(int time, RunResultI
     }
 
     //calculate ttc for all agents
-    for(uint id = 0; id < GetWorld()->GetAgents().size(); id++)
+    const auto &frontAgentsOfAgents = FindFrontAgents();
+
+    for(size_t index = 0; index < agentPositions.size(); ++index)
     {
-        int frontID = findFrontAgentID(id);
-        if(frontID < 0){ //if nobody is in front, then continue
+        const AgentInterface *frontAgent = frontAgentsOfAgents[index];
+        if(frontAgent == nullptr){ //if nobody is in front, then continue
             continue;
         }
 
-        const AgentInterface *agent = GetWorld()->GetAgent(id);
-        const AgentInterface *frontAgent = GetWorld()->GetAgent(frontID);
+        const AgentInterface *agent = agentPositions[index].agent;
 
         double deltaX = frontAgent->GetPositionX() - agent->GetPositionX();
-        double deltaV = frontAgent->GetVelocityX() - agent->GetVelocityX();
+        double deltaV = frontAgent->GetVelocity().x - agent->GetVelocity().x;
 
         double ttc = - deltaX / deltaV;
 
@@ -97,25 +99,64 @@ void Observation_Ttc_Implementation::OpSimulationUpdateHook(int time, RunResultI
             ttc = INFINITY;
         }
 
-        // save the minimal ttc
-        std::map<int, double>::iterator agentsMinIterator = agentsMinTtc.find(id);
-        if(agentsMinIterator == agentsMinTtc.end()){
-            agentsMinTtc.emplace(std::make_pair(id, ttc));
-        }else{
-            if(agentsMinIterator->second > ttc){
-                agentsMinIterator->second = ttc;
-            }
+        StoreTtc(agentPositions[index].id, ttc);
+    }
+}
+
+const std::vector<const AgentInterface *> &Observation_Ttc_Implementation::FindFrontAgents()
+{
+    agentPositions.clear();
+    for (const auto &[id, agent] : GetWorld()->GetAgents())
+    {
+        agentPositions.push_back({agent->GetPositionX(), id, agent});
+    }
+
+    // the ttc is calculated from x positions and velocities, so the agents are sorted by x and not per lane by s
+    // agents at the same position are ordered by id, so the agent with the lowest id is in front of all agents behind
+    std::sort(agentPositions.begin(), agentPositions.end(), [](const AgentPosition &lhs, const AgentPosition &rhs) {
+        return std::tie(lhs.positionX, lhs.id) < std::tie(rhs.positionX, rhs.id);
+    });
+
+    frontAgents.assign(agentPositions.size(), nullptr);
+
+    // all agents with the same position share the first agent of the next position as front agent
+    size_t groupBegin = 0;
+    while (groupBegin < agentPositions.size())
+    {
+        size_t groupEnd = groupBegin + 1;
+        while (groupEnd < agentPositions.size() && agentPositions[groupEnd].positionX == agentPositions[groupBegin].positionX)
+        {
+            ++groupEnd;
         }
 
-        //save all ttc
-        std::map<int, std::map<int, double>>::iterator agentIterator = agentsTtc.find(id);
-        if(agentIterator != agentsTtc.end()){
-            agentIterator->second.emplace(time, ttc);
-        }else{
-            std::map<int, double> agentTtc;
-            agentTtc.emplace(std::make_pair(time, ttc));
-            agentsTtc.emplace(std::make_pair(id, agentTtc));
+        if (groupEnd < agentPositions.size())
+        {
+            std::fill(frontAgents.begin() + groupBegin, frontAgents.begin() + groupEnd, agentPositions[groupEnd].agent);
         }
+
+        groupBegin = groupEnd;
+    }
+
+    return frontAgents;
+}
+
+void Observation_Ttc_Implementation::StoreTtc(int id, double ttc)
+{
+    if (static_cast<size_t>(id) >= agentsTtc.size())
+    {
+        agentsTtc.resize(id + 1);
+    }
+
+    auto &agentTtc = agentsTtc[id];
+
+    // save the minimal ttc
+    agentTtc.minTtc = std::min(agentTtc.minTtc, ttc);
+
+    //save all ttc (the first value of a time step is kept)
+    agentTtc.ttc.resize(timeVector.size(), std::numeric_limits<double>::quiet_NaN());
+    if (std::isnan(agentTtc.ttc.back()))
+    {
+        agentTtc.ttc.back() = ttc;
     }
 }
 
@@ -147,15 +188,18 @@ void Observation_Ttc_Implementation::OpSimulationPostRunHook(const RunResultInte
 
     resultFile << runID; // write runID in first column
     //data
-    for(auto const &agentID : agentsTtc){
+    for(size_t agentID = 0; agentID < agentsTtc.size(); ++agentID){
+        const auto &agentTtc = agentsTtc[agentID];
+        if(agentTtc.ttc.empty()){ // agent never had an agent in front
+            continue;
+        }
+
         resultFile << sep; // leave first column always empty (reserved for runID)
-        resultFile << agentID.first << sep; //write ID of agent
-        resultFile << agentsMinTtc.find(agentID.first)->second << sep; //write minimal ttc of this agent
+        resultFile << agentID << sep; //write ID of agent
+        resultFile << agentTtc.minTtc << sep; //write minimal ttc of this agent
         for(uint i = 0; i < timeVector.size(); ++i){ //write all ttc at every specific time step
-            std::map<int, double> agentTtcs = agentID.second;
-            std::map<int, double>::iterator it = agentTtcs.find(timeVector.at(i));
-            if(it != agentTtcs.end() ){// if ttc is found at specific time step, then write it
-                resultFile << it->second;
+            if(i < agentTtc.ttc.size() && !std::isnan(agentTtc.ttc[i])){// if ttc is found at specific time step, then write it
+                resultFile << agentTtc.ttc[i];
             }// else leave blank
             resultFile << sep;
         }
@@ -172,26 +216,3 @@ void Observation_Ttc_Implementation::OpSimulationPostHook()
 {
 
 }
-
-int Observation_Ttc_Implementation::findFrontAgentID(int ownID)
-{
-    const AgentInterface *agent = GetWorld()->GetAgent(ownID);
-    double posX = agent->GetPositionX();
-    double minDistance = INFINITY;
-    int frontID = -1;
-
-    for (const auto &it: GetWorld()->GetAgents()){
-        const AgentInterface *otherAgent = it.second;
-        double posXother = otherAgent->GetPositionX();
-        if ((otherAgent->GetAgentId() != ownID) && (posX < posXother))
-        {
-            double distance = posXother - posX;
-            if(minDistance > distance){
-                minDistance = distance;
-                frontID = otherAgent->GetAgentId();
-            }
-        }
-    }
-
-    return frontID;
-}
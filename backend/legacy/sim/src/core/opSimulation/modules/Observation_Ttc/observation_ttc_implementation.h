@@ -12,12 +12,16 @@
 #ifndef OBSERVATION_TTC_IMPLEMENTATION_H
 #define OBSERVATION_TTC_IMPLEMENTATION_H
 
+#include <cmath>
 #include <string>
 #include <tuple>
+#include <vector>
 #include <QFile>
 #include <QTextStream>
-#include "agentInterface.h"
-#include "observationInterface.h"
+#include "include/agentInterface.h"
+#include "include/observationInterface.h"
+#include "include/parameterInterface.h"
+#include "include/worldInterface.h"
 
 /**
 * \addtogroup CoreModules_Basic openPASS CoreModules basic
@@ -65,7 +69,8 @@ public:
     Observation_Ttc_Implementation(StochasticsInterface *stochastics,
                                    WorldInterface *world,
                                    const ParameterInterface *parameters,
-                                   const CallbackInterface *callbacks);
+                                   const CallbackInterface *callbacks,
+                                   DataBufferReadInterface *dataBuffer);
     Observation_Ttc_Implementation(const Observation_Ttc_Implementation &) = delete;
     Observation_Ttc_Implementation(Observation_Ttc_Implementation &&) = delete;
     Observation_Ttc_Implementation &operator=(const Observation_Ttc_Implementation &) = delete;
@@ -93,11 +98,9 @@ public:
 
     //-----------------------------------------------------------------------------
     //! Called by framework in simulation before all simulation runs start
-    //!
-    //! @param[in]     path          Directory where simulation results will be stored
     //-----------------------------------------------------------------------------
 
-    virtual void OpSimulationPreHook(const std::string &path);
+    virtual void OpSimulationPreHook();
 
     //-----------------------------------------------------------------------------
     //! Called by framework in simulation before each simulation run starts.
@@ -138,13 +141,42 @@ public:
         return "";   //dummy
     }
 
+private:
+    //! Agent and its position, used for sorting the agents
+    struct AgentPosition
+    {
+        double positionX;
+        int id;
+        const AgentInterface *agent;
+    };
+
+    //! Ttc of an agent
+    struct AgentTtc
+    {
+        //! minimal ttc
+        double minTtc = INFINITY;
+        //! ttc at each time step (same index as timeVector), NaN if there was no agent in front
+        std::vector<double> ttc;
+    };
+
     //-----------------------------------------------------------------------------
-    //! Finds the ID of the agent that is exactly in front of the agent.
+    //! Sorts the agents by their position and determines the agent exactly in front
+    //! of each agent (i.e. the nearest agent with greater x position). Of several
+    //! agents at that position, the one with the lowest id is in front.
+    //!
+    //! The observer measures the ttc along the global x axis, so the agents are
+    //! sorted by x and not per lane by s.
     //!
-    //! @return                      ID of agent in front
-    int findFrontAgentID(int ownID);
+    //! @return                      agent in front for each agent (nullptr, if there is none),
+    //!                              in the order of agentPositions
+    const std::vector<const AgentInterface *> &FindFrontAgents();
 
-private:
+    //-----------------------------------------------------------------------------
+    //! Stores the ttc of an agent at the current (last) time step
+    //!
+    //! @param[in]     id          ID of the agent
+    //! @param[in]     ttc         time to collision
+    void StoreTtc(int id, double ttc);
 
     /**
     * \addtogroup Observation_Ttc
@@ -161,10 +193,12 @@ private:
 
     /** @} @} */
 
-    //! A map of all agents and their ttc at every time.
-    std::map<int, std::map<int, double>> agentsTtc;
-    //! A map to save the minimal Ttc of an agent.
-    std::map<int, double> agentsMinTtc;
+    //! ttc of all agents, indexed by agent id
+    std::vector<AgentTtc> agentsTtc;
+    //! agents sorted by position (reused in every time step)
+    std::vector<AgentPosition> agentPositions;
+    //! agent in front of each agent in agentPositions (reused in every time step)
+    std::vector<const AgentInterface *> frontAgents;
     //! time vector
     std::vector<int> timeVector;
     //! full path name of result file
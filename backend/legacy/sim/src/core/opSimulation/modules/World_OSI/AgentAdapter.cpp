@@ -119,6 +119,39 @@ bool AgentAdapter::Locate()
     return locateResult.isOnRoute;
 }
 
+bool AgentAdapter::PrepareUpdate()
+{
+    boundingBoxNeedsUpdate = true;
+    boundaryPoints.clear();
+
+    auto pendingResult = localizer.LocateDeferred(GetBoundingBox2D(), GetBaseTrafficObject());
+    locateResult = std::move(pendingResult.result);
+    pendingLaneOverlaps = std::move(pendingResult.laneOverlaps);
+
+    GetBaseTrafficObject().SetTouchedRoads(locateResult.touchedRoads);
+
+    egoAgent.Update();
+
+    return locateResult.isOnRoute;
+}
+
+void AgentAdapter::CommitUpdate()
+{
+    if (locateResult.isOnRoute)
+    {
+        World::Localization::CreateLaneAssignments(GetBaseTrafficObject(), pendingLaneOverlaps);
+    }
+    pendingLaneOverlaps.clear();
+}
+
+void AgentAdapter::ClearAssignedLanes()
+{
+    for (const auto* lane : GetBaseTrafficObject().GetLaneAssignments())
+    {
+        const_cast<OWL::Interfaces::Lane*>(lane)->ClearMovingObjects();
+    }
+}
+
 void AgentAdapter::Unlocate()
 {
     localizer.Unlocate(GetBaseTrafficObject());
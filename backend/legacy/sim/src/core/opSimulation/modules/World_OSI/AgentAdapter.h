@@ -474,6 +474,19 @@ public:
 
     bool Update() override;
 
+    //! Locates the agent without assigning it to the lanes (first phase of Update)
+    //! Only modifies this agent, so that it may be called concurrently for different agents.
+    //!
+    //! \return true if the agent is on the route
+    bool PrepareUpdate();
+
+    //! Assigns the agent to the lanes located by PrepareUpdate (second phase of Update)
+    //! Modifies the lanes and must therefore not be called concurrently.
+    void CommitUpdate();
+
+    //! Removes all moving objects from the lanes this agent is currently assigned to
+    void ClearAssignedLanes();
+
     void SetBrakeLight(bool brakeLightStatus) override;
 
     bool GetBrakeLight() const override;
@@ -680,6 +693,7 @@ private:
 
     mutable World::Localization::Result locateResult;
     mutable std::vector<GlobalRoadPosition> boundaryPoints;
+    std::map<const OWL::Interfaces::Lane*, OWL::LaneOverlap> pendingLaneOverlaps;
 
     std::vector<std::pair<ObjectTypeOSI, int>> collisionPartners;
     PostCrashVelocity postCrashVelocity {};
@@ -75,11 +75,13 @@ const std::vector<int> AgentNetwork::GetRemovedAgentsInPreviousTimestep()
 
 void AgentNetwork::QueueAgentUpdate(std::function<void()> func)
 {
+    std::lock_guard<std::mutex> lock(queueMutex);
     updateQueue.push_back(func);
 }
 
 void AgentNetwork::QueueAgentRemove(const AgentInterface *agent)
 {
+    std::lock_guard<std::mutex> lock(queueMutex);
     removeQueue.push_back(agent->GetId());
 }
 
@@ -145,6 +147,12 @@ void AgentNetwork::SyncGlobalData()
     }
     removeQueue.clear();
 
+    if (threadPool)
+    {
+        UpdateAgentsConcurrently();
+        return;
+    }
+
     auto agent = agents.begin();
     while (agent != agents.end())
     {
@@ -165,3 +173,67 @@ void AgentNetwork::SyncGlobalData()
         }
     }
 }
+
+void AgentNetwork::UpdateAgentsConcurrently()
+{
+    std::vector<AgentAdapter*> agentsToUpdate;
+    agentsToUpdate.reserve(agents.size());
+    for (auto &agent : agents)
+    {
+        agentsToUpdate.push_back(&agent);
+    }
+
+    // phase 1: locate all agents concurrently without touching the lanes
+    std::vector<char> located(agentsToUpdate.size(), false);
+    const size_t numberOfJobs = std::min(agentsToUpdate.size(), threadPool->GetNumberOfThreads() * JOBS_PER_THREAD);
+    std::vector<core::WorkStealingThreadPool::Job> jobs;
+    jobs.reserve(numberOfJobs);
+    for (size_t job = 0; job < numberOfJobs; ++job)
+    {
+        const size_t begin = job * agentsToUpdate.size() / numberOfJobs;
+        const size_t end = (job + 1) * agentsToUpdate.size() / numberOfJobs;
+        jobs.emplace_back([&agentsToUpdate, &located, begin, end]
+        {
+            for (size_t index = begin; index < end; ++index)
+            {
+                agentsToUpdate[index]->Unlocate();
+                located[index] = agentsToUpdate[index]->PrepareUpdate();
+            }
+            return true;
+        });
+    }
+    threadPool->Execute(std::move(jobs));
+
+    // phase 2: assign the agents to the lanes in the order of the sequential update
+    auto agent = agents.begin();
+    for (size_t index = 0; index < agentsToUpdate.size(); ++index)
+    {
+        agent->CommitUpdate();
+
+        if (!located[index])
+        {
+            LOG(CbkLogLevel::Warning, "Could not locate agent");
+        }
+
+        if (!agent->IsAgentInWorld())
+        {
+            agent = RemoveAgent(agent);
+        }
+        else
+        {
+            ++agent;
+        }
+    }
+}
+
+void AgentNetwork::SetNumberOfThreads(int numberOfThreads)
+{
+    if (numberOfThreads > 1)
+    {
+        threadPool = std::make_unique<core::WorkStealingThreadPool>(static_cast<size_t>(numberOfThreads - 1));
+    }
+    else
+    {
+        threadPool.reset();
+    }
+}
@@ -21,11 +21,14 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <tuple>
 #include <utility>
 
 #include "AgentAdapter.h"
 #include "common/openPassTypes.h"
+#include "common/workStealingThreadPool.h"
 #include "include/agentInterface.h"
 
 class WorldImplementation;
@@ -67,6 +70,7 @@ public:
      * \brief QueueAgentUpdate
      * This function is used to store operations on the agents in a list.
      * At the end of each time step all queued operations will be executed.
+     * May be called concurrently by agents executed in parallel.
      *
      * \param[in] func      function which is to stored to be executed later
      * \param[in] val       value for the function
@@ -98,9 +102,21 @@ public:
      * \brief SyncGlobalData
      * This function is called after each timestep and executes all update function
      * and removes all agents in the remove list.
+     *
+     * \details If more than one thread is set, the agents are located concurrently
+     *          and assigned to the lanes afterwards in the order of the network,
+     *          so that the result is the same as for the sequential update.
      */
     void SyncGlobalData();
 
+    /*!
+     * \brief SetNumberOfThreads
+     * Sets the number of threads used for locating the agents in SyncGlobalData
+     *
+     * \param[in] numberOfThreads   Number of threads (values less than 2 disable concurrent localization)
+     */
+    void SetNumberOfThreads(int numberOfThreads);
+
     /*!
      * \brief GetAgent
      *
@@ -150,12 +166,20 @@ protected:
     }
 
 private:
+    //! Locates all agents concurrently and assigns them to the lanes afterwards
+    void UpdateAgentsConcurrently();
+
+    //! Number of jobs per thread, so that idle threads can steal work from slower ones
+    static constexpr size_t JOBS_PER_THREAD = 4;
+
     WorldImplementation *world;
     std::list<AgentAdapter> agents;
     std::map<int, AgentInterface *> agentsById;
     std::vector<std::function<void()>> updateQueue;
     std::vector<int> removeQueue;
     std::vector<int> removedAgentsPrevious;
+    std::mutex queueMutex;
+    std::unique_ptr<core::WorkStealingThreadPool> threadPool;
 
     const CallbackInterface *callbacks;
 };
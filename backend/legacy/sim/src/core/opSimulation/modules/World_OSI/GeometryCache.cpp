@@ -0,0 +1,311 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "GeometryCache.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include <QFile>
+#include <QSaveFile>
+
+namespace GeometryCache {
+
+namespace {
+
+//! Appends the binary representation of values to a buffer
+class Writer
+{
+public:
+    template <typename T>
+    void Write(T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void Write(const std::string& value)
+    {
+        Write(static_cast<uint32_t>(value.size()));
+        buffer.append(value);
+    }
+
+    void Write(const Common::Vector2d& value)
+    {
+        Write(value.x);
+        Write(value.y);
+    }
+
+    void Write(const LaneKey& value)
+    {
+        Write(value.first);
+        Write(value.second);
+    }
+
+    const std::string& GetBuffer() const
+    {
+        return buffer;
+    }
+
+private:
+    std::string buffer;
+};
+
+//! Reads values from a memory region, throws std::runtime_error when reading beyond its end
+class Reader
+{
+public:
+    Reader(const uchar* data, size_t size) :
+        data{data},
+        remaining{size}
+    {}
+
+    template <typename T>
+    T Read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        Require(sizeof(T));
+
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        Advance(sizeof(T));
+        return value;
+    }
+
+    std::string ReadString()
+    {
+        const auto size = Read<uint32_t>();
+        Require(size);
+
+        std::string value{reinterpret_cast<const char*>(data), size};
+        Advance(size);
+        return value;
+    }
+
+    Common::Vector2d ReadVector()
+    {
+        const auto x = Read<double>();
+        const auto y = Read<double>();
+        return {x, y};
+    }
+
+    LaneKey ReadLaneKey()
+    {
+        const auto sectionIndex = Read<uint32_t>();
+        const auto laneId = Read<int32_t>();
+        return {sectionIndex, laneId};
+    }
+
+    //! Reads the number of following elements, which have at least the given size
+    size_t ReadCount(size_t minElementSize)
+    {
+        const size_t count = Read<uint32_t>();
+        Require(count * minElementSize);
+        return count;
+    }
+
+    bool AtEnd() const
+    {
+        return remaining == 0;
+    }
+
+private:
+    void Require(size_t size) const
+    {
+        if (size > remaining)
+        {
+            throw std::runtime_error("Unexpected end of geometry cache");
+        }
+    }
+
+    void Advance(size_t size)
+    {
+        data += size;
+        remaining -= size;
+    }
+
+    const uchar* data;
+    size_t remaining;
+};
+
+SceneryGeometry ReadGeometry(Reader& reader)
+{
+    SceneryGeometry geometry;
+
+    geometry.sections.resize(reader.ReadCount(sizeof(uint32_t)));
+    for (auto& section : geometry.sections)
+    {
+        section.roadId = reader.ReadString();
+        section.sectionIndex = reader.Read<uint32_t>();
+        section.joints.resize(reader.ReadCount(sizeof(double)));
+
+        for (auto& joint : section.joints)
+        {
+            joint.s = reader.Read<double>();
+            joint.laneJoints.resize(reader.ReadCount(sizeof(int32_t) + 8 * sizeof(double)));
+
+            for (auto& laneJoint : joint.laneJoints)
+            {
+                laneJoint.laneId = reader.Read<int32_t>();
+                laneJoint.left = reader.ReadVector();
+                laneJoint.center = reader.ReadVector();
+                laneJoint.right = reader.ReadVector();
+                laneJoint.heading = reader.Read<double>();
+                laneJoint.curvature = reader.Read<double>();
+            }
+        }
+    }
+
+    geometry.intersections.resize(reader.ReadCount(sizeof(uint32_t)));
+    for (auto& intersection : geometry.intersections)
+    {
+        intersection.junctionId = reader.ReadString();
+        intersection.roadId = reader.ReadString();
+        intersection.intersectingRoad = reader.ReadString();
+        intersection.relativeRank = static_cast<IntersectingConnectionRank>(reader.Read<int32_t>());
+        intersection.sOffsets.resize(reader.ReadCount(2 * sizeof(uint32_t) + 2 * sizeof(int32_t) + 2 * sizeof(double)));
+
+        for (auto& [lanes, sOffset] : intersection.sOffsets)
+        {
+            lanes.first = reader.ReadLaneKey();
+            lanes.second = reader.ReadLaneKey();
+            sOffset.first = reader.Read<double>();
+            sOffset.second = reader.Read<double>();
+        }
+    }
+
+    return geometry;
+}
+
+} // namespace
+
+std::filesystem::path GetCacheFile(const std::filesystem::path& directory, const std::string& cacheKey)
+{
+    return directory / (cacheKey + ".opgc");
+}
+
+std::optional<SceneryGeometry> Read(const std::filesystem::path& file, const std::string& cacheKey)
+{
+    QFile cacheFile{QString::fromStdString(file.string())};
+    if (!cacheFile.open(QIODevice::ReadOnly))
+    {
+        return std::nullopt;
+    }
+
+    const auto size = cacheFile.size();
+    const uchar* data = cacheFile.map(0, size);
+    if (data == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<SceneryGeometry> geometry;
+
+    try
+    {
+        Reader reader{data, static_cast<size_t>(size)};
+
+        const std::string magic{reader.Read<char>(), reader.Read<char>(), reader.Read<char>(), reader.Read<char>()};
+        if (magic == MAGIC &&
+            reader.Read<uint32_t>() == FORMAT_VERSION &&
+            reader.ReadString() == cacheKey)
+        {
+            geometry = ReadGeometry(reader);
+
+            if (!reader.AtEnd())
+            {
+                geometry.reset();
+            }
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        geometry.reset();
+    }
+
+    cacheFile.unmap(const_cast<uchar*>(data));
+    return geometry;
+}
+
+bool Write(const std::filesystem::path& file, const std::string& cacheKey, const SceneryGeometry& geometry)
+{
+    Writer writer;
+
+    for (const char character : std::string{MAGIC})
+    {
+        writer.Write(character);
+    }
+    writer.Write(FORMAT_VERSION);
+    writer.Write(cacheKey);
+
+    writer.Write(static_cast<uint32_t>(geometry.sections.size()));
+    for (const auto& section : geometry.sections)
+    {
+        writer.Write(section.roadId);
+        writer.Write(section.sectionIndex);
+        writer.Write(static_cast<uint32_t>(section.joints.size()));
+
+        for (const auto& joint : section.joints)
+        {
+            writer.Write(joint.s);
+            writer.Write(static_cast<uint32_t>(joint.laneJoints.size()));
+
+            for (const auto& laneJoint : joint.laneJoints)
+            {
+                writer.Write(static_cast<int32_t>(laneJoint.laneId));
+                writer.Write(laneJoint.left);
+                writer.Write(laneJoint.center);
+                writer.Write(laneJoint.right);
+                writer.Write(laneJoint.heading);
+                writer.Write(laneJoint.curvature);
+            }
+        }
+    }
+
+    writer.Write(static_cast<uint32_t>(geometry.intersections.size()));
+    for (const auto& intersection : geometry.intersections)
+    {
+        writer.Write(intersection.junctionId);
+        writer.Write(intersection.roadId);
+        writer.Write(intersection.intersectingRoad);
+        writer.Write(static_cast<int32_t>(intersection.relativeRank));
+        writer.Write(static_cast<uint32_t>(intersection.sOffsets.size()));
+
+        for (const auto& [lanes, sOffset] : intersection.sOffsets)
+        {
+            writer.Write(lanes.first);
+            writer.Write(lanes.second);
+            writer.Write(sOffset.first);
+            writer.Write(sOffset.second);
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(file.parent_path(), error);
+
+    QSaveFile cacheFile{QString::fromStdString(file.string())};
+    if (!cacheFile.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    const auto& buffer = writer.GetBuffer();
+    if (cacheFile.write(buffer.data(), static_cast<qint64>(buffer.size())) != static_cast<qint64>(buffer.size()))
+    {
+        cacheFile.cancelWriting();
+        return false;
+    }
+
+    return cacheFile.commit();
+}
+
+} // namespace GeometryCache
@@ -0,0 +1,120 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+//-----------------------------------------------------------------------------
+//! @file  GeometryCache.h
+//! @brief Binary cache of the road geometry calculated by the GeometryConverter
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/vector2d.h"
+#include "common/worldDefinitions.h"
+
+//! Sampling the roads into joints and intersecting the connecting roads of junctions are the most
+//! expensive steps of the scenery conversion. Their results only depend on the content of the OpenDRIVE
+//! file and the conversion algorithm, so they are stored in a versioned binary file and reused by all
+//! later simulation processes using the same cache directory. The cache key is built from both (see
+//! GeometryConverter::GetCacheKey).
+//!
+//! Lanes are identified by OpenDRIVE ids (road id, index of the lane section, lane id), as the OWL ids
+//! depend on the order of the conversion.
+//!
+//! All numbers are stored in the byte order of the machine. The file consists of
+//! - "OPGC", format version (uint32), cache key (string)
+//! - number of sections (uint32), for each section: road id (string), section index (uint32), number of joints (uint32)
+//!   and for each joint: s (double), number of lanes (uint32), for each lane: lane id (int32), left, center, right (2 doubles each),
+//!   heading (double), curvature (double)
+//! - number of intersections (uint32), for each intersection: junction id, road id, intersecting road (strings), relative rank (int32),
+//!   number of lane pairs (uint32), for each pair: section index and lane id of both lanes (uint32, int32, uint32, int32), start s, end s (doubles)
+//!
+//! Strings are stored as length (uint32) followed by the characters.
+namespace GeometryCache {
+
+constexpr char MAGIC[] = "OPGC";
+constexpr uint32_t FORMAT_VERSION = 2;
+
+//! Joint of one lane at one s coordinate (lane 0 is the center line)
+struct LaneJoint
+{
+    int laneId;
+    Common::Vector2d left;
+    Common::Vector2d center;
+    Common::Vector2d right;
+    double heading;
+    double curvature;
+};
+
+//! Joints of all lanes at one s coordinate
+struct Joint
+{
+    double s;
+    std::vector<LaneJoint> laneJoints;
+};
+
+//! Joints of one lane section of an OpenDRIVE road
+struct SectionJoints
+{
+    std::string roadId;
+    uint32_t sectionIndex;
+    std::vector<Joint> joints;
+};
+
+//! Lane of a road given by the index of its section and its OpenDRIVE id
+using LaneKey = std::pair<uint32_t, int>;
+
+//! Intersection of two connecting roads of a junction (see OWL::IntersectionInfo)
+struct Intersection
+{
+    std::string junctionId;
+    std::string roadId;
+    std::string intersectingRoad;
+    IntersectingConnectionRank relativeRank;
+
+    //! start s and end s on the own lane (first) for each intersecting lane (second)
+    std::vector<std::pair<std::pair<LaneKey, LaneKey>, std::pair<double, double>>> sOffsets;
+};
+
+//! Cached geometry of a scenery
+struct SceneryGeometry
+{
+    std::vector<SectionJoints> sections;
+    std::vector<Intersection> intersections;
+};
+
+//! Returns the path of the cache file for the given cache key (a file name safe string)
+std::filesystem::path GetCacheFile(const std::filesystem::path& directory, const std::string& cacheKey);
+
+//! Reads a cache file by mapping it into memory
+//!
+//! \param file         cache file
+//! \param cacheKey     key of the scenery and conversion algorithm
+//! \return cached geometry, or std::nullopt if the file does not exist, has another format version,
+//!         belongs to another key or is corrupt
+std::optional<SceneryGeometry> Read(const std::filesystem::path& file, const std::string& cacheKey);
+
+//! Writes a cache file
+//!
+//! The file is replaced atomically, so that concurrent processes never read a partially written file.
+//!
+//! \param file         cache file
+//! \param cacheKey     key of the scenery and conversion algorithm
+//! \param geometry     geometry to store
+//! \return false, if the file could not be written
+bool Write(const std::filesystem::path& file, const std::string& cacheKey, const SceneryGeometry& geometry);
+
+} // namespace GeometryCache
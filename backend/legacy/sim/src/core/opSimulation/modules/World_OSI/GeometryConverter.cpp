@@ -19,18 +19,67 @@
 #include <iostream>
 #include <string>
 #include <memory>
+#include <QByteArray>
+#include <QCryptographicHash>
 #include <QFile>
 #include <deque>
+#include <future>
+#include <mutex>
+#include <iomanip>
+#include <sstream>
 
 #include "GeometryConverter.h"
 #include "RamerDouglasPeucker.h"
 #include "WorldToRoadCoordinateConverter.h"
 #include "common/vector2d.h"
+#include "common/version.h"
 #include "WorldData.h"
 
-void GeometryConverter::CalculateRoads(const SceneryInterface& scenery,
-                                       OWL::Interfaces::WorldData& worldData)
+namespace {
+
+GeometryCache::SectionJoints ToSectionJoints(const std::string& roadId, uint32_t sectionIndex, const Joints& joints)
+{
+    GeometryCache::SectionJoints sectionJoints{roadId, sectionIndex, {}};
+    sectionJoints.joints.reserve(joints.size());
+
+    for (const auto& joint : joints)
+    {
+        auto& cachedJoint = sectionJoints.joints.emplace_back(GeometryCache::Joint{joint.s, {}});
+        cachedJoint.laneJoints.reserve(joint.laneJoints.size());
+
+        for (const auto& [laneId, laneJoint] : joint.laneJoints)
+        {
+            cachedJoint.laneJoints.push_back({laneId, laneJoint.left, laneJoint.center, laneJoint.right, laneJoint.heading, laneJoint.curvature});
+        }
+    }
+
+    return sectionJoints;
+}
+
+//! Returns the OWL ids of all lanes of the world by road id, section index and OpenDrive lane id
+std::map<std::pair<std::string, GeometryCache::LaneKey>, OWL::Id> GetLaneIds(const OWL::Interfaces::WorldData& worldData)
+{
+    std::map<std::pair<std::string, GeometryCache::LaneKey>, OWL::Id> laneIds;
+    for (const auto& [roadId, road] : worldData.GetRoads())
+    {
+        for (uint32_t sectionIndex = 0; sectionIndex < road->GetSections().size(); ++sectionIndex)
+        {
+            for (const auto lane : road->GetSections()[sectionIndex]->GetLanes())
+            {
+                laneIds.emplace(std::make_pair(roadId, GeometryCache::LaneKey{sectionIndex, static_cast<int>(lane->GetOdId())}), lane->GetId());
+            }
+        }
+    }
+    return laneIds;
+}
+
+} // namespace
+
+std::vector<GeometryCache::SectionJoints> GeometryConverter::CalculateRoads(const SceneryInterface& scenery,
+                                                                            OWL::Interfaces::WorldData& worldData)
 {
+    std::vector<GeometryCache::SectionJoints> sectionJoints;
+
     for(auto [roadId, road] : scenery.GetRoads())
     {
         std::vector<RoadLaneSectionInterface*> roadLaneSections = road->GetLaneSections();
@@ -53,17 +102,23 @@ void GeometryConverter::CalculateRoads(const SceneryInterface& scenery,
                 }
 
                 // collect geometry sections
-                CalculateSection(worldData,
-                                 roadSectionStart,
-                                 roadSectionEnd,
-                                 road,
-                                 roadSection);
+                const auto joints = CalculateSection(worldData,
+                                                     roadSectionStart,
+                                                     roadSectionEnd,
+                                                     road,
+                                                     roadSection);
+
+                sectionJoints.push_back(ToSectionJoints(roadId,
+                                                        static_cast<uint32_t>(std::distance(roadLaneSections.begin(), roadLaneSectionIt)),
+                                                        joints));
             } // if lanes are not empty
         }
     }
+
+    return sectionJoints;
 }
 
-void GeometryConverter::CalculateSection(OWL::Interfaces::WorldData& worldData,
+Joints GeometryConverter::CalculateSection(OWL::Interfaces::WorldData& worldData,
                                          double roadSectionStart,
                                          double roadSectionEnd,
                                          const RoadInterface* road,
@@ -112,6 +167,7 @@ void GeometryConverter::CalculateSection(OWL::Interfaces::WorldData& worldData,
                   .CalculateCurvatures();
 
      AddPointsToWorld(worldData, jointsBuilder.GetJoints());
+     return jointsBuilder.GetJoints();
  }
 
 SampledGeometry GeometryConverter::CalculateSectionBetweenRoadMarkChanges(double roadSectionStart,
@@ -581,8 +637,228 @@ double GeometryConverter::CalculateOffsetAtRoadPosition(const RoadLaneOffset* ro
 
 void GeometryConverter::Convert(const SceneryInterface& scenery, OWL::Interfaces::WorldData& worldData)
 {
-    CalculateRoads(scenery, worldData);
+    const auto contentHash = scenery.GetContentHash();
+
+    if (contentHash.empty())
+    {
+        CalculateRoads(scenery, worldData);
+        CalculateIntersections(worldData);
+        return;
+    }
+
+    const auto cacheKey = GetCacheKey(contentHash);
+
+    // worlds of concurrently executed invocations share the geometry converted by the first of them
+    static std::mutex sharedGeometriesMutex;
+    static std::map<std::string, std::shared_future<std::shared_ptr<const GeometryCache::SceneryGeometry>>> sharedGeometries;
+
+    std::promise<std::shared_ptr<const GeometryCache::SceneryGeometry>> convertedGeometry;
+    std::shared_future<std::shared_ptr<const GeometryCache::SceneryGeometry>> sharedGeometry;
+    bool isConverting = false;
+    {
+        std::lock_guard<std::mutex> lock(sharedGeometriesMutex);
+        auto [entry, inserted] = sharedGeometries.try_emplace(cacheKey);
+        if (inserted)
+        {
+            entry->second = convertedGeometry.get_future().share();
+            isConverting = true;
+        }
+        sharedGeometry = entry->second;
+    }
+
+    if (!isConverting)
+    {
+        // a failed conversion is not shared, so it is repeated for this world
+        if (const auto geometry = sharedGeometry.get();
+            geometry && MatchesScenery(scenery, worldData, *geometry))
+        {
+            AddCachedGeometryToWorld(scenery, worldData, *geometry);
+        }
+        else
+        {
+            CalculateRoads(scenery, worldData);
+            CalculateIntersections(worldData);
+        }
+        return;
+    }
+
+    try
+    {
+        convertedGeometry.set_value(std::make_shared<const GeometryCache::SceneryGeometry>(
+            ConvertWithCache(scenery, worldData, cacheKey)));
+    }
+    catch (...)
+    {
+        convertedGeometry.set_value(nullptr);
+        throw;
+    }
+}
+
+GeometryCache::SceneryGeometry GeometryConverter::ConvertWithCache(const SceneryInterface& scenery,
+                                                                   OWL::Interfaces::WorldData& worldData,
+                                                                   const std::string& cacheKey)
+{
+    const auto cacheDirectory = scenery.GetGeometryCacheDirectory();
+    const auto cacheFile = cacheDirectory.empty() ? std::filesystem::path{} : GeometryCache::GetCacheFile(cacheDirectory, cacheKey);
+
+    // unreadable or mismatching cache files are replaced by the result of a normal conversion
+    if (!cacheDirectory.empty())
+    {
+        if (auto geometry = GeometryCache::Read(cacheFile, cacheKey);
+            geometry.has_value() && MatchesScenery(scenery, worldData, geometry.value()))
+        {
+            AddCachedGeometryToWorld(scenery, worldData, geometry.value());
+            return std::move(geometry.value());
+        }
+    }
+
+    GeometryCache::SceneryGeometry geometry;
+    geometry.sections = CalculateRoads(scenery, worldData);
     CalculateIntersections(worldData);
+    geometry.intersections = GetIntersections(worldData);
+
+    if (!cacheDirectory.empty())
+    {
+        // a missing cache file only slows down the next start, so errors are ignored
+        GeometryCache::Write(cacheFile, cacheKey, geometry);
+    }
+
+    return geometry;
+}
+
+std::string GeometryConverter::GetCacheKey(const std::string& contentHash)
+{
+    std::ostringstream key;
+    key << std::setprecision(17)
+        << contentHash << ';'
+        << openpass::common::framework.str() << ';'
+        << ALGORITHM_VERSION << ';'
+        << SAMPLING_RATE << ';'
+        << EPS << ';'
+        << RamerDouglasPeucker::ERROR_THRESHOLD;
+
+    return QCryptographicHash::hash(QByteArray::fromStdString(key.str()), QCryptographicHash::Sha256).toHex().toStdString();
+}
+
+bool GeometryConverter::MatchesScenery(const SceneryInterface& scenery,
+                                       const OWL::Interfaces::WorldData& worldData,
+                                       const GeometryCache::SceneryGeometry& geometry)
+{
+    for (const auto& section : geometry.sections)
+    {
+        const auto road = scenery.GetRoads().find(section.roadId);
+        if (road == scenery.GetRoads().end() || section.sectionIndex >= road->second->GetLaneSections().size())
+        {
+            return false;
+        }
+
+        const auto& roadLanes = road->second->GetLaneSections()[section.sectionIndex]->GetLanes();
+
+        for (const auto& cachedJoint : section.joints)
+        {
+            for (const auto& laneJoint : cachedJoint.laneJoints)
+            {
+                if (roadLanes.find(laneJoint.laneId) == roadLanes.end())
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    const auto laneIds = GetLaneIds(worldData);
+
+    for (const auto& intersection : geometry.intersections)
+    {
+        if (worldData.GetJunctions().find(intersection.junctionId) == worldData.GetJunctions().end())
+        {
+            return false;
+        }
+
+        for (const auto& [lanes, sOffset] : intersection.sOffsets)
+        {
+            if (laneIds.find({intersection.roadId, lanes.first}) == laneIds.end() ||
+                laneIds.find({intersection.intersectingRoad, lanes.second}) == laneIds.end())
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void GeometryConverter::AddCachedGeometryToWorld(const SceneryInterface& scenery,
+                                                 OWL::Interfaces::WorldData& worldData,
+                                                 const GeometryCache::SceneryGeometry& geometry)
+{
+    for (const auto& section : geometry.sections)
+    {
+        const auto& roadLanes = scenery.GetRoads().at(section.roadId)->GetLaneSections()[section.sectionIndex]->GetLanes();
+
+        Joints joints;
+        joints.reserve(section.joints.size());
+
+        for (const auto& cachedJoint : section.joints)
+        {
+            auto& joint = joints.emplace_back(Joint{cachedJoint.s, {}});
+
+            for (const auto& laneJoint : cachedJoint.laneJoints)
+            {
+                joint.laneJoints.emplace(laneJoint.laneId, LaneJoint{roadLanes.at(laneJoint.laneId), laneJoint.left, laneJoint.center, laneJoint.right, laneJoint.heading, laneJoint.curvature});
+            }
+        }
+
+        AddPointsToWorld(worldData, joints);
+    }
+
+    const auto laneIds = GetLaneIds(worldData);
+
+    for (const auto& intersection : geometry.intersections)
+    {
+        OWL::IntersectionInfo info;
+        info.intersectingRoad = intersection.intersectingRoad;
+        info.relativeRank = intersection.relativeRank;
+
+        for (const auto& [lanes, sOffset] : intersection.sOffsets)
+        {
+            info.sOffsets.emplace(std::make_pair(laneIds.at({intersection.roadId, lanes.first}),
+                                                 laneIds.at({intersection.intersectingRoad, lanes.second})),
+                                  sOffset);
+        }
+
+        worldData.GetJunctions().at(intersection.junctionId)->AddIntersectionInfo(intersection.roadId, info);
+    }
+}
+
+std::vector<GeometryCache::Intersection> GeometryConverter::GetIntersections(const OWL::Interfaces::WorldData& worldData)
+{
+    const auto getLaneKey = [&worldData](OWL::Id laneId) {
+        const auto& lane = worldData.GetLanes().at(laneId);
+        const auto& sections = lane->GetRoad().GetSections();
+        const auto sectionIndex = std::distance(sections.begin(), std::find(sections.begin(), sections.end(), &lane->GetSection()));
+        return GeometryCache::LaneKey{static_cast<uint32_t>(sectionIndex), static_cast<int>(lane->GetOdId())};
+    };
+
+    std::vector<GeometryCache::Intersection> intersections;
+
+    for (const auto& [junctionId, junction] : worldData.GetJunctions())
+    {
+        for (const auto& [roadId, intersectionInfos] : junction->GetIntersections())
+        {
+            for (const auto& info : intersectionInfos)
+            {
+                auto& intersection = intersections.emplace_back(GeometryCache::Intersection{junctionId, roadId, info.intersectingRoad, info.relativeRank, {}});
+
+                for (const auto& [lanes, sOffset] : info.sOffsets)
+                {
+                    intersection.sOffsets.emplace_back(std::make_pair(getLaneKey(lanes.first), getLaneKey(lanes.second)), sOffset);
+                }
+            }
+        }
+    }
+
+    return intersections;
 }
 
 bool GeometryConverter::IsEqual(const double valueA, const double valueB)
@@ -22,6 +22,7 @@
 #include "include/sceneryInterface.h"
 #include "include/worldInterface.h"
 #include "WorldData.h"
+#include "GeometryCache.h"
 #include "JointsBuilder.h"
 
 struct LaneGeometryPolygon
@@ -48,16 +49,41 @@ namespace GeometryConverter
 //! sections, lanes and junctions to the WorldData by calling the respective
 //! functions of the WorldData.
 //!
+//! If the scenery has a geometry cache directory, the sampled joints and junction
+//! intersections are taken from the GeometryCache, when the scenery has been converted
+//! before (by any process) with the same conversion algorithm. Otherwise, or if the cached
+//! geometry cannot be read or does not match the scenery, they are calculated and stored
+//! in the cache.
+//!
+//! Within one process, the geometry is converted only once per scenery. The worlds of
+//! concurrently executed invocations wait for the first conversion and add its joints and
+//! junction intersections read-only. The roads, sections and lanes themselves (and the
+//! localization index built from them) remain per world.
+//!
 //! \param  scenery     Scenery with the OpenDrive roads
 //! \param  worldData   worldData that is built by this function
 //-----------------------------------------------------------------------------
 void Convert(const SceneryInterface& scenery, OWL::Interfaces::WorldData& worldData);
 
+//-----------------------------------------------------------------------------
+//! \brief Converts the joints and junction intersections of the scenery, taking
+//!         them from the GeometryCache if the scenery has a geometry cache directory
+//!
+//! \param[in] scenery     Scenery with the OpenDrive roads
+//! \param[in] worldData   worldData that is built by this function
+//! \param[in] cacheKey    key of the scenery and conversion algorithm (see GetCacheKey)
+//! \return converted geometry, which has been added to the world
+//-----------------------------------------------------------------------------
+GeometryCache::SceneryGeometry ConvertWithCache(const SceneryInterface& scenery,
+                                                OWL::Interfaces::WorldData& worldData,
+                                                const std::string& cacheKey);
+
 //! Converts the Roads section in OpenDrive to OSI
 //!
 //! \param  scenery     Scenery with the OpenDrive roads
 //! \param  worldData   worldData that is built by this function
-void CalculateRoads(const SceneryInterface& scenery, OWL::Interfaces::WorldData& worldData);
+//! \return joints of all sections (for the GeometryCache)
+std::vector<GeometryCache::SectionJoints> CalculateRoads(const SceneryInterface& scenery, OWL::Interfaces::WorldData& worldData);
 
 //! Converts a single section of an OpenDrive road to OSI
 //!
@@ -66,7 +92,8 @@ void CalculateRoads(const SceneryInterface& scenery, OWL::Interfaces::WorldData&
 //! \param roadSectionEnd   end s coordinate of the section
 //! \param road             road the section is part of
 //! \param roadSection      section to convert
-void CalculateSection(OWL::Interfaces::WorldData& worldData,
+//! \return joints added to the world
+Joints CalculateSection(OWL::Interfaces::WorldData& worldData,
                       double roadSectionStart,
                       double roadSectionEnd,
                       const RoadInterface* road,
@@ -256,6 +283,51 @@ bool IsEqual(const double valueA, const double valueB);
 //-----------------------------------------------------------------------------
 void CalculateIntersections(OWL::Interfaces::WorldData& worldData);
 
+//-----------------------------------------------------------------------------
+//! \brief Returns the intersections of all junctions of the world
+//!         with lanes identified by their OpenDrive ids (for the GeometryCache)
+//-----------------------------------------------------------------------------
+std::vector<GeometryCache::Intersection> GetIntersections(const OWL::Interfaces::WorldData& worldData);
+
+//-----------------------------------------------------------------------------
+//! \brief Returns the key of the GeometryCache for a scenery
+//!
+//! The key is a hash of the content hash of the scenery, the framework version,
+//! ALGORITHM_VERSION and the sampling parameters, so that geometry calculated
+//! by another version of the conversion is never reused.
+//!
+//! \param[in] contentHash    content hash of the scenery
+//! \return hex encoded key
+//-----------------------------------------------------------------------------
+std::string GetCacheKey(const std::string& contentHash);
+
+//-----------------------------------------------------------------------------
+//! \brief Checks if all roads, lane sections, lanes and junctions referenced by
+//!         cached geometry exist in the scenery and the world
+//!
+//! \param[in] scenery     Scenery with the OpenDrive roads
+//! \param[in] worldData   worldData with the converted roads, sections and lanes
+//! \param[in] geometry    cached geometry of the scenery
+//! \return true, if the geometry can be added by AddCachedGeometryToWorld
+//-----------------------------------------------------------------------------
+bool MatchesScenery(const SceneryInterface& scenery,
+                    const OWL::Interfaces::WorldData& worldData,
+                    const GeometryCache::SceneryGeometry& geometry);
+
+//-----------------------------------------------------------------------------
+//! \brief Adds cached joints and junction intersections to the world
+//!         instead of calculating them
+//!
+//! The geometry has to match the scenery (see MatchesScenery).
+//!
+//! \param[in] scenery     Scenery with the OpenDrive roads
+//! \param[in] worldData   worldData that is built by this function
+//! \param[in] geometry    cached geometry of the scenery
+//-----------------------------------------------------------------------------
+void AddCachedGeometryToWorld(const SceneryInterface& scenery,
+                              OWL::Interfaces::WorldData& worldData,
+                              const GeometryCache::SceneryGeometry& geometry);
+
 //-----------------------------------------------------------------------------
 //! \brief BuildRoadPolygons builds all polygons for the road and pairs them
 //!        with the road's id
@@ -322,5 +394,9 @@ IntersectingConnectionRank GetRelativeRank(const std::string& roadId, const std:
 
 constexpr static const double SAMPLING_RATE = 0.1; // 1m sampling rate of reference line
 constexpr static const double EPS = 1e-3;   // epsilon value for geometric comparisons
+
+//! Version of the geometry calculation (GeometryConverter and JointsBuilder). Has to be increased with
+//! every change of the calculated joints or intersections, so that cached geometry is recalculated.
+constexpr static const uint32_t ALGORITHM_VERSION = 1;
 };
 
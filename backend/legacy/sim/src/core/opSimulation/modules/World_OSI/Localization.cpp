@@ -230,6 +230,17 @@ void Localizer::Init()
 }
 
 Result Localizer::Locate(const polygon_t& boundingBox, OWL::Interfaces::WorldObject& object) const
+{
+    auto pendingResult = LocateDeferred(boundingBox, object);
+    if (pendingResult.result.isOnRoute)
+    {
+        CreateLaneAssignments(object, pendingResult.laneOverlaps);
+    }
+
+    return std::move(pendingResult.result);
+}
+
+PendingResult Localizer::LocateDeferred(const polygon_t& boundingBox, const OWL::Interfaces::WorldObject& object) const
 {
     const auto& referencePointPosition = object.GetReferencePointPosition();
     const auto& orientation = object.GetAbsOrientation();
@@ -244,26 +255,17 @@ Result Localizer::Locate(const polygon_t& boundingBox, OWL::Interfaces::WorldObj
     CoarseBoundingBox searchBox = GetSearchBox(agentBoundary);
 
     Common::Vector2d referencePoint{referencePointPosition.x, referencePointPosition.y};
-    if (object.Is<OWL::Interfaces::MovingObject>())
-    {
-        const auto& movingObject = object.As<OWL::Interfaces::MovingObject>();
-        double distanceRefToFront = movingObject->GetDistanceReferencePointToLeadingEdge();
-    }
 
-    const auto& locatedObject = LocateOnGeometryElements(rTree,
-                                                         worldData,
-                                                         agentBoundary,
-                                                         searchBox,
-                                                         referencePoint,
-                                                         orientation.yaw);
+    auto locatedObject = LocateOnGeometryElements(rTree,
+                                                  worldData,
+                                                  agentBoundary,
+                                                  searchBox,
+                                                  referencePoint,
+                                                  orientation.yaw);
 
     auto result = BuildResult(locatedObject);
-    if (result.isOnRoute)
-    {
-        CreateLaneAssignments(object, locatedObject.laneOverlaps);
-    }
 
-    return result;
+    return {std::move(result), std::move(locatedObject.laneOverlaps)};
 }
 
 GlobalRoadPositions Localizer::Locate(const Common::Vector2d& point, const double& hdg) const
@@ -58,6 +58,14 @@ struct LocatedObject
     GlobalRoadPositions referencePoint;
 };
 
+//! This struct contains the result of a localization, that has not yet been assigned to the lanes.
+//! It is used to split the localization of all agents into a concurrent and a sequential phase.
+struct PendingResult
+{
+    Result result;
+    std::map<const OWL::Interfaces::Lane*, OWL::LaneOverlap> laneOverlaps;
+};
+
 //! Calculates the intersection of the object boundary with an GeometryElement and stores the min and max s coordinates
 //! and min and max deltas (for t) in the LocatedObject struct. Also calculates s, t and yaw of the referencePoint and
 //! mainLaneLocator, if the lay on the GeometryElement
@@ -103,6 +111,14 @@ public:
 
     Result Locate(const polygon_t& boundingBox, OWL::Interfaces::WorldObject& object) const;
 
+    //! Locates the object without assigning it to the lanes
+    //! This does not modify the world and may therefore be called concurrently for different objects
+    //!
+    //! \param boundingBox     bounding box of the object
+    //! \param object          object to locate
+    //! \return                localization result and the lanes the object has to be assigned to
+    PendingResult LocateDeferred(const polygon_t& boundingBox, const OWL::Interfaces::WorldObject& object) const;
+
     GlobalRoadPositions Locate(const Common::Vector2d& point, const double& hdg) const;
 
     void Unlocate(OWL::Interfaces::WorldObject& object) const;
@@ -330,6 +330,7 @@ namespace OWL {
 
         void Lane::AddMovingObject(Interfaces::MovingObject &movingObject, const LaneOverlap &laneOverlap) {
             worldObjects.Insert(laneOverlap, &movingObject);
+            containsMovingObjects = true;
         }
 
         void Lane::AddStationaryObject(Interfaces::StationaryObject &stationaryObject, const LaneOverlap &laneOverlap) {
@@ -358,6 +359,11 @@ namespace OWL {
         }
 
         void Lane::ClearMovingObjects() {
+            if (!containsMovingObjects) {
+                return;
+            }
+
+            containsMovingObjects = false;
             worldObjects.Clear();
             for (const auto&[laneOverlap, object]: stationaryObjects) {
                 worldObjects.Insert(laneOverlap, object);
@@ -341,6 +341,7 @@ struct LaneOverlap
             virtual void AddTrafficLight(Interfaces::TrafficLight &trafficLight) = 0;
 
             //!Removes all MovingObjects from the list of objects currently in this lane while keeping StationaryObjects
+            //!Lanes without MovingObjects are left untouched
             virtual void ClearMovingObjects() = 0;
         };
 
@@ -1042,6 +1043,7 @@ struct LaneOverlap
             LaneType laneType{LaneType::Undefined};
             LaneAssignmentCollector worldObjects;
             Interfaces::LaneAssignments stationaryObjects;
+            bool containsMovingObjects{false};  //!< True if a moving object was added since the last call to ClearMovingObjects
             Interfaces::TrafficSigns trafficSigns;
             Interfaces::RoadMarkings roadMarkings;
             Interfaces::TrafficLights trafficLights;
@@ -65,7 +65,12 @@ public:
     MOCK_METHOD1(SetTurningRates, void (const TurningRates& turningRates));
     MOCK_CONST_METHOD0(GetTurningRates, const TurningRates& ());
     MOCK_METHOD2(GetSensorView, SensorView_ptr(osi3::SensorViewConfiguration &, int));
+    MOCK_METHOD2(GetDynamicSensorView, SensorView_ptr(osi3::SensorViewConfiguration &, int));
+    MOCK_METHOD2(AppendStaticSensorView, void(int, std::string &));
+    MOCK_METHOD0(SerializeStaticContent, void());
     MOCK_METHOD0(ResetTemporaryMemory, void());
+    MOCK_METHOD0(InvalidateMovingObjectIndex, void());
+    MOCK_METHOD0(UpdateSpatialIndices, void());
     MOCK_CONST_METHOD1(GetLaneBoundary, const OWL::Interfaces::LaneBoundary &(Id id));
     MOCK_METHOD4(AddLaneBoundary, OWL::Id(const Id, const RoadLaneRoadMark &odLaneRoadMark, double sectionStart, OWL::LaneMarkingSide side));
     MOCK_METHOD2(SetCenterLaneBoundary, void(const RoadLaneSectionInterface &odSection, std::vector<OWL::Id> laneBoundaryIds));
@@ -0,0 +1,43 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "RouteStreamCache.h"
+
+void RouteStreamCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(streamsMutex);
+    laneMultiStreams.clear();
+    roadMultiStreams.clear();
+}
+
+std::shared_ptr<const LaneMultiStream> RouteStreamCache::GetLaneMultiStream(RoadGraphVertex start, OWL::OdId startLaneId, double startDistance)
+{
+    const auto& startLane = worldDataQuery.GetLaneByOdId(get(RouteElement(), roadGraph, start).roadId, startLaneId, startDistance);
+    const OWL::Lane* startLanePointer = startLane.Exists() ? &startLane : nullptr;
+
+    std::lock_guard<std::mutex> lock(streamsMutex);
+    auto& laneMultiStream = laneMultiStreams[{start, startLanePointer}];
+    if (!laneMultiStream)
+    {
+        laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, start, startLanePointer);
+    }
+    return laneMultiStream;
+}
+
+std::shared_ptr<const RoadMultiStream> RouteStreamCache::GetRoadMultiStream(RoadGraphVertex start)
+{
+    std::lock_guard<std::mutex> lock(streamsMutex);
+    auto& roadMultiStream = roadMultiStreams[start];
+    if (!roadMultiStream)
+    {
+        roadMultiStream = worldDataQuery.CreateRoadMultiStream(roadGraph, start);
+    }
+    return roadMultiStream;
+}
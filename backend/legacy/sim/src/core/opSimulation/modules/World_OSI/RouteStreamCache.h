@@ -0,0 +1,61 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+//-----------------------------------------------------------------------------
+//! @file  RouteStreamCache.h
+//! @brief Caches the multi streams along one road graph
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "include/streamInterface.h"
+#include "WorldDataQuery.h"
+
+//! Caches the LaneMultiStreams and RoadMultiStreams along one road graph
+//!
+//! Lane streams are identified by their start vertex and start lane, road streams by their start vertex.
+//! The cache does not notice changes of the road graph, so it has to be cleared by its owner.
+//! All methods may be called concurrently (e.g. by sensors of concurrently executed agents).
+class RouteStreamCache : public RouteStreamCacheInterface
+{
+public:
+    RouteStreamCache(const RoadGraph& roadGraph, const WorldDataQuery& worldDataQuery) :
+        roadGraph(roadGraph),
+        worldDataQuery(worldDataQuery)
+    {}
+
+    void Clear() override;
+
+    //! Returns the LaneMultiStream along the road graph (created by the first call with the same start lane)
+    //!
+    //! \param start            root of the tree
+    //! \param startLaneId      OpenDrive id of the lane at the root, where the lane stream should start
+    //! \param startDistance    s coordinate at the root, where the lane stream should start
+    //! \return     LaneMultiStream starting with the specified lane
+    std::shared_ptr<const LaneMultiStream> GetLaneMultiStream(RoadGraphVertex start, OWL::OdId startLaneId, double startDistance);
+
+    //! Returns the RoadMultiStream along the road graph (created by the first call with the same start)
+    //!
+    //! \param start            root of the tree
+    //! \return     RoadMultiStream starting with the specified road
+    std::shared_ptr<const RoadMultiStream> GetRoadMultiStream(RoadGraphVertex start);
+
+private:
+    const RoadGraph& roadGraph;
+    const WorldDataQuery& worldDataQuery;
+    std::mutex streamsMutex;    //!< guards the cached streams
+    std::map<std::pair<RoadGraphVertex, const OWL::Lane*>, std::shared_ptr<const LaneMultiStream>> laneMultiStreams;
+    std::map<RoadGraphVertex, std::shared_ptr<const RoadMultiStream>> roadMultiStreams;
+};
@@ -0,0 +1,106 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
+
+#include "common/hypot.h"
+#include "OWL/Primitives.h"
+
+namespace OWL {
+
+//! Spatial index over the reference points of world objects (e.g. for sector queries)
+//!
+//! The index is built from the objects given by the owner and has to be invalidated and rebuilt,
+//! whenever objects are added, removed or moved. Querying a built index only reads it.
+template<typename T>
+class SpatialIndex
+{
+public:
+    //! Marks the index as outdated
+    void Invalidate()
+    {
+        valid = false;
+    }
+
+    //! Returns true, if the index has been built since the last invalidation
+    bool IsValid() const
+    {
+        return valid;
+    }
+
+    //! Indexes the given objects (replaces the previous content)
+    void Build(std::vector<T*> newObjects)
+    {
+        objects = std::move(newObjects);
+        maxHalfDiagonal = 0.0;
+
+        std::vector<IndexedPoint> points;
+        points.reserve(objects.size());
+
+        for (size_t index = 0; index < objects.size(); ++index)
+        {
+            const auto& position = objects[index]->GetReferencePointPosition();
+            const auto dimension = objects[index]->GetDimension();
+            maxHalfDiagonal = std::max(maxHalfDiagonal, 0.5 * openpass::hypot(dimension.width, dimension.length));
+            points.emplace_back(Point{position.x, position.y}, index);
+        }
+
+        tree = Tree{points.begin(), points.end()};
+        valid = true;
+    }
+
+    //! Returns all objects, which may reach into the circle around origin with the given radius,
+    //! in the order they were given to Build
+    //!
+    //! Objects are selected by their reference point and the largest extent of all indexed objects,
+    //! so the result is a superset of all objects intersecting the circle.
+    std::vector<T*> GetCandidates(const Primitive::AbsPosition& origin, double radius) const
+    {
+        const double range = radius + maxHalfDiagonal;
+        const Box queryBox{{origin.x - range, origin.y - range}, {origin.x + range, origin.y + range}};
+
+        std::vector<size_t> indices;
+        tree.query(boost::geometry::index::intersects(queryBox),
+                   boost::make_function_output_iterator([&indices](const IndexedPoint& point) { indices.push_back(point.second); }));
+        std::sort(indices.begin(), indices.end());
+
+        std::vector<T*> candidates;
+        candidates.reserve(indices.size());
+        for (const auto index : indices)
+        {
+            candidates.push_back(objects[index]);
+        }
+
+        return candidates;
+    }
+
+private:
+    using Point = boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian>;
+    using Box = boost::geometry::model::box<Point>;
+    using IndexedPoint = std::pair<Point, size_t>;
+    using Tree = boost::geometry::index::rtree<IndexedPoint, boost::geometry::index::quadratic<16>>;
+
+    std::vector<T*> objects;
+    Tree tree;
+    double maxHalfDiagonal{0.0};
+    bool valid{false};
+};
+
+} // namespace OWL
@@ -42,6 +42,28 @@
 
 namespace OWL {
 
+namespace {
+
+//! Indexes all objects, if the index is outdated
+template<typename T, typename Objects>
+void UpdateIndex(SpatialIndex<T>& index, const Objects& objects)
+{
+    if (index.IsValid())
+    {
+        return;
+    }
+
+    std::vector<T*> allObjects;
+    allObjects.reserve(objects.size());
+    for (const auto& mapItem : objects)
+    {
+        allObjects.push_back(mapItem.second.get());
+    }
+    index.Build(std::move(allObjects));
+}
+
+} // namespace
+
     WorldData::WorldData(const CallbackInterface *callbacks) :
             callbacks(callbacks) {
 #ifdef USE_PROTOBUF_ARENA
@@ -57,6 +79,14 @@ namespace OWL {
     }
 
     SensorView_ptr WorldData::GetSensorView(osi3::SensorViewConfiguration &conf, int agentId) {
+        return CreateSensorView(conf, agentId, true);
+    }
+
+    SensorView_ptr WorldData::GetDynamicSensorView(osi3::SensorViewConfiguration &conf, int agentId) {
+        return CreateSensorView(conf, agentId, false);
+    }
+
+    SensorView_ptr WorldData::CreateSensorView(osi3::SensorViewConfiguration &conf, int agentId, bool withStaticContent) {
         const auto host_id = GetOwlId(agentId);
 #ifdef USE_PROTOBUF_ARENA
         SensorView_ptr sv = SensorView_ptr(google::protobuf::Arena::CreateMessage<osi3::SensorView>(&tempArena));
@@ -70,18 +100,86 @@ namespace OWL {
         sv->mutable_mounting_position()->CopyFrom(conf.mounting_position());
         sv->mutable_mounting_position_rmse()->CopyFrom(conf.mounting_position());
 
-        auto filteredGroundTruth = GetFilteredGroundTruth(conf, GetMovingObject(host_id));
-        sv->mutable_global_ground_truth()->CopyFrom(*filteredGroundTruth);
+        FillFilteredGroundTruth(conf, GetMovingObject(host_id), *sv->mutable_global_ground_truth(), withStaticContent);
 
         AddHostVehicleToSensorView(host_id, *sv);
 
         return sv;
     }
 
+    void WorldData::AppendStaticSensorView(int agentId, std::string &serializedSensorView) {
+        const auto &assignedLanes = GetMovingObject(GetOwlId(agentId)).GetLaneAssignments();
+
+        std::string serializedGroundTruth;
+        for (const auto &[laneId, serializedLane]: serializedLanes) {
+            const bool isHostVehicleLane =
+                    std::find_if(assignedLanes.cbegin(), assignedLanes.cend(),
+                                 [laneId = laneId](const OWL::Interfaces::Lane *assignedLane) {
+                                     return assignedLane->GetId() == laneId;
+                                 })
+                    != assignedLanes.cend();
+            serializedGroundTruth += serializedLane[isHostVehicleLane];
+        }
+        serializedGroundTruth += serializedLaneBoundaries;
+
+        AppendGroundTruthToSensorView(serializedGroundTruth, serializedSensorView);
+    }
+
+    void WorldData::AppendGroundTruthToSensorView(const std::string &serializedGroundTruth, std::string &serializedSensorView) {
+        // Protobuf merges repeated occurrences of an embedded message, so the GroundTruth is appended
+        // as additional length delimited global_ground_truth field (key and size are varints)
+        const auto appendVarint = [&serializedSensorView](uint64_t value) {
+            while (value >= 0x80) {
+                serializedSensorView.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            serializedSensorView.push_back(static_cast<char>(value));
+        };
+
+        constexpr uint64_t lengthDelimitedWireType = 2;
+        appendVarint((static_cast<uint64_t>(osi3::SensorView::kGlobalGroundTruthFieldNumber) << 3) | lengthDelimitedWireType);
+        appendVarint(serializedGroundTruth.size());
+        serializedSensorView += serializedGroundTruth;
+    }
+
+    void WorldData::SerializeStaticContent() {
+        // A GroundTruth with a single repeated element serializes to exactly this element,
+        // so the serialized lanes can be concatenated
+        serializedLanes.clear();
+        for (const auto &[laneId, lane]: lanes) {
+            osi3::GroundTruth laneGroundTruth;
+            lane->CopyToGroundTruth(laneGroundTruth);
+
+            auto &serializedLane = serializedLanes.emplace_back(laneId, std::array<std::string, 2>{}).second;
+            for (const bool isHostVehicleLane : {false, true}) {
+                laneGroundTruth.mutable_lane(0)->mutable_classification()->set_is_host_vehicle_lane(isHostVehicleLane);
+                laneGroundTruth.SerializeToString(&serializedLane[isHostVehicleLane]);
+            }
+        }
+
+        osi3::GroundTruth laneBoundaryGroundTruth;
+        for (const auto &[laneBoundaryId, laneBoundary]: laneBoundaries) {
+            laneBoundary->CopyToGroundTruth(laneBoundaryGroundTruth);
+        }
+        laneBoundaryGroundTruth.SerializeToString(&serializedLaneBoundaries);
+    }
+
     void WorldData::ResetTemporaryMemory() {
         tempArena.Reset();
     }
 
+    void WorldData::InvalidateMovingObjectIndex() {
+        movingObjectIndex.Invalidate();
+    }
+
+    void WorldData::UpdateSpatialIndices() {
+        UpdateIndex(movingObjectIndex, movingObjects);
+        UpdateIndex(stationaryObjectIndex, stationaryObjects);
+        UpdateIndex(trafficSignIndex, trafficSigns);
+        UpdateIndex(trafficLightIndex, trafficLights);
+        UpdateIndex(roadMarkingIndex, roadMarkings);
+    }
+
     const osi3::GroundTruth &WorldData::GetOsiGroundTruth() const {
         return *osiGroundTruth;
     }
@@ -157,14 +255,22 @@ void WorldData::SetTurningRates (const TurningRates& turningRates)
 
 WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorViewConfiguration& conf, const OWL::Interfaces::MovingObject& reference)
 {
-    bool referenceObjectAdded = false;
-
 #ifdef USE_PROTOBUF_ARENA
         GroundTruth_ptr filteredGroundTruth = google::protobuf::Arena::CreateMessage<osi3::GroundTruth>(&tempArena);
 #else
         GroundTruth_ptr filteredGroundTruth = std::make_unique<osi3::GroundTruth>();
 #endif
 
+        FillFilteredGroundTruth(conf, reference, *filteredGroundTruth, true);
+
+        return filteredGroundTruth;
+    }
+
+    void WorldData::FillFilteredGroundTruth(const osi3::SensorViewConfiguration& conf, const OWL::Interfaces::MovingObject& reference,
+                                            osi3::GroundTruth& filteredGroundTruth, bool withStaticContent)
+    {
+        bool referenceObjectAdded = false;
+
         Primitive::AbsPosition relativeSensorPos
                 {conf.mounting_position().position().x(),
                  conf.mounting_position().position().y(),
@@ -200,11 +306,8 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
                                                                      rightBoundaryAngle);
         const auto &filteredRoadMarkings = GetRoadMarkingsInSector(absoluteSensorPos, range, leftBoundaryAngle,
                                                                    rightBoundaryAngle);
-        const auto &filteredLanes = lanes;
-        const auto &filteredLaneBoundaries = laneBoundaries;
-
         for (const auto &object: filteredMovingObjects) {
-            object->CopyToGroundTruth(*filteredGroundTruth);
+            object->CopyToGroundTruth(filteredGroundTruth);
 
             if (object->GetId() == reference.GetId()) {
                 referenceObjectAdded = true;
@@ -212,34 +315,36 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
         }
 
         if (!referenceObjectAdded) {
-            reference.CopyToGroundTruth(*filteredGroundTruth);
+            reference.CopyToGroundTruth(filteredGroundTruth);
         }
 
         for (const auto &object: filteredStationaryObjects) {
-            object->CopyToGroundTruth(*filteredGroundTruth);
+            object->CopyToGroundTruth(filteredGroundTruth);
         }
 
         for (const auto &trafficSign: filteredTrafficSigns) {
-            trafficSign->CopyToGroundTruth(*filteredGroundTruth);
+            trafficSign->CopyToGroundTruth(filteredGroundTruth);
         }
 
         for (const auto &trafficLight: filteredTrafficLights) {
-            trafficLight->CopyToGroundTruth(*filteredGroundTruth);
+            trafficLight->CopyToGroundTruth(filteredGroundTruth);
         }
 
         for (const auto &roadMarking: filteredRoadMarkings) {
-            roadMarking->CopyToGroundTruth(*filteredGroundTruth);
+            roadMarking->CopyToGroundTruth(filteredGroundTruth);
         }
 
-        for (const auto &lane: filteredLanes) {
-            lane.second->CopyToGroundTruth(*filteredGroundTruth);
+        if (!withStaticContent) {
+            return;
         }
 
-        for (const auto &laneboundaries: filteredLaneBoundaries) {
-            laneboundaries.second->CopyToGroundTruth(*filteredGroundTruth);
+        for (const auto &lane: lanes) {
+            lane.second->CopyToGroundTruth(filteredGroundTruth);
         }
 
-        return filteredGroundTruth;
+        for (const auto &laneboundaries: laneBoundaries) {
+            laneboundaries.second->CopyToGroundTruth(filteredGroundTruth);
+        }
     }
 
     std::vector<const Interfaces::StationaryObject *>
@@ -247,11 +352,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
                                             double radius,
                                             double leftBoundaryAngle,
                                             double rightBoundaryAngle) {
-        std::vector<Interfaces::StationaryObject *> objects;
-
-        for (const auto &mapItem: stationaryObjects) {
-            objects.push_back(mapItem.second.get());
-        }
+        const auto objects = stationaryObjectIndex.GetCandidates(origin, radius);
 
         return ApplySectorFilter(objects, origin, radius, leftBoundaryAngle, rightBoundaryAngle);
     }
@@ -261,11 +362,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
                                         double radius,
                                         double leftBoundaryAngle,
                                         double rightBoundaryAngle) {
-        std::vector<Interfaces::MovingObject *> objects;
-
-        for (const auto &mapItem: movingObjects) {
-            objects.push_back(mapItem.second.get());
-        }
+        const auto objects = movingObjectIndex.GetCandidates(origin, radius);
 
         return ApplySectorFilter(objects, origin, radius, leftBoundaryAngle, rightBoundaryAngle);
     }
@@ -275,11 +372,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
                                        double radius,
                                        double leftBoundaryAngle,
                                        double rightBoundaryAngle) {
-        std::vector<Interfaces::TrafficSign *> objects;
-
-        for (const auto &mapItem: trafficSigns) {
-            objects.push_back(mapItem.second.get());
-        }
+        const auto objects = trafficSignIndex.GetCandidates(origin, radius);
 
         return ApplySectorFilter(objects, origin, radius, leftBoundaryAngle, rightBoundaryAngle);
     }
@@ -289,11 +382,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
                                         double radius,
                                         double leftBoundaryAngle,
                                         double rightBoundaryAngle) {
-        std::vector<Interfaces::TrafficLight *> objects;
-
-        for (const auto &mapItem: trafficLights) {
-            objects.push_back(mapItem.second.get());
-        }
+        const auto objects = trafficLightIndex.GetCandidates(origin, radius);
 
         return ApplySectorFilter(objects, origin, radius, leftBoundaryAngle, rightBoundaryAngle);
         //return objects;
@@ -302,11 +391,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
     std::vector<const Interfaces::RoadMarking *>
     WorldData::GetRoadMarkingsInSector(const Primitive::AbsPosition &origin, double radius, double leftBoundaryAngle,
                                        double rightBoundaryAngle) {
-        std::vector<Interfaces::RoadMarking *> objects;
-
-        for (const auto &mapItem: roadMarkings) {
-            objects.push_back(mapItem.second.get());
-        }
+        const auto objects = roadMarkingIndex.GetCandidates(origin, radius);
 
         return ApplySectorFilter(objects, origin, radius, leftBoundaryAngle, rightBoundaryAngle);
     }
@@ -591,6 +676,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
         auto [movingObjectIdPair, success] = movingObjects.emplace(id, std::make_unique<Implementation::MovingObject>(osiMovingObject));
         THROWIFFALSE(success, "Could not create moving object. Id is already in use");
         osiMovingObject->mutable_id()->set_value(id);
+        movingObjectIndex.Invalidate();
 
         return *movingObjectIdPair->second;
     }
@@ -609,6 +695,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
         if (found) {
             osiMovingObjects.RemoveLast();
             movingObjects.erase(id);
+            movingObjectIndex.Invalidate();
         }
     }
 
@@ -617,6 +704,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
         auto [stationaryObjectIdPair, success] = stationaryObjects.emplace(id, std::make_unique<Implementation::StationaryObject>(osiStationaryObject, linkedObject));
         THROWIFFALSE(success, "Could not create stationary object. Id is already in use");
         osiStationaryObject->mutable_id()->set_value(id);
+        stationaryObjectIndex.Invalidate();
 
         return *stationaryObjectIdPair->second;
     }
@@ -627,6 +715,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
         THROWIFFALSE(success, "Could not create traffic sign. Id is already in use");
         osiTrafficSign->mutable_id()->set_value(id);
         trafficSignIdMapping[odId] = id;
+        trafficSignIndex.Invalidate();
 
         return *trafficSignIdPair->second;
     }
@@ -635,6 +724,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
     WorldData::AddTrafficLight(const std::vector<Id> ids, const std::string odId, const std::string &type) {
         auto main_id = ids.front();
         trafficSignIdMapping[odId] = main_id;
+        trafficLightIndex.Invalidate();
 
         osi3::TrafficLight *osiLightOne = osiGroundTruth->add_traffic_light();
         initializeDefaultTrafficLight(osiLightOne);
@@ -679,6 +769,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
         auto [roadMarkingIdPair, success] = roadMarkings.emplace(id, std::make_unique<Implementation::RoadMarking>(osiRoadMarking));
         THROWIFFALSE(success, "Could not create road marking. Id is already in use");
         osiRoadMarking->mutable_id()->set_value(id);
+        roadMarkingIndex.Invalidate();
 
         return *roadMarkingIdPair->second;
     }
@@ -895,6 +986,7 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
     void WorldData::Reset()
     {
         movingObjects.clear();
+        movingObjectIndex.Invalidate();
 
         osiGroundTruth->mutable_moving_object()->Clear();
     }
@@ -911,6 +1003,15 @@ WorldData::GroundTruth_ptr WorldData::GetFilteredGroundTruth(const osi3::SensorV
         junctions.clear();
         roadMarkings.clear();
 
+        movingObjectIndex.Invalidate();
+        stationaryObjectIndex.Invalidate();
+        trafficSignIndex.Invalidate();
+        trafficLightIndex.Invalidate();
+        roadMarkingIndex.Invalidate();
+
+        serializedLanes.clear();
+        serializedLaneBoundaries.clear();
+
         osiGroundTruth->Clear();
     }
 
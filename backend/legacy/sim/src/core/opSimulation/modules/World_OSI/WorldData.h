@@ -18,7 +18,10 @@
 
 #pragma once
 
+#include <array>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "OWL/DataTypes.h"
 #include "OWL/TrafficLight.h"
@@ -29,6 +32,7 @@
 #include "include/callbackInterface.h"
 #include "common/openScenarioDefinitions.h"
 #include "common/hypot.h"
+#include "SpatialIndex.h"
 #include "osi3/osi_groundtruth.pb.h"
 #include "osi3/osi_sensorview.pb.h"
 #include "osi3/osi_sensorviewconfiguration.pb.h"
@@ -109,6 +113,34 @@ public:
      */
     virtual SensorView_ptr GetSensorView(osi3::SensorViewConfiguration& conf, int agentId) = 0;
 
+    /*!
+     * \brief Creates a OSI SensorView without the static content (lanes and lane boundaries)
+     *
+     * The static content can be added to the serialized SensorView by AppendStaticSensorView
+     *
+     * \param[in]   conf      SensorViewConfiguration to create SensorView from
+     * \param[in]   agentId   The Id of the associated Agent
+     *
+     * \return      A OSI SensorView with filtered GroundTruth without lanes and lane boundaries
+     */
+    virtual SensorView_ptr GetDynamicSensorView(osi3::SensorViewConfiguration& conf, int agentId) = 0;
+
+    /*!
+     * \brief Appends the lanes and lane boundaries of the global GroundTruth to a serialized SensorView
+     *
+     * Only reads the static content serialized by SerializeStaticContent, so it may be called concurrently.
+     * Parsing a serialized result of GetDynamicSensorView with appended static content yields the SensorView of GetSensorView.
+     *
+     * \param[in]       agentId                 The Id of the associated Agent (host vehicle lanes are flagged)
+     * \param[in,out]   serializedSensorView    Serialized SensorView to append to
+     */
+    virtual void AppendStaticSensorView(int agentId, std::string& serializedSensorView) = 0;
+
+    //! Serializes the lanes (with and without host vehicle lane flag) and lane boundaries for AppendStaticSensorView
+    //!
+    //! Has to be called once after the scenery has been converted
+    virtual void SerializeStaticContent() = 0;
+
     /*!
      * \brief Frees temporary objects
      *
@@ -119,6 +151,16 @@ public:
      */
     virtual void ResetTemporaryMemory() = 0;
 
+    //! Marks the positions of the moving objects as changed (e.g. after synchronization of the agents),
+    //! so that they are re-indexed by the next call of UpdateSpatialIndices
+    virtual void InvalidateMovingObjectIndex() = 0;
+
+    //! Rebuilds all outdated spatial indices used by the sector queries
+    //!
+    //! The sector queries only read the indices, so this has to be called before they are used
+    //! (i.e. after creating the scenery and after adding or moving objects)
+    virtual void UpdateSpatialIndices() = 0;
+
     virtual const osi3::GroundTruth& GetOsiGroundTruth() const = 0;
 
     //!Returns a map of all Roads with their OSI Id
@@ -407,8 +449,28 @@ public:
 
     SensorView_ptr GetSensorView(osi3::SensorViewConfiguration& conf, int agentId) override;
 
+    SensorView_ptr GetDynamicSensorView(osi3::SensorViewConfiguration& conf, int agentId) override;
+
+    void AppendStaticSensorView(int agentId, std::string& serializedSensorView) override;
+
+    void SerializeStaticContent() override;
+
+    /*!
+     * \brief Appends a serialized GroundTruth as global GroundTruth to a serialized SensorView
+     *
+     * Repeated fields of the appended GroundTruth are merged into (i.e. appended to) those of the SensorView
+     *
+     * \param[in]       serializedGroundTruth   Serialized GroundTruth
+     * \param[in,out]   serializedSensorView    Serialized SensorView to append to
+     */
+    static void AppendGroundTruthToSensorView(const std::string& serializedGroundTruth, std::string& serializedSensorView);
+
     void ResetTemporaryMemory() override;
 
+    void InvalidateMovingObjectIndex() override;
+
+    void UpdateSpatialIndices() override;
+
     const osi3::GroundTruth& GetOsiGroundTruth() const override;
 
     /*!
@@ -421,6 +483,17 @@ public:
      */
     GroundTruth_ptr GetFilteredGroundTruth(const osi3::SensorViewConfiguration& conf, const Interfaces::MovingObject& reference);
 
+    /*!
+     * \brief Adds the objects of the OSI GroundTruth, which are visible for the given SensorViewConfiguration
+     *
+     * \param[in]   conf                The OSI SensorViewConfiguration to be used for filtering
+     * \param[in]   reference           Host of the sensor
+     * \param[out]  target              GroundTruth to add the objects to
+     * \param[in]   withStaticContent   If false, lanes and lane boundaries are not added
+     */
+    void FillFilteredGroundTruth(const osi3::SensorViewConfiguration& conf, const Interfaces::MovingObject& reference,
+                                 osi3::GroundTruth& target, bool withStaticContent);
+
     /*!
      * \brief Retrieves the TrafficSigns located in the given sector (geometric shape)
      *
@@ -703,6 +776,9 @@ protected:
     }
 
 private:
+    //! Creates a OSI SensorView (see GetSensorView and GetDynamicSensorView)
+    SensorView_ptr CreateSensorView(osi3::SensorViewConfiguration& conf, int agentId, bool withStaticContent);
+
     const CallbackInterface* callbacks;
     uint64_t next_free_uid{0};
     std::unordered_map<std::string, Id>         trafficSignIdMapping;
@@ -724,6 +800,17 @@ private:
 
     std::unordered_map<const RoadLaneInterface*, osi3::Lane*> osiLanes;
 
+    //! Spatial indices for the sector queries (static objects are indexed once after they have been added)
+    SpatialIndex<Interfaces::MovingObject>      movingObjectIndex;
+    SpatialIndex<Interfaces::StationaryObject>  stationaryObjectIndex;
+    SpatialIndex<Interfaces::TrafficSign>       trafficSignIndex;
+    SpatialIndex<Interfaces::TrafficLight>      trafficLightIndex;
+    SpatialIndex<Interfaces::RoadMarking>       roadMarkingIndex;
+
+    //! Serialized GroundTruth per lane, indexed by the host vehicle lane flag
+    std::vector<std::pair<Id, std::array<std::string, 2>>> serializedLanes;
+    std::string serializedLaneBoundaries;
+
     RoadGraph roadGraph;
     RoadGraphVertexMapping vertexMapping;
     TurningRates turningRates;
@@ -684,11 +684,12 @@ std::shared_ptr<const LaneMultiStream> WorldDataQuery::CreateLaneMultiStream(con
 {
     const auto& routeElement = get(RouteElement(), roadGraph, start);
     const auto& startLane = GetLaneByOdId(routeElement.roadId, startLaneId, startDistance);
-    if (!startLane.Exists())
-    {
-        return std::make_shared<const LaneMultiStream>(CreateLaneMultiStreamRecursive(roadGraph, start, 0.0, nullptr));
-    }
-    return std::make_shared<const LaneMultiStream>(CreateLaneMultiStreamRecursive(roadGraph, start, 0.0, &startLane));
+    return CreateLaneMultiStream(roadGraph, start, startLane.Exists() ? &startLane : nullptr);
+}
+
+std::shared_ptr<const LaneMultiStream> WorldDataQuery::CreateLaneMultiStream(const RoadGraph& roadGraph, RoadGraphVertex start, const OWL::Lane* startLane) const
+{
+    return std::make_shared<const LaneMultiStream>(CreateLaneMultiStreamRecursive(roadGraph, start, 0.0, startLane));
 }
 
 std::unique_ptr<RoadStream> WorldDataQuery::CreateRoadStream(const std::vector<RouteElement>& route) const
@@ -425,6 +425,14 @@ public:
     //! \return     LaneMultiStream starting with the specified lane and containing all consecutive lanes that are also contained in the given road graph
     std::shared_ptr<const LaneMultiStream> CreateLaneMultiStream(const RoadGraph& roadGraph, RoadGraphVertex start, OWL::OdId startLaneId, double startDistance) const;
 
+    //! Creates a LaneMultiStream that contains the OWL lanes out of a roadGraph.
+    //!
+    //! \param roadGraph        road graph to convert, must be a tree
+    //! \param start            root of the tree
+    //! \param startLane        lane at the root, where the lane stream should start (nullptr, if there is no such lane)
+    //! \return     LaneMultiStream starting with the specified lane and containing all consecutive lanes that are also contained in the given road graph
+    std::shared_ptr<const LaneMultiStream> CreateLaneMultiStream(const RoadGraph& roadGraph, RoadGraphVertex start, const OWL::Lane* startLane) const;
+
     //! \brief Creates a RoadStream from the given route
     //!
     //! \param route    Route containing the OpenDrive ids of the Roads along which the roadStream should flow
@@ -117,6 +117,9 @@ void WorldImplementation::ExtractParameter(ParameterInterface* parameters)
     auto zipperMerge = helper::map::query(boolParameter, "ZipperMerge");
     THROWIFFALSE(zipperMerge.has_value(), "Missing traffic rule ZipperMerge")
     worldParameter.trafficRules.zipperMerge = zipperMerge.value();
+
+    auto numberOfThreads = helper::map::query(intParameter, "NumberOfThreads");
+    agentNetwork.SetNumberOfThreads(numberOfThreads.value_or(1));
 }
 
 void WorldImplementation::Reset()
@@ -128,6 +131,10 @@ void WorldImplementation::Reset()
     worldData.Reset();
     worldParameter.Reset();
     agentNetwork.Clear();
+    {
+        std::lock_guard<std::mutex> lock(routeStreamCachesMutex);
+        routeStreamCaches.clear();
+    }
     worldObjects.clear();
     repository.Reset();
     worldObjects.insert(worldObjects.end(), trafficObjects.begin(), trafficObjects.end());
@@ -174,6 +181,9 @@ void WorldImplementation::RemoveAgent(const AgentInterface* agent)
 
 void WorldImplementation::PublishGlobalData(int timestamp)
 {
+    // Agents spawned since the last synchronization have to be indexed before the agents are updated
+    worldData.UpdateSpatialIndices();
+
     agentNetwork.PublishGlobalData(
         [&](openpass::type::EntityId id, openpass::type::FlatParameterKey key, openpass::type::FlatParameterValue value)
         {
@@ -189,12 +199,15 @@ void WorldImplementation::PublishGlobalData(int timestamp)
 
 void WorldImplementation::SyncGlobalData(int timestamp)
 {
-    
-    for (auto& [id, lane] : worldData.GetLanes())
+    // Only lanes an agent is currently assigned to contain moving objects,
+    // so all other lanes keep their (stationary) assignments untouched
+    for (auto& agent : agentNetwork.GetAgents())
     {
-        lane->ClearMovingObjects();
+        agent.ClearAssignedLanes();
     }
     agentNetwork.SyncGlobalData();
+    worldData.InvalidateMovingObjectIndex();
+    worldData.UpdateSpatialIndices();
 
     trafficLightNetwork.UpdateStates(timestamp);
     worldData.ResetTemporaryMemory();
@@ -213,6 +226,8 @@ bool WorldImplementation::CreateScenery(const SceneryInterface* scenery, const S
     localizer.Init();
     sceneryConverter->ConvertObjects();
     InitTrafficObjects();
+    worldData.SerializeStaticContent();
+    worldData.UpdateSpatialIndices();
 
     RoadNetworkBuilder networkBuilder(*scenery);
     auto [roadGraph, vertexMapping] = networkBuilder.Build();
@@ -255,42 +270,42 @@ double WorldImplementation::GetFriction() const
 
 RouteQueryResult<std::vector<CommonTrafficSign::Entity>> WorldImplementation::GetTrafficSignsInRange(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double startDistance, double searchRange) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, startDistance);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, startDistance);
     double startDistanceOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, startDistance);
     return worldDataQuery.GetTrafficSignsInRange(*laneMultiStream, startDistanceOnStream, searchRange);
 }
 
 RouteQueryResult<std::vector<CommonTrafficSign::Entity> > WorldImplementation::GetRoadMarkingsInRange(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double startDistance, double searchRange) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, startDistance);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, startDistance);
     double startDistanceOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, startDistance);
     return worldDataQuery.GetRoadMarkingsInRange(*laneMultiStream, startDistanceOnStream, searchRange);
 }
 
 RouteQueryResult<std::vector<CommonTrafficLight::Entity>> WorldImplementation::GetTrafficLightsInRange(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double startDistance, double searchRange) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, startDistance);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, startDistance);
     double startDistanceOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, startDistance);
     return worldDataQuery.GetTrafficLightsInRange(*laneMultiStream, startDistanceOnStream, searchRange);
 }
 
 RouteQueryResult<std::vector<LaneMarking::Entity> > WorldImplementation::GetLaneMarkings(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double startDistance, double range, Side side) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, startDistance);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, startDistance);
     double startDistanceOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, startDistance);
     return worldDataQuery.GetLaneMarkings(*laneMultiStream, startDistanceOnStream, range, side);
 }
 
 RouteQueryResult<RelativeWorldView::Roads> WorldImplementation::GetRelativeJunctions(const RoadGraph &roadGraph, RoadGraphVertex startNode, double startDistance, double range) const
 {
-    const auto roadMultiStream = worldDataQuery.CreateRoadMultiStream(roadGraph, startNode);
+    const auto roadMultiStream = GetRoadMultiStream(roadGraph, startNode);
     double startDistanceOnStream = roadMultiStream->GetPositionByVertexAndS(startNode, startDistance);
     return worldDataQuery.GetRelativeJunctions(*roadMultiStream, startDistanceOnStream, range);
 }
 
 RouteQueryResult<RelativeWorldView::Roads> WorldImplementation::GetRelativeRoads(const RoadGraph& roadGraph, RoadGraphVertex startNode, double startDistance, double range) const
 {
-    const auto roadMultiStream = worldDataQuery.CreateRoadMultiStream(roadGraph, startNode);
+    const auto roadMultiStream = GetRoadMultiStream(roadGraph, startNode);
     double startDistanceOnStream = roadMultiStream->GetPositionByVertexAndS(startNode, startDistance);
     return worldDataQuery.GetRelativeRoads(*roadMultiStream, startDistanceOnStream, range);
 }
@@ -336,6 +351,52 @@ std::unique_ptr<RoadStreamInterface> WorldImplementation::GetRoadStream(const st
     return worldDataQuery.CreateRoadStream(route);
 }
 
+std::shared_ptr<RouteStreamCacheInterface> WorldImplementation::CreateRouteStreamCache(const RoadGraph& roadGraph) const
+{
+    auto routeStreamCache = std::make_shared<RouteStreamCache>(roadGraph, worldDataQuery);
+
+    std::lock_guard<std::mutex> lock(routeStreamCachesMutex);
+    routeStreamCaches[&roadGraph] = routeStreamCache;
+    return routeStreamCache;
+}
+
+std::shared_ptr<RouteStreamCache> WorldImplementation::GetRouteStreamCache(const RoadGraph& roadGraph) const
+{
+    std::lock_guard<std::mutex> lock(routeStreamCachesMutex);
+
+    const auto entry = routeStreamCaches.find(&roadGraph);
+    if (entry == routeStreamCaches.end())
+    {
+        return nullptr;
+    }
+
+    auto routeStreamCache = entry->second.lock();
+    if (!routeStreamCache)
+    {
+        // owner of the cache has been destroyed, the address may be reused by another road graph
+        routeStreamCaches.erase(entry);
+    }
+    return routeStreamCache;
+}
+
+std::shared_ptr<const LaneMultiStream> WorldImplementation::GetLaneMultiStream(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double startDistance) const
+{
+    if (const auto routeStreamCache = GetRouteStreamCache(roadGraph))
+    {
+        return routeStreamCache->GetLaneMultiStream(startNode, laneId, startDistance);
+    }
+    return worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, startDistance);
+}
+
+std::shared_ptr<const RoadMultiStream> WorldImplementation::GetRoadMultiStream(const RoadGraph& roadGraph, RoadGraphVertex startNode) const
+{
+    if (const auto routeStreamCache = GetRouteStreamCache(roadGraph))
+    {
+        return routeStreamCache->GetRoadMultiStream(startNode);
+    }
+    return worldDataQuery.CreateRoadMultiStream(roadGraph, startNode);
+}
+
 AgentInterface* WorldImplementation::GetEgoAgent()
 {
     for (auto& agent : agentNetwork.GetAgents())
@@ -364,20 +425,20 @@ AgentInterface* WorldImplementation::GetAgentByName(const std::string& scenarioN
 
 RouteQueryResult<std::optional<GlobalRoadPosition>> WorldImplementation::ResolveRelativePoint(const RoadGraph &roadGraph, RoadGraphVertex startNode, ObjectPointRelative relativePoint, const WorldObjectInterface& object) const
 {
-    const auto roadMultiStream = worldDataQuery.CreateRoadMultiStream(roadGraph, startNode);
+    const auto roadMultiStream = GetRoadMultiStream(roadGraph, startNode);
     return worldDataQuery.ResolveRelativePoint(*roadMultiStream, relativePoint, object.GetTouchedRoads());
 }
 
 RouteQueryResult<Obstruction> WorldImplementation::GetObstruction(const RoadGraph &roadGraph, RoadGraphVertex startNode, const GlobalRoadPosition &ownPosition,
                                                                   const std::map<ObjectPoint, Common::Vector2d> &points, const RoadIntervals &touchedRoads) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, ownPosition.laneId, ownPosition.roadPosition.s);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, ownPosition.laneId, ownPosition.roadPosition.s);
     return worldDataQuery.GetObstruction(*laneMultiStream, ownPosition.roadPosition.t, points, touchedRoads);
 }
 
 RouteQueryResult<RelativeWorldView::Lanes> WorldImplementation::GetRelativeLanes(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double distance, double range, bool includeOncoming) const
 {
-    const auto roadMultiStream = worldDataQuery.CreateRoadMultiStream(roadGraph, startNode);
+    const auto roadMultiStream = GetRoadMultiStream(roadGraph, startNode);
     double startDistanceOnStream = roadMultiStream->GetPositionByVertexAndS(startNode, distance);
 
     return worldDataQuery.GetRelativeLanes(*roadMultiStream, startDistanceOnStream, laneId, range, includeOncoming);
@@ -385,7 +446,7 @@ RouteQueryResult<RelativeWorldView::Lanes> WorldImplementation::GetRelativeLanes
 
 RouteQueryResult<std::optional<int> > WorldImplementation::GetRelativeLaneId(const RoadGraph &roadGraph, RoadGraphVertex startNode, int laneId, double distance, GlobalRoadPositions targetPosition) const
 {
-    const auto roadMultiStream = worldDataQuery.CreateRoadMultiStream(roadGraph, startNode);
+    const auto roadMultiStream = GetRoadMultiStream(roadGraph, startNode);
     double startDistanceOnStream = roadMultiStream->GetPositionByVertexAndS(startNode, distance);
 
     return worldDataQuery.GetRelativeLaneId(*roadMultiStream, startDistanceOnStream, laneId, targetPosition);
@@ -393,7 +454,7 @@ RouteQueryResult<std::optional<int> > WorldImplementation::GetRelativeLaneId(con
 
 RouteQueryResult<AgentInterfaces > WorldImplementation::GetAgentsInRange(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double startDistance, double backwardRange, double forwardRange) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, startDistance);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, startDistance);
     double startDistanceOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, startDistance);
     const auto queryResult = worldDataQuery.GetObjectsOfTypeInRange<OWL::Interfaces::MovingObject>(*laneMultiStream, startDistanceOnStream - backwardRange, startDistanceOnStream + forwardRange);
     RouteQueryResult<AgentInterfaces> result;
@@ -406,7 +467,7 @@ RouteQueryResult<AgentInterfaces > WorldImplementation::GetAgentsInRange(const R
 
 RouteQueryResult<std::vector<const WorldObjectInterface*>> WorldImplementation::GetObjectsInRange(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double startDistance, double backwardRange, double forwardRange) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, startDistance);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, startDistance);
     double startDistanceOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, startDistance);
     const auto queryResult = worldDataQuery.GetObjectsOfTypeInRange<OWL::Interfaces::WorldObject>(*laneMultiStream, startDistanceOnStream - backwardRange, startDistanceOnStream + forwardRange);
     RouteQueryResult<std::vector<const WorldObjectInterface*>> result;
@@ -480,7 +541,7 @@ double WorldImplementation::GetLaneCurvature(std::string roadId, int laneId, dou
 
 RouteQueryResult<std::optional<double> > WorldImplementation::GetLaneCurvature(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double position, double distance) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, position);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, position);
     double positionOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, position);
     return worldDataQuery.GetLaneCurvature(*laneMultiStream, positionOnStream + distance);
 }
@@ -497,7 +558,7 @@ double WorldImplementation::GetLaneWidth(std::string roadId, int laneId, double
 
 RouteQueryResult<std::optional<double>> WorldImplementation::GetLaneWidth(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double position, double distance) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, position);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, position);
     double positionOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, position);
     return worldDataQuery.GetLaneWidth(*laneMultiStream, positionOnStream + distance);
 }
@@ -514,7 +575,7 @@ double WorldImplementation::GetLaneDirection(std::string roadId, int laneId, dou
 
 RouteQueryResult<std::optional<double> > WorldImplementation::GetLaneDirection(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double position, double distance) const
 {
-    const auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, position);
+    const auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, position);
     double positionOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, position);
     return worldDataQuery.GetLaneDirection(*laneMultiStream, positionOnStream + distance);
 }
@@ -527,7 +588,7 @@ RouteQueryResult<double> WorldImplementation::GetDistanceToEndOfLane(const RoadG
 
 RouteQueryResult<double> WorldImplementation::GetDistanceToEndOfLane(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double initialSearchDistance, double maximumSearchLength, const LaneTypes& laneTypes) const
 {
-    auto laneMultiStream = worldDataQuery.CreateLaneMultiStream(roadGraph, startNode, laneId, initialSearchDistance);
+    auto laneMultiStream = GetLaneMultiStream(roadGraph, startNode, laneId, initialSearchDistance);
     auto initialPositionOnStream = laneMultiStream->GetPositionByVertexAndS(startNode, initialSearchDistance);
     return worldDataQuery.GetDistanceToEndOfLane(*laneMultiStream, initialPositionOnStream, maximumSearchLength, laneTypes);
 }
@@ -603,7 +664,7 @@ void WorldImplementation::InitTrafficObjects()
 RouteQueryResult<std::optional<double>> WorldImplementation::GetDistanceBetweenObjects(const RoadGraph& roadGraph, RoadGraphVertex startNode,
                                                                                       double ownPosition, const GlobalRoadPositions &target) const
 {
-    const auto roadStream = worldDataQuery.CreateRoadMultiStream(roadGraph, startNode);
+    const auto roadStream = GetRoadMultiStream(roadGraph, startNode);
     const auto ownStreamPosition = roadStream->GetPositionByVertexAndS(startNode, ownPosition);
     return worldDataQuery.GetDistanceBetweenObjects(*roadStream, ownStreamPosition, target);
 }
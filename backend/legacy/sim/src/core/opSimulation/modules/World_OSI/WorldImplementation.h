@@ -14,6 +14,7 @@
 #pragma once
 
 #include <algorithm>
+#include <mutex>
 #include "include/worldInterface.h"
 #include "AgentNetwork.h"
 #include "SceneryConverter.h"
@@ -24,6 +25,7 @@
 #include "EntityRepository.h"
 #include "WorldData.h"
 #include "WorldDataQuery.h"
+#include "RouteStreamCache.h"
 #include "include/sceneryDynamicsInterface.h"
 
 namespace osi3
@@ -232,6 +234,8 @@ public:
 
     std::unique_ptr<RoadStreamInterface> GetRoadStream(const std::vector<RouteElement>& route) const override;
 
+    std::shared_ptr<RouteStreamCacheInterface> CreateRouteStreamCache(const RoadGraph& roadGraph) const override;
+
     double GetFriction() const override;
 
     virtual void *GetGlobalDrivingView() const override
@@ -311,6 +315,15 @@ protected:
 private:
     void InitTrafficObjects();
 
+    //! Returns the LaneMultiStream along the road graph (cached, if a RouteStreamCache exists for the road graph)
+    std::shared_ptr<const LaneMultiStream> GetLaneMultiStream(const RoadGraph& roadGraph, RoadGraphVertex startNode, int laneId, double startDistance) const;
+
+    //! Returns the RoadMultiStream along the road graph (cached, if a RouteStreamCache exists for the road graph)
+    std::shared_ptr<const RoadMultiStream> GetRoadMultiStream(const RoadGraph& roadGraph, RoadGraphVertex startNode) const;
+
+    //! Returns the RouteStreamCache of the road graph (nullptr, if there is none)
+    std::shared_ptr<RouteStreamCache> GetRouteStreamCache(const RoadGraph& roadGraph) const;
+
     OWL::WorldData worldData;
     WorldDataQuery worldDataQuery{worldData};
     World::Localization::Localizer localizer{worldData};
@@ -338,4 +351,9 @@ private:
     DataBufferWriteInterface* dataBuffer;
     openpass::entity::Repository repository;
     std::unique_ptr<SceneryConverter> sceneryConverter;
+
+    //! Caches of the road graphs, which are owned by the creator of the cache (e.g. the EgoAgent)
+    //! Agents executed concurrently register and look up their caches, so the map is guarded by a mutex
+    mutable std::unordered_map<const RoadGraph*, std::weak_ptr<RouteStreamCache>> routeStreamCaches;
+    mutable std::mutex routeStreamCachesMutex;
 };
@@ -35,7 +35,12 @@ void EgoAgent::SetRoadGraph(const RoadGraph&& roadGraph, RoadGraphVertex current
 
 void EgoAgent::Update()
 {
+    const auto previousRoot = rootOfWayToTargetGraph;
     UpdatePositionInGraph();
+    if (rootOfWayToTargetGraph != previousRoot)
+    {
+        ClearRouteStreamCache();
+    }
     if (graphValid)
     {
         //buffer mainLocatePosition to prevent multiple map lookups (yields better performance)
@@ -581,6 +586,20 @@ void EgoAgent::SetWayToTarget(RoadGraphVertex targetVertex)
         }
     }
     rootOfWayToTargetGraph = vertex1;
+
+    if (!routeStreamCache)
+    {
+        routeStreamCache = world->CreateRouteStreamCache(wayToTarget);
+    }
+    ClearRouteStreamCache();
+}
+
+void EgoAgent::ClearRouteStreamCache()
+{
+    if (routeStreamCache)
+    {
+        routeStreamCache->Clear();
+    }
 }
 
 template<>
@@ -114,6 +114,9 @@ private:
 
     void SetWayToTarget(RoadGraphVertex targetVertex);
 
+    //! Discards the streams along wayToTarget, which the world cached for previous queries
+    void ClearRouteStreamCache();
+
     const AgentInterface* agent;
     const WorldInterface* world;
     bool graphValid{false};
@@ -124,4 +127,5 @@ private:
     std::vector<RouteElement> wayToTargetRoute{}; //! same information as wayToTarget but as vector
     std::vector<RoadGraphVertex> alternatives{};
     std::optional<GlobalRoadPosition> mainLocatePosition;
+    std::shared_ptr<RouteStreamCacheInterface> routeStreamCache{}; //! streams along wayToTarget, reused by the queries of the world
 };
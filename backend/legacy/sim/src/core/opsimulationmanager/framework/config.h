@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <optional>
 #include <vector>
@@ -38,12 +39,20 @@ public:
         std::optional<std::string> logFileOpSimulationManager,
         std::optional<std::string> simulation,
         std::optional<std::string> libraries,
-        SimulationConfigs simulationConfigs) :
+        SimulationConfigs simulationConfigs,
+        std::optional<int> maxProcesses = std::nullopt,
+        std::optional<int> memoryLimit = std::nullopt,
+        std::optional<int> retries = std::nullopt,
+        std::optional<int> invocationsPerJob = std::nullopt) :
         logLevel{CheckOrDefault(logLevel.value_or(defaultLogLevel))},
         logFileOpSimulationManager{logFileOpSimulationManager.value_or(defaultLogFileOpSimulationManager)},
         simulation{simulation.value_or(defaultSimulation)},
         libraries{libraries.value_or(defaultLibraries)},
-        simulationConfigs{simulationConfigs}
+        simulationConfigs{simulationConfigs},
+        maxProcesses{std::max(0, maxProcesses.value_or(defaultMaxProcesses))},
+        memoryLimit{std::max(0, memoryLimit.value_or(defaultMemoryLimit))},
+        retries{std::max(0, retries.value_or(defaultRetries))},
+        invocationsPerJob{std::max(0, invocationsPerJob.value_or(defaultInvocationsPerJob))}
     {}
 
     Config() :
@@ -51,7 +60,11 @@ public:
         logFileOpSimulationManager{defaultLogFileOpSimulationManager},
         simulation{defaultSimulation},
         libraries{defaultLibraries},
-        simulationConfigs{}
+        simulationConfigs{},
+        maxProcesses{defaultMaxProcesses},
+        memoryLimit{defaultMemoryLimit},
+        retries{defaultRetries},
+        invocationsPerJob{defaultInvocationsPerJob}
     {}
 
     const int logLevel;
@@ -59,12 +72,20 @@ public:
     const std::string simulation;
     const std::string libraries;
     const SimulationConfigs simulationConfigs;
+    const int maxProcesses;         //!< maximum number of concurrent simulation processes (0: ideal thread count)
+    const int memoryLimit;          //!< maximum resident memory of all simulation processes [MiB] (0: unlimited)
+    const int retries;              //!< number of restarts of a failed simulation process
+    const int invocationsPerJob;    //!< maximum number of invocations per simulation process (0: no splitting)
 
 private:
     static constexpr int defaultLogLevel = 0;
     static constexpr char defaultLogFileOpSimulationManager[] = "opSimulationManager.log";
     static constexpr char defaultSimulation[] = "opSimulation";
     static constexpr char defaultLibraries[] = "lib";
+    static constexpr int defaultMaxProcesses = 0;
+    static constexpr int defaultMemoryLimit = 0;
+    static constexpr int defaultRetries = 0;
+    static constexpr int defaultInvocationsPerJob = 0;
 
     //-------------------------------------------------------------------------
     //! \brief Checks if the passed value is in between the minimum and maximum
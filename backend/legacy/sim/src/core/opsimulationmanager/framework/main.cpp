@@ -28,11 +28,13 @@
 #include <QCoreApplication>
 #include <QDebug>
 #include <QDir>
+#include <QFileInfo>
 #include <QLibrary>
 #include <QProcess>
 #include <QThreadPool>
 #include <QtConcurrent>
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <sstream>
@@ -43,11 +45,10 @@
 #include "config.h"
 #include "../importer/configImporter.h"
 #include "processManager.h"
+#include "simulationJobs.h"
 
 using namespace SimulationManager;
 
-using Arguments = std::vector<std::pair<std::string, std::string>>;
-
 //-----------------------------------------------------------------------------
 //! \brief Parses command line arguments for the opSimulationManager config file.
 //! \param[in] arguments The list of command line arguments to parse.
@@ -85,6 +86,18 @@ Configuration::Config ParseConfig(const QString& opSimulationManagerConfigFile);
 //! \brief Retrieve the name of the simulations executable
 //-----------------------------------------------------------------------------
 std::string GetExecutable(std::string simulation);
+
+//-----------------------------------------------------------------------------
+//! \brief Gets the jobs of a simulation, see SplitIntoJobs.
+//!        The simulation is not split, if its number of invocations cannot be read.
+//! \param[in] arguments          arguments of the whole simulation
+//! \param[in] simulationConfig   configuration of the simulation
+//! \param[in] invocationsPerJob  maximum number of invocations per job (0: no splitting)
+//! \returns the arguments of each job
+//-----------------------------------------------------------------------------
+static std::vector<Arguments> GetJobs(const Arguments& arguments,
+                                      const Configuration::SimulationConfig& simulationConfig,
+                                      int invocationsPerJob);
 #else
 typedef int (*SimulationRunFunction)(int argc, char* argv[]);
 
@@ -124,6 +137,18 @@ extern "C" Q_DECL_EXPORT int run(int argc, char* argv[])
     LOG_INTERN(LogLevel::DebugCore) << "libraries: " << opSimulationManagerConfig.libraries;
     LOG_INTERN(LogLevel::DebugCore) << "number of simulations: " << opSimulationManagerConfig.simulationConfigs.size();
 
+    LOG_INTERN(LogLevel::DebugCore) << "max processes: " << opSimulationManagerConfig.maxProcesses;
+    LOG_INTERN(LogLevel::DebugCore) << "memory limit: " << opSimulationManagerConfig.memoryLimit << " MiB";
+    LOG_INTERN(LogLevel::DebugCore) << "retries: " << opSimulationManagerConfig.retries;
+    LOG_INTERN(LogLevel::DebugCore) << "invocations per job: " << opSimulationManagerConfig.invocationsPerJob;
+
+    #ifndef USESIMULATIONLIBRARY
+    ProcessManager& processManager = ProcessManager::getInstance();
+    processManager.SetMaxProcessCount(opSimulationManagerConfig.maxProcesses);
+    processManager.SetMemoryLimit(static_cast<qint64>(opSimulationManagerConfig.memoryLimit) * 1024 * 1024);
+    processManager.SetRetries(opSimulationManagerConfig.retries);
+    #endif // USESIMULATIONLIBRARY
+
     for (const auto& simulationConfig : opSimulationManagerConfig.simulationConfigs)
     {
         CreateResultPathIfNecessary(simulationConfig.results);
@@ -139,22 +164,17 @@ extern "C" Q_DECL_EXPORT int run(int argc, char* argv[])
 
         #ifndef USESIMULATIONLIBRARY
 
-        if (ProcessManager::getInstance().StartProcess(simulation, arguments))
-        {
-            std::stringstream strStream;
-            for (const auto& [command, value] : arguments)
-            {
-                strStream << command << " " << value << "\n";
-            }
-            LOG_INTERN(LogLevel::Info) << simulation << " started with \n" << strStream.str() << std::endl;
-        }
-        else
+        for (const auto& jobArguments : GetJobs(arguments, simulationConfig, opSimulationManagerConfig.invocationsPerJob))
         {
-            LOG_INTERN(LogLevel::Error) << simulation << " not started, check path.";
-            exit(EXIT_FAILURE);
+            processManager.EnqueueProcess(simulation, jobArguments);
         }
     }
-    ProcessManager::getInstance().WaitAndClear();
+
+    if (!processManager.WaitAndClear())
+    {
+        LOG_INTERN(LogLevel::Error) << "not all simulations finished successfully";
+        return EXIT_FAILURE;
+    }
 
         #else
         QtConcurrent::run([arguments, &argv, &simulation]
@@ -232,6 +252,26 @@ Configuration::Config ParseConfig(const QString& opSimulationManagerConfigFile)
 }
 
 #ifndef USESIMULATIONLIBRARY
+std::vector<Arguments> GetJobs(const Arguments& arguments,
+                               const Configuration::SimulationConfig& simulationConfig,
+                               int invocationsPerJob)
+{
+    if (invocationsPerJob == 0)
+    {
+        return {arguments};
+    }
+
+    const auto numberOfInvocations = Configuration::ConfigImporter::ImportNumberOfInvocations(simulationConfig.configs);
+    if (!numberOfInvocations.has_value())
+    {
+        LOG_INTERN(LogLevel::Warning) << "could not read the number of invocations from " << simulationConfig.configs
+                                      << ", simulation is not split";
+        return {arguments};
+    }
+
+    return SplitIntoJobs(arguments, simulationConfig, numberOfInvocations.value(), invocationsPerJob);
+}
+
 std::string GetExecutable(std::string simulation)
 {
     #ifndef USESIMULATIONLIBRARY
@@ -11,17 +11,33 @@
 
 #include "processManager.h"
 #include <algorithm>
+#include <QFile>
+#include <QThread>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+//! Interval for sampling the resident memory of the running processes [ms]
+static constexpr int MEMORY_SAMPLING_INTERVAL = 500;
 
 ProcessManager::ProcessManager(QObject* parent):
     QObject(parent)
 {
     idealProcessCount = QThread::idealThreadCount();
+
+    memoryTimer.setInterval(MEMORY_SAMPLING_INTERVAL);
+    connect(&memoryTimer, &QTimer::timeout, this, [this]
+    {
+        SampleMemory();
+        StartPendingJobs();
+    });
 }
 
 void ProcessManager::RemoveProcess(QProcess* process)
 {
     processMap.remove(process);
-    delete process;
+    process->deleteLater();
 }
 
 ProcessManager& ProcessManager::getInstance()
@@ -30,66 +46,215 @@ ProcessManager& ProcessManager::getInstance()
     return instance;
 }
 
-bool ProcessManager::StartProcess(const std::string& processPath,
-                                  const std::vector<std::pair<std::string, std::string>>& arguments)
+void ProcessManager::SetMaxProcessCount(int maxProcessCount)
 {
-    auto qProcessPath = QString::fromStdString(processPath);
+    idealProcessCount = maxProcessCount > 0 ? maxProcessCount : QThread::idealThreadCount();
+}
+
+void ProcessManager::SetMemoryLimit(qint64 memoryLimit)
+{
+    this->memoryLimit = std::max<qint64>(0, memoryLimit);
+}
+
+void ProcessManager::SetRetries(int retries)
+{
+    this->retries = std::max(0, retries);
+}
+
+void ProcessManager::EnqueueProcess(const std::string& processPath,
+                                    const std::vector<std::pair<std::string, std::string>>& arguments)
+{
+    Job job;
+    job.processPath = QString::fromStdString(processPath);
 
-    QStringList qArguments;
     for (const std::pair<std::string, std::string>& argument : arguments)
     {
-        qArguments << QString::fromStdString(argument.first) << QString::fromStdString(argument.second);
+        job.arguments << QString::fromStdString(argument.first) << QString::fromStdString(argument.second);
     }
 
-    while (processMap.size() > idealProcessCount)
+    pendingJobs.push_back(job);
+}
+
+bool ProcessManager::WaitAndClear()
+{
+    StartPendingJobs();
+
+    if (!processMap.isEmpty() || !pendingJobs.empty())
     {
-        processMap.begin().key()->waitForFinished(1);
+        QEventLoop loop;
+        eventLoop = &loop;
+
+        if (memoryLimit > 0)
+        {
+            memoryTimer.start();
+        }
+
+        loop.exec();
+
+        memoryTimer.stop();
+        eventLoop = nullptr;
     }
 
-    QProcess* newProcess = new QProcess();
-    newProcess->start(qProcessPath, qArguments);
+    const bool result = success;
+    success = true;
+    return result;
+}
+
+void ProcessManager::KillAll()
+{
+    pendingJobs.clear();
+
+    QMapIterator<QProcess*, Job> processMapIterator(processMap);
+    while (processMapIterator.hasNext())
+    {
+        processMapIterator.next();
+        QProcess* process = processMapIterator.key();
+        disconnect(process, nullptr, this, nullptr);
+        process->kill();
+        process->waitForFinished(-1);
+        delete process;
+    }
+    processMap.clear();
+
+    QuitIfDone();
+}
+
+void ProcessManager::StartPendingJobs()
+{
+    while (!pendingJobs.empty() && IsAdmissible())
+    {
+        const Job job = pendingJobs.front();
+        pendingJobs.pop_front();
+        Start(job);
+
+        // the memory of a new process is unknown until the next sample, so start only one at a time
+        if (memoryLimit > 0)
+        {
+            break;
+        }
+    }
+
+    QuitIfDone();
+}
 
-    if (newProcess->processId() == 0)
+bool ProcessManager::IsAdmissible() const
+{
+    if (processMap.size() >= idealProcessCount)
     {
-        LOG_INTERN(LogLevel::Error) << processPath << " not started, check path.";
         return false;
     }
 
-    LOG_INTERN(LogLevel::DebugCore) << std::endl << "### process start pid: " <<
-                                    QString::number(newProcess->processId()).toStdString() << "###";
+    if (memoryLimit == 0 || processMap.isEmpty())
+    {
+        return true;
+    }
 
-    connect(newProcess, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
-            [this, newProcess](int exitCode, QProcess::ExitStatus exitStatus)
+    qint64 residentMemory = peakResidentMemory;
+    for (const Job& job : processMap)
     {
-        Q_UNUSED(exitCode);
-        Q_UNUSED(exitStatus);
-        RemoveProcess(newProcess);
+        residentMemory += std::max(job.residentMemory, peakResidentMemory);
+    }
+
+    return residentMemory <= memoryLimit;
+}
+
+void ProcessManager::Start(const Job& job)
+{
+    QProcess* process = new QProcess();
+
+    connect(process, static_cast<void(QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished), this,
+            [this, process](int exitCode, QProcess::ExitStatus exitStatus)
+    {
+        OnFinished(process, exitCode, exitStatus);
     });
 
-    processMap.insert(newProcess, newProcess->processId());
+    connect(process, &QProcess::errorOccurred, this, [this, process](QProcess::ProcessError error)
+    {
+        if (error == QProcess::FailedToStart)
+        {
+            OnFailedToStart(process);
+        }
+    });
 
-    return true;
+    connect(process, &QProcess::started, this, [process, job]
+    {
+        LOG_INTERN(LogLevel::DebugCore) << std::endl << "### process start pid: " <<
+                                        QString::number(process->processId()).toStdString() << "###";
+        LOG_INTERN(LogLevel::Info) << job.processPath.toStdString() << " started with " <<
+                                   job.arguments.join(" ").toStdString();
+    });
+
+    processMap.insert(process, job);
+    process->start(job.processPath, job.arguments);
 }
 
-void ProcessManager::WaitAndClear()
+void ProcessManager::OnFinished(QProcess* process, int exitCode, QProcess::ExitStatus exitStatus)
 {
-    QMapIterator<QProcess*, int> processMapIterator(processMap);
-    while (processMapIterator.hasNext())
+    Job job = processMap.value(process);
+    RemoveProcess(process);
+
+    if (exitStatus == QProcess::CrashExit || exitCode != 0)
     {
-        processMapIterator.next();
-        QProcess* process = processMapIterator.key();
-        process->waitForFinished(-1); //default timeout 30s, -1 :infinity
+        const std::string command = job.processPath.toStdString() + " " + job.arguments.join(" ").toStdString();
+
+        if (job.attempt < retries)
+        {
+            LOG_INTERN(LogLevel::Warning) << command << " failed (exit code " << exitCode << "), restarting";
+            ++job.attempt;
+            job.residentMemory = 0;
+            pendingJobs.push_front(job);
+        }
+        else
+        {
+            LOG_INTERN(LogLevel::Error) << command << " failed (exit code " << exitCode << ")";
+            success = false;
+        }
     }
+
+    StartPendingJobs();
 }
 
-void ProcessManager::KillAll()
+void ProcessManager::OnFailedToStart(QProcess* process)
 {
-    QMapIterator<QProcess*, int> processMapIterator(processMap);
-    while (processMapIterator.hasNext())
+    LOG_INTERN(LogLevel::Error) << processMap.value(process).processPath.toStdString() << " not started, check path.";
+    RemoveProcess(process);
+    success = false;
+
+    StartPendingJobs();
+}
+
+void ProcessManager::SampleMemory()
+{
+    for (auto job = processMap.begin(); job != processMap.end(); ++job)
     {
-        processMapIterator.next();
-        QProcess* process = processMapIterator.key();
-        process->kill();
-        RemoveProcess(process);
+        job->residentMemory = GetResidentMemory(job.key()->processId());
+        peakResidentMemory = std::max(peakResidentMemory, job->residentMemory);
+    }
+}
+
+void ProcessManager::QuitIfDone()
+{
+    if (eventLoop && processMap.isEmpty() && pendingJobs.empty())
+    {
+        eventLoop->quit();
+    }
+}
+
+qint64 ProcessManager::GetResidentMemory(qint64 processId)
+{
+#ifdef __linux__
+    QFile statm(QString("/proc/%1/statm").arg(processId));
+    if (processId > 0 && statm.open(QIODevice::ReadOnly))
+    {
+        const auto pages = QString(statm.readAll()).split(' ');
+        if (pages.size() > 1)
+        {
+            return pages[1].toLongLong() * sysconf(_SC_PAGESIZE);
+        }
     }
+#else
+    Q_UNUSED(processId);
+#endif
+
+    return 0;
 }
@@ -11,14 +11,26 @@
 
 #pragma once
 
+#include <QEventLoop>
 #include <QObject>
-#include <QThread>
 #include <QProcess>
 #include <QMap>
+#include <QStringList>
+#include <QTimer>
+#include <deque>
 #include <list>
 #include <string>
+#include <utility>
+#include <vector>
 #include "common/log.h"
 
+//! Queue of simulation processes
+//!
+//! Enqueued processes are started in order as soon as a slot is free. Finished processes are
+//! reported by the event loop, so waiting does not occupy a core. If a memory limit is set, a
+//! process is only admitted while the resident memory of the running processes (each estimated
+//! with at least the highest resident memory observed for a single process) leaves room for
+//! another one. Failed processes are restarted up to the configured number of retries.
 class ProcessManager : public QObject
 {
     Q_OBJECT
@@ -31,8 +43,22 @@ public:
     ProcessManager& operator=(ProcessManager&&) = delete;
     virtual ~ProcessManager() { KillAll(); }
 
-    bool StartProcess(const std::string& processPath, const std::vector<std::pair<std::string, std::string>>& arguments);
-    void WaitAndClear();
+    //! Sets the maximum number of concurrent processes (0: ideal thread count)
+    void SetMaxProcessCount(int maxProcessCount);
+
+    //! Sets the maximum resident memory of all running processes [bytes] (0: unlimited)
+    void SetMemoryLimit(qint64 memoryLimit);
+
+    //! Sets the number of restarts of a failed process
+    void SetRetries(int retries);
+
+    //! Enqueues a process, which is started as soon as a slot is free
+    void EnqueueProcess(const std::string& processPath, const std::vector<std::pair<std::string, std::string>>& arguments);
+
+    //! Executes all enqueued processes and waits for them to finish
+    //! \return false, if a process could not be started or failed after all retries
+    bool WaitAndClear();
+
     void KillAll();
 
 signals:
@@ -40,9 +66,47 @@ signals:
 public slots:
 
 private:
+    //! Process to execute
+    struct Job
+    {
+        QString processPath;
+        QStringList arguments;
+        int attempt{0};                 //!< number of previous failed executions
+        qint64 residentMemory{0};       //!< last sampled resident memory of the running process [bytes]
+    };
+
     ProcessManager(QObject* parent = nullptr);
+
+    //! Starts enqueued jobs as long as they are admissible
+    void StartPendingJobs();
+
+    //! Checks the process count and the memory limit for one more process
+    bool IsAdmissible() const;
+
+    void Start(const Job& job);
+    void OnFinished(QProcess* process, int exitCode, QProcess::ExitStatus exitStatus);
+    void OnFailedToStart(QProcess* process);
+
+    //! Updates the resident memory of all running processes
+    void SampleMemory();
+
+    //! Quits waiting, if all jobs are done
+    void QuitIfDone();
+
     void RemoveProcess(QProcess* process);
 
+    //! Returns the resident memory of a process [bytes] (0 if not available on this platform)
+    static qint64 GetResidentMemory(qint64 processId);
+
     int idealProcessCount;
-    QMap<QProcess*, int> processMap;
+    qint64 memoryLimit{0};
+    int retries{0};
+
+    std::deque<Job> pendingJobs;
+    QMap<QProcess*, Job> processMap;
+    qint64 peakResidentMemory{0};   //!< highest resident memory of a single process observed so far [bytes]
+    bool success{true};
+
+    QTimer memoryTimer;
+    QEventLoop* eventLoop{nullptr};
 };
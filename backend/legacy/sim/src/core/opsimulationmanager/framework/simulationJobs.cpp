@@ -0,0 +1,65 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "simulationJobs.h"
+
+#include <algorithm>
+
+#include <QDir>
+#include <QFileInfo>
+#include <QString>
+
+#include "common/log.h"
+
+namespace SimulationManager {
+
+std::vector<Arguments> SplitIntoJobs(const Arguments& arguments,
+                                     const Configuration::SimulationConfig& simulationConfig,
+                                     int numberOfInvocations,
+                                     int invocationsPerJob)
+{
+    if (invocationsPerJob == 0 || numberOfInvocations <= invocationsPerJob)
+    {
+        return {arguments};
+    }
+
+    const QFileInfo logFile(QString::fromStdString(simulationConfig.logFile));
+    const QString logFileSuffix = logFile.suffix().isEmpty() ? "" : "." + logFile.suffix();
+
+    std::vector<Arguments> jobs;
+    for (int first = 0; first < numberOfInvocations; first += invocationsPerJob)
+    {
+        const int last = std::min(first + invocationsPerJob, numberOfInvocations) - 1;
+        const QString slice = QString("Invocations_%1-%2").arg(first).arg(last);
+
+        Arguments job = arguments;
+        for (auto& [command, value] : job)
+        {
+            if (command == "--logFile")
+            {
+                value = QDir(logFile.path()).filePath(logFile.completeBaseName() + "_" + slice + logFileSuffix).toStdString();
+            }
+            else if (command == "--results")
+            {
+                value = QDir(QString::fromStdString(simulationConfig.results)).filePath(slice).toStdString();
+            }
+        }
+        // the simulation numbers the runs by their invocation (see GetInvocations of opSimulation)
+        job.emplace_back("--invocations", QString("%1-%2").arg(first).arg(last).toStdString());
+
+        jobs.push_back(std::move(job));
+    }
+
+    LOG_INTERN(LogLevel::DebugCore) << "split " << numberOfInvocations << " invocations of " << simulationConfig.configs
+                                    << " into " << jobs.size() << " jobs";
+    return jobs;
+}
+
+} // namespace SimulationManager
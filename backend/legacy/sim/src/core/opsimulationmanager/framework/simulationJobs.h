@@ -0,0 +1,48 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+//-----------------------------------------------------------------------------
+//! @file  simulationJobs.h
+//! @brief This file contains the splitting of simulations into jobs, which
+//!        are executed by separate simulation processes.
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "simulationConfig.h"
+
+namespace SimulationManager {
+
+//! Command line arguments of a simulation process (option and value)
+using Arguments = std::vector<std::pair<std::string, std::string>>;
+
+//-----------------------------------------------------------------------------
+//! \brief Splits a simulation into jobs of at most invocationsPerJob invocations,
+//!        so that large experiments are balanced over all process slots.
+//!        Each job executes a disjoint range of invocations (and thereby of
+//!        random seeds), writes into the subdirectory "Invocations_<first>-<last>"
+//!        of the results and into an own log file. The run ids of a job are the
+//!        numbers of its invocations, so the results of all jobs can be merged.
+//! \param[in] arguments            arguments of the whole simulation
+//! \param[in] simulationConfig     configuration of the simulation
+//! \param[in] numberOfInvocations  number of invocations of the experiment
+//! \param[in] invocationsPerJob    maximum number of invocations per job (0: no splitting)
+//! \returns the arguments of each job
+//-----------------------------------------------------------------------------
+std::vector<Arguments> SplitIntoJobs(const Arguments& arguments,
+                                     const Configuration::SimulationConfig& simulationConfig,
+                                     int numberOfInvocations,
+                                     int invocationsPerJob);
+
+} // namespace SimulationManager
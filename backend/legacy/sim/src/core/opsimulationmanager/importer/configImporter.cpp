@@ -83,10 +83,30 @@ Config ConfigImporter::Import(const QString& filename)
         GetValue<std::string>(document, "logFileSimulationManager"),
         GetValue<std::string>(document, "simulation"),
         GetValue<std::string>(document, "libraries"),
-        ParseSimulationConfigs(document)
+        ParseSimulationConfigs(document),
+        GetValue<int>(document, "maxProcesses"),
+        GetValue<int>(document, "memoryLimit"),
+        GetValue<int>(document, "retries"),
+        GetValue<int>(document, "invocationsPerJob")
     };
 }
 
+std::optional<int> ConfigImporter::ImportNumberOfInvocations(const std::string& configs)
+{
+    QDir baseDir = QCoreApplication::applicationDirPath();
+    QFile xmlFile(baseDir.cleanPath(baseDir.absoluteFilePath(QString::fromStdString(configs) + "/simulationConfig.xml")));
+
+    try
+    {
+        const auto experiment = GetChildOrThrow(ReadDocument(xmlFile, xmlFile.fileName().toStdString()), "Experiment");
+        return GetValue<int>(experiment, "NumberOfInvocations");
+    }
+    catch (const std::runtime_error&)
+    {
+        return std::nullopt;
+    }
+}
+
 SimulationConfigs ConfigImporter::ParseSimulationConfigs(const QDomElement& element)
 {
     auto simulationConfigRoot = GetChildOrThrow(element, "simulationConfigs");
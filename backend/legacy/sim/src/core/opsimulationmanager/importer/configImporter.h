@@ -20,6 +20,8 @@
 #include <QFile>
 #include <QDomElement>
 #include <QString>
+#include <optional>
+#include <string>
 #include <vector>
 #include "../framework/simulationConfig.h"
 
@@ -49,6 +51,15 @@ public:
     //-------------------------------------------------------------------------
     static Config Import(const QString& filename);
 
+    //-------------------------------------------------------------------------
+    //! \brief Reads the number of invocations from the simulationConfig.xml
+    //! 	   of a simulation
+    //! \param[in] configs The configurations directory of the simulation
+    //! \returns The number of invocations, or std::nullopt if the file or the
+    //! 		 value could not be read
+    //-------------------------------------------------------------------------
+    static std::optional<int> ImportNumberOfInvocations(const std::string& configs);
+
 private:
     //-------------------------------------------------------------------------
     //! \brief Parses simulation configuration details from the opSimulationManager
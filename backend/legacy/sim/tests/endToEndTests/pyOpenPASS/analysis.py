@@ -15,6 +15,7 @@ from simulation import SimulationResult
 from config_parser import TestItem
 import query_executor
 import event_loader
+from cyclics_reader import cyclics_file
 from dataclasses import dataclass
 from typing import List
 from log_parser import get_logs
@@ -74,7 +75,7 @@ class Analyzer():
                 for i in range(self.test_item.invocations):
                     agents, events = event_loader.get_trace_metadata(
                         str(simulation_output), query.events, i)
-                    base_run = artifacts / f'Cyclics_Run_{i:03}.csv'
+                    base_run = cyclics_file(artifacts, i)
                     if not self.query_result(str(base_run), agents, events, i, query, getattr(self.test_item, 'datatypes', None)):
                         failed_runs.add(i)
 
@@ -19,6 +19,8 @@ class ConfigModulator:
         if test_item.random_seed_offset != 0:
             update_values['random_seed'] = \
                 XmlUtil.get(config_path, XmlUtil.CONFIG_RANDOM_SEED) + test_item.random_seed_offset
+        if hasattr(test_item, 'cyclics_format'):
+            update_values['cyclics_format'] = test_item.cyclics_format
         XmlUtil.update(config_path, update_values)
 
         if test_item.plugin:
@@ -0,0 +1,134 @@
+################################################################################
+# Copyright (c) 2021 in-tech GmbH
+#
+# This program and the accompanying materials are made available under the
+# terms of the Eclipse Public License 2.0 which is available at
+# http://www.eclipse.org/legal/epl-2.0.
+#
+# SPDX-License-Identifier: EPL-2.0
+################################################################################
+
+"""
+Reader for cyclics written in the columnar format of Observation_Log (Cyclics_Run_*.ocyc)
+
+The format is described in observationColumnarCyclics.h.
+Columns, which are not requested, are skipped without decompressing them.
+
+Usage as command line tool (prints the requested columns as csv):
+    python cyclics_reader.py Cyclics_Run_000.ocyc [COLUMN ...]
+"""
+
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+import numpy as np
+import pandas as pd
+
+MAGIC = b'OPCY'
+FORMAT_VERSION = 1
+FILE_EXTENSION = '.ocyc'
+INDEX_COLUMNS = ['Timestep', 'AgentId']
+
+_NUMPY_TYPES = {'?': '?', 'b': 'i1', 'i': '<i4', 'Q': '<u8', 'f': '<f4', 'd': '<f8'}
+
+
+class CyclicsFormatError(Exception):
+    pass
+
+
+def cyclics_file(result_path, run_id):
+    """Returns the cyclics file of the given run (columnar, if available, else csv)"""
+    columnar_file = Path(result_path) / f'Cyclics_Run_{run_id:03d}{FILE_EXTENSION}'
+    if columnar_file.exists():
+        return columnar_file
+    return Path(result_path) / f'Cyclics_Run_{run_id:03d}.csv'
+
+
+def is_columnar(file):
+    return isinstance(file, (str, Path)) and Path(file).suffix == FILE_EXTENSION
+
+
+def _read(f, size):
+    data = f.read(size)
+    if len(data) != size:
+        raise CyclicsFormatError(f'Unexpected end of file "{f.name}"')
+    return data
+
+
+def _read_header(f):
+    if _read(f, len(MAGIC)) != MAGIC:
+        raise CyclicsFormatError(f'"{f.name}" is no columnar cyclics file')
+    version, rows, columns = struct.unpack('<III', _read(f, 12))
+    if version != FORMAT_VERSION:
+        raise CyclicsFormatError(f'Unsupported format version {version} in "{f.name}"')
+    return rows, columns
+
+
+def _read_column_header(f):
+    (name_length,) = struct.unpack('<I', _read(f, 4))
+    name = _read(f, name_length).decode('utf-8')
+    type_code = _read(f, 1).decode('ascii')
+    (payload_size,) = struct.unpack('<Q', _read(f, 8))
+    return name, type_code, payload_size
+
+
+def _decode_column(type_code, payload, rows):
+    # qCompress prepends the uncompressed size as big endian uint32
+    data = zlib.decompress(payload[4:])
+    valid = np.frombuffer(data, dtype='?', count=rows)
+
+    if type_code == 's':
+        values = np.empty(rows, dtype=object)
+        offset = rows
+        for row in range(rows):
+            (length,) = struct.unpack_from('<I', data, offset)
+            offset += 4
+            values[row] = data[offset:offset + length].decode('utf-8')
+            offset += length
+    else:
+        values = np.frombuffer(data, dtype=_NUMPY_TYPES[type_code], count=rows, offset=rows)
+
+    column = pd.Series(values)
+    # missing samples become NaN, as when reading the csv output
+    return column if valid.all() else column.where(valid)
+
+
+def list_columns(file):
+    """Returns the names and type codes of all columns of the given file"""
+    columns = {}
+    with open(file, 'rb') as f:
+        _, column_count = _read_header(f)
+        for _ in range(column_count):
+            name, type_code, payload_size = _read_column_header(f)
+            columns[name] = type_code
+            f.seek(payload_size, 1)
+    return columns
+
+
+def read_cyclics(file, columns=None):
+    """
+    Reads the cyclics of the given file as long table (one row per timestep and agent)
+
+    Keyword arguments:
+    file    -- Path to the columnar cyclics file
+    columns -- Names of the cyclic columns to read (default: all).
+               'Timestep' and 'AgentId' are always read.
+    """
+    data = {}
+    with open(file, 'rb') as f:
+        rows, column_count = _read_header(f)
+        for _ in range(column_count):
+            name, type_code, payload_size = _read_column_header(f)
+            if columns is None or name in columns or name in INDEX_COLUMNS:
+                data[name] = _decode_column(type_code, _read(f, payload_size), rows)
+            else:
+                f.seek(payload_size, 1)
+    return pd.DataFrame(data)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    read_cyclics(sys.argv[1], sys.argv[2:] or None).to_csv(sys.stdout, index=False)
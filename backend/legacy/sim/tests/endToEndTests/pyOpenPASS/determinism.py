@@ -9,7 +9,7 @@
 ################################################################################
 
 from filecmp import cmp as files_equal
-from pathlib import Path
+from cyclics_reader import cyclics_file
 
 class DeterminismFailed(Exception):
     pass
@@ -30,12 +30,11 @@ def check(simulation_result):
     pass
 
 def check_determinism(base_run, consecutive_runs):
-    result_file = 'Cyclics_Run_{id:03d}.csv'
     failed_runs = list()
     for run_id, run in enumerate(consecutive_runs):
         if not files_equal(
-            Path(base_run) / result_file.format(id=run_id),
-            Path(run) / result_file.format(id=0)):
+            cyclics_file(base_run, run_id),
+            cyclics_file(run, 0)):
             failed_runs.append(run_id)
     return failed_runs
 
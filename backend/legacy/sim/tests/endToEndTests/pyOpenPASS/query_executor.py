@@ -10,8 +10,12 @@
 ################################################################################
 
 import pandas as pd
+import cyclics_reader
 import event_parser
 from io import StringIO
+from pathlib import Path
+
+CSV_HEADER_SUFFIX = '.header'
 
 
 def _query_singe_df(df, query):
@@ -105,12 +109,56 @@ def query_output(data, events, run_id, query):
     return execute_query(data, query.pd, run_id)
 
 
-def prepare_output(csv_file, agents, datatypes):
+def prepare_output(cyclics_file, agents, datatypes):
+    if cyclics_reader.is_columnar(cyclics_file):
+        data = _read_columnar(cyclics_file, datatypes)
+    else:
+        data = _read_csv(cyclics_file, datatypes)
+
+    # merge agent info
+    data = pd.merge(data, agents, on=['AgentId'], how='outer')
+
+    # some values might become NaN when agents leave world - this edgecases are filled with "old values"
+    for column in data.columns:
+        data[column] = data.groupby('AgentId')[column].fillna(method='ffill')
+
+    return data
+
+
+def _apply_datatypes(data, datatypes):
+    if datatypes:
+        for column, type in datatypes.items():
+            if column in data:
+                data[[column]] = data[[column]].astype(type)
+    return data
+
 
+def _read_columnar(columnar_file, datatypes):
+    # already a long table (one row per timestep and agent with samples)
+    return _apply_datatypes(cyclics_reader.read_cyclics(columnar_file), datatypes)
+
+
+def _csv_header_file(csv_file):
+    """Returns the header file of a csv file streamed by Observation_Log (None, if the header is in the csv file)"""
+    if isinstance(csv_file, (str, Path)):
+        header_file = Path(f'{csv_file}{CSV_HEADER_SUFFIX}')
+        if header_file.exists():
+            return header_file
+    return None
+
+
+def _read_csv(csv_file, datatypes):
     datatypes_prefixed = {}
 
+    # streamed csv files have their header in a separate file
+    header_options = {}
+    header_file = _csv_header_file(csv_file)
+    if header_file:
+        header_options = {'header': None, 'names': pd.read_csv(
+            header_file, nrows=0, skipinitialspace=True).columns}
+
     if datatypes:
-        all_headers = pd.read_csv(
+        all_headers = header_options['names'] if header_file else pd.read_csv(
             csv_file, nrows=0, skipinitialspace=True).columns
 
         for column, typestring in datatypes.items():
@@ -123,7 +171,7 @@ def prepare_output(csv_file, agents, datatypes):
             csv_file.seek(0)
 
     data = pd.read_csv(csv_file, skipinitialspace=True,
-                       dtype=datatypes_prefixed, keep_default_na=True)
+                       dtype=datatypes_prefixed, keep_default_na=True, **header_options)
 
     # reformat columns => '00:TheCol' => 'TheCol:00'
     data.columns = [':'.join(c.split(':')[::-1]) for c in data.columns]
@@ -141,16 +189,4 @@ def prepare_output(csv_file, agents, datatypes):
     data.dropna(how='all', subset=agent_columns, inplace=True)
 
     # apply datatypes to long table (as wide_to_long might drop some types)
-    if datatypes:
-        for column, type in datatypes.items():
-            if column in data:
-                data[[column]] = data[[column]].astype(type)
-
-    # merge agent info
-    data = pd.merge(data, agents, on=['AgentId'], how='outer')
-
-    # some values might become NaN when agents leave world - this edgecases are filled with "old values"
-    for column in data.columns:
-        data[column] = data.groupby('AgentId')[column].fillna(method='ffill')
-
-    return data
+    return _apply_datatypes(data, datatypes)
@@ -0,0 +1,80 @@
+################################################################################
+# Copyright (c) 2021 in-tech GmbH
+#
+# This program and the accompanying materials are made available under the
+# terms of the Eclipse Public License 2.0 which is available at
+# http://www.eclipse.org/legal/epl-2.0.
+#
+# SPDX-License-Identifier: EPL-2.0
+################################################################################
+
+import sys
+sys.path.append('..')
+
+import struct
+import zlib
+
+import pandas as pd
+import pytest
+
+import cyclics_reader
+
+
+def _column(name, type_code, valid, values):
+    """Encodes a column as written by Observation_Log"""
+    data = bytes(valid)
+    if type_code == 's':
+        for value in values:
+            encoded = value.encode('utf-8')
+            data += struct.pack('<I', len(encoded)) + encoded
+    else:
+        data += struct.pack(f'<{len(values)}{type_code}', *values)
+    payload = struct.pack('>I', len(data)) + zlib.compress(data)
+    return struct.pack('<I', len(name)) + name.encode('utf-8') + type_code.encode('ascii') + \
+        struct.pack('<Q', len(payload)) + payload
+
+
+@pytest.fixture
+def columnar_file(tmp_path):
+    file = tmp_path / 'Cyclics_Run_000.ocyc'
+    file.write_bytes(
+        b'OPCY' + struct.pack('<III', 1, 3, 4) +
+        _column('Timestep', 'i', [1, 1, 1], [0, 0, 100]) +
+        _column('AgentId', 'i', [1, 1, 1], [0, 1, 0]) +
+        _column('Lane', 's', [1, 0, 1], ['-1', '', '-2']) +
+        _column('VelocityEgo', 'd', [1, 1, 0], [10.5, 20.0, 0.0]))
+    return file
+
+
+def test_read_cyclics_reads_all_columns(columnar_file):
+    data = cyclics_reader.read_cyclics(columnar_file)
+
+    assert(list(data.columns) == ['Timestep', 'AgentId', 'Lane', 'VelocityEgo'])
+    assert(data['Timestep'].to_list() == [0, 0, 100])
+    assert(data['AgentId'].to_list() == [0, 1, 0])
+    assert(data['Lane'][0] == '-1' and pd.isna(data['Lane'][1]) and data['Lane'][2] == '-2')
+    assert(data['VelocityEgo'][0] == 10.5 and data['VelocityEgo'][1] == 20.0 and pd.isna(data['VelocityEgo'][2]))
+
+
+def test_read_cyclics_with_selected_columns_reads_only_these(columnar_file):
+    data = cyclics_reader.read_cyclics(columnar_file, ['VelocityEgo'])
+
+    assert(list(data.columns) == ['Timestep', 'AgentId', 'VelocityEgo'])
+
+
+def test_list_columns_returns_type_codes(columnar_file):
+    assert(cyclics_reader.list_columns(columnar_file) ==
+           {'Timestep': 'i', 'AgentId': 'i', 'Lane': 's', 'VelocityEgo': 'd'})
+
+
+def test_cyclics_file_prefers_columnar_file(tmp_path, columnar_file):
+    assert(cyclics_reader.cyclics_file(tmp_path, 0) == columnar_file)
+    assert(cyclics_reader.cyclics_file(tmp_path, 1) == tmp_path / 'Cyclics_Run_001.csv')
+
+
+def test_read_cyclics_of_other_file_raises(tmp_path):
+    file = tmp_path / 'Cyclics_Run_000.ocyc'
+    file.write_bytes(b'Timestep, 00:Lane\n')
+
+    with pytest.raises(cyclics_reader.CyclicsFormatError):
+        cyclics_reader.read_cyclics(file)
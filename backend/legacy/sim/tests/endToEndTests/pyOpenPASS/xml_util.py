@@ -50,6 +50,20 @@ def set(base_path, xml_setter: XmlSetter):
         f.write(etree.tostring(tree, encoding="unicode", pretty_print=True))
 
 
+def add_bool_parameter(base_path, sibling: XmlNode, key, value):
+    """ Sets the bool parameter next to the node given by sibling to value (adds it, if not existing) """
+    (_, tree, node) = get_node(base_path, sibling)
+    parameters = node.getparent()
+    parameter = parameters.find(f"Bool[@Key='{key}']")
+    if parameter is None:
+        parameter = etree.SubElement(parameters, 'Bool', Key=key)
+    parameter.attrib['Value'] = str(value)
+
+    xml_file = os.path.join(base_path, sibling.xml_file)
+    with open(xml_file, 'w') as f:
+        f.write(etree.tostring(tree, encoding="unicode", pretty_print=True))
+
+
 def get_node(base_path, xml_node: XmlNode):
     """ Gets the node for further processing """
     xml_file = os.path.join(base_path, xml_node.xml_file)
@@ -94,7 +108,7 @@ class XmlUtil:
         configs_path -- Path to config set, which shall be manipulated
         config       -- dictionary for updating the values
                         Mandatory:  invocations, duration
-                        Optional:   random seed
+                        Optional:   random seed, cyclics format ('csv' or 'columnar')
         """
         # default values
         set(configs_path,
@@ -110,6 +124,9 @@ class XmlUtil:
         if 'random_seed' in config:
             set(configs_path,
                 XmlSetter(XmlUtil.CONFIG_RANDOM_SEED, config['random_seed']))
+        if config.get('cyclics_format') == 'columnar':
+            add_bool_parameter(configs_path, XmlUtil.CONFIG_LOGGING_TO_CSV,
+                               'LoggingCyclicsToColumnar', 'true')
 
     @staticmethod
     def custom_update(configs_path, xml_setter: XmlSetter):
@@ -20,6 +20,7 @@ class FakeDataBuffer : public DataBufferInterface
 {
 public:
     MOCK_CONST_METHOD2(GetCyclic, std::unique_ptr<CyclicResultInterface>(const std::optional<openpass::type::EntityId> entityId, const Key& key));
+    MOCK_CONST_METHOD2(GetCyclics, std::unique_ptr<CyclicResultInterface>(const std::optional<openpass::type::EntityId> entityId, const KeySelection& selection));
     MOCK_CONST_METHOD2(GetAcyclic, std::unique_ptr<AcyclicResultInterface>(const std::optional<openpass::type::EntityId> entityId, const Key& key));
     MOCK_CONST_METHOD1(GetStatic, Values(const Key& key));
     MOCK_CONST_METHOD1(GetKeys, Keys(const Key& key));
@@ -104,6 +104,7 @@ class FakeWorld : public WorldInterface
     MOCK_CONST_METHOD3(GetRoadGraph, std::pair<RoadGraph, RoadGraphVertex>(const RouteElement& start, int maxDepth, bool inDrivingDirection));
     MOCK_CONST_METHOD1(GetEdgeWeights, std::map<RoadGraphEdge, double>(const RoadGraph& roadGraph));
     MOCK_CONST_METHOD1(GetRoadStream, std::unique_ptr<RoadStreamInterface> (const std::vector<RouteElement>& route));
+    MOCK_CONST_METHOD1(CreateRouteStreamCache, std::shared_ptr<RouteStreamCacheInterface> (const RoadGraph& roadGraph));
     MOCK_CONST_METHOD4(ResolveRelativePoint, RouteQueryResult<std::optional<GlobalRoadPosition>> (const RoadGraph& roadGraph, RoadGraphVertex startNode, ObjectPointRelative relativePoint, const WorldObjectInterface& object));
     MOCK_METHOD0(GetRadio, RadioInterface&());
 };
@@ -188,6 +188,29 @@ void CheckLaneConnections(const std::vector<const OWL::Interfaces::Lane*>& first
     }
 }
 
+TEST(SceneryImporter_IntegrationTests, ImportWithMultipleThreads_ImportsSameRoadsAsSingleThread)
+{
+    const auto sceneryPath = (std::filesystem::current_path() / "Resources" / "ImporterTest" / "ComplexJunctionIntegrationScenery.xodr").string();
+    Scenery singleThreadScenery;
+    Scenery multiThreadScenery;
+
+    ASSERT_THAT(SceneryImporter::Import(sceneryPath, &singleThreadScenery), IsTrue());
+    ASSERT_THAT(SceneryImporter::Import(sceneryPath, &multiThreadScenery, 4), IsTrue());
+
+    EXPECT_THAT(multiThreadScenery.GetContentHash(), Eq(singleThreadScenery.GetContentHash()));
+    EXPECT_THAT(multiThreadScenery.GetJunctions(), SizeIs(singleThreadScenery.GetJunctions().size()));
+    ASSERT_THAT(multiThreadScenery.GetRoads(), SizeIs(singleThreadScenery.GetRoads().size()));
+
+    for (const auto& [id, road] : singleThreadScenery.GetRoads())
+    {
+        const auto otherRoad = multiThreadScenery.GetRoad(id);
+        ASSERT_THAT(otherRoad, Ne(nullptr));
+        EXPECT_THAT(otherRoad->GetJunctionId(), Eq(road->GetJunctionId()));
+        EXPECT_THAT(otherRoad->GetGeometries(), SizeIs(road->GetGeometries().size()));
+        EXPECT_THAT(otherRoad->GetLaneSections(), SizeIs(road->GetLaneSections().size()));
+    }
+}
+
 //! Test correctly imported scenery
 //! Scope is on World-level
 TEST(SceneryImporter_IntegrationTests, SingleRoad_ImportWithCorrectLanes)
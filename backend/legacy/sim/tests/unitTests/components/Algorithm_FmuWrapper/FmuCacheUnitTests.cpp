@@ -0,0 +1,74 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "fmuCache.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+class FmuCacheTest : public ::testing::Test
+{
+public:
+    FmuCacheTest()
+    {
+        fs::create_directories(extractedFmu / "binaries" / "linux64");
+        std::ofstream{extractedFmu / "modelDescription.xml"} << "<fmiModelDescription/>";
+        std::ofstream{extractedFmu / "binaries" / "linux64" / "Model.so"} << "binary";
+    }
+
+    ~FmuCacheTest()
+    {
+        fs::remove_all(root);
+    }
+
+    const fs::path root{fs::temp_directory_path() / fs::path(std::tmpnam(nullptr)).filename()};
+    const fs::path extractedFmu{root / "extracted"};
+    const fs::path instanceDirectory{root / "instance"};
+};
+
+TEST_F(FmuCacheTest, CreateInstanceDirectory_ContainsAllFilesOfExtractedFmu)
+{
+    FmuCache::CreateInstanceDirectory(extractedFmu, instanceDirectory);
+
+    EXPECT_TRUE(fs::is_regular_file(instanceDirectory / "modelDescription.xml"));
+    EXPECT_TRUE(fs::is_regular_file(instanceDirectory / "binaries" / "linux64" / "Model.so"));
+}
+
+TEST_F(FmuCacheTest, CreateInstanceDirectory_CopiesBinaries)
+{
+    FmuCache::CreateInstanceDirectory(extractedFmu, instanceDirectory);
+
+    EXPECT_FALSE(fs::equivalent(extractedFmu / "binaries" / "linux64" / "Model.so",
+                                instanceDirectory / "binaries" / "linux64" / "Model.so"));
+}
+
+TEST(FmuCache, GetVariables_ParsesVariablesOnlyOnce)
+{
+    const fs::path extractedFmu{"/fmuCacheTest/GetVariables"};
+    int parseCount = 0;
+    const auto parseVariables = [&parseCount] {
+        ++parseCount;
+        return FmuVariables{std::in_place_index_t<FMI2>(),
+                            Fmu2Variables{{"Output", ValueReferenceAndType2{1, VariableType::Double}}}};
+    };
+
+    FmuCache::GetInstance().GetVariables(extractedFmu, parseVariables);
+    const auto variables = FmuCache::GetInstance().GetVariables(extractedFmu, parseVariables);
+
+    EXPECT_THAT(parseCount, 1);
+    ASSERT_THAT(std::get<FMI2>(variables).count("Output"), 1);
+    EXPECT_THAT(std::get<FMI2>(variables).at("Output").first, 1);
+}
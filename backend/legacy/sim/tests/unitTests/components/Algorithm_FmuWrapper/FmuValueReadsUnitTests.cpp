@@ -0,0 +1,76 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "fmuValueReads.h"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+
+namespace {
+
+FmuValueReads CreateReads(std::vector<FmuHandlerInterface::FmuValue>& values)
+{
+    FmuValueReads reads;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        reads.valueReferences.push_back(static_cast<fmi2_value_reference_t>(10 * i));
+        reads.values.push_back(&values[i]);
+        reads.names.push_back("Variable" + std::to_string(i));
+    }
+    return reads;
+}
+
+} // namespace
+
+TEST(FmuValueReads, StoreReadValues_Fmi1Booleans_StoresValuesInOrderOfReads)
+{
+    std::vector<FmuHandlerInterface::FmuValue> values(3);
+    const auto reads = CreateReads(values);
+    const std::vector<fmi1_boolean_t> readValues{fmi1_true, fmi1_false, fmi1_true};
+
+    StoreReadValues(reads, readValues, &FmuHandlerInterface::FmuValue::boolValue);
+
+    EXPECT_THAT(values[0].boolValue, Eq(true));
+    EXPECT_THAT(values[1].boolValue, Eq(false));
+    EXPECT_THAT(values[2].boolValue, Eq(true));
+}
+
+TEST(FmuValueReads, StoreReadValues_Fmi2Booleans_StoresValuesInOrderOfReads)
+{
+    std::vector<FmuHandlerInterface::FmuValue> values(2);
+    const auto reads = CreateReads(values);
+    const std::vector<fmi2_boolean_t> readValues{fmi2_false, fmi2_true};
+
+    StoreReadValues(reads, readValues, &FmuHandlerInterface::FmuValue::boolValue);
+
+    EXPECT_THAT(values[0].boolValue, Eq(false));
+    EXPECT_THAT(values[1].boolValue, Eq(true));
+}
+
+TEST(FmuValueReads, StoreReadValues_IntegersRealsAndStrings_StoresValuesInOrderOfReads)
+{
+    std::vector<FmuHandlerInterface::FmuValue> integerValues(2);
+    std::vector<FmuHandlerInterface::FmuValue> realValues(2);
+    std::vector<FmuHandlerInterface::FmuValue> stringValues(2);
+
+    StoreReadValues(CreateReads(integerValues), std::vector<fmi2_integer_t>{-3, 7}, &FmuHandlerInterface::FmuValue::intValue);
+    StoreReadValues(CreateReads(realValues), std::vector<fmi2_real_t>{1.5, -2.25}, &FmuHandlerInterface::FmuValue::realValue);
+    StoreReadValues(CreateReads(stringValues), std::vector<fmi2_string_t>{"first", "second"}, &FmuHandlerInterface::FmuValue::stringValue);
+
+    EXPECT_THAT(integerValues[0].intValue, Eq(-3));
+    EXPECT_THAT(integerValues[1].intValue, Eq(7));
+    EXPECT_THAT(realValues[0].realValue, Eq(1.5));
+    EXPECT_THAT(realValues[1].realValue, Eq(-2.25));
+    EXPECT_THAT(stringValues[0].stringValue, StrEq("first"));
+    EXPECT_THAT(stringValues[1].stringValue, StrEq("second"));
+}
@@ -45,6 +45,11 @@ bool UpdateFunc(int id, int time)
     return true;
 }
 
+std::vector<TaskItem> CopyTasks(const TaskItemRefs &taskRefs)
+{
+    return {taskRefs.cbegin(), taskRefs.cend()};
+}
+
 TEST(Tasks_Test, AddedTask_FillTasksCorrect)
 {
     std::function<bool(void)> triggerFunc = std::bind(&TriggerFunc, std::ref(currentTimestamp));
@@ -516,3 +521,53 @@ TEST(SchedulerTasks_Test, UpdateTasks_ListedInCorrectOrder)
 
     ASSERT_THAT(taskItems, ElementsAre(outputTaskItem, inputTaskItem));
 }
+
+TEST(SchedulerTasks_Test, GetRecurringAgentTasksWithMixedCycleTimes_DeliversTasksInOrderOfTaskSet)
+{
+    std::function<bool(void)> updateFunc = std::bind(&UpdateFunc, 42, std::ref(currentTimestamp));
+
+    UpdateTaskItem firstTaskItem{0, 0, 10, 0, updateFunc};
+    UpdateTaskItem secondTaskItem{1, 10, 50, 0, updateFunc};
+    TriggerTaskItem thirdTaskItem{2, 0, 100, 10, updateFunc};
+    UpdateTaskItem fourthTaskItem{3, 0, 10, 0, updateFunc};
+    std::vector<TaskItem> testTasks{firstTaskItem, secondTaskItem, thirdTaskItem, fourthTaskItem};
+
+    SchedulerTasks testSchedulerTasks(std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, 100);
+    testSchedulerTasks.ScheduleNewRecurringTasks(testTasks);
+
+    const auto tasksAt0 = CopyTasks(testSchedulerTasks.GetRecurringAgentTasks(0));
+    const auto tasksAt10 = CopyTasks(testSchedulerTasks.GetRecurringAgentTasks(10));
+    const auto tasksAt20 = CopyTasks(testSchedulerTasks.GetRecurringAgentTasks(20));
+    const auto tasksAt50 = CopyTasks(testSchedulerTasks.GetRecurringAgentTasks(50));
+    const auto tasksAt110 = CopyTasks(testSchedulerTasks.GetRecurringAgentTasks(110));
+
+    ASSERT_THAT(tasksAt0, ElementsAre(secondTaskItem, firstTaskItem, fourthTaskItem));
+    ASSERT_THAT(tasksAt10, ElementsAre(thirdTaskItem, firstTaskItem, fourthTaskItem));
+    ASSERT_THAT(tasksAt20, ElementsAre(firstTaskItem, fourthTaskItem));
+    ASSERT_THAT(tasksAt50, ElementsAre(secondTaskItem, firstTaskItem, fourthTaskItem));
+    ASSERT_THAT(tasksAt110, ElementsAre(thirdTaskItem, firstTaskItem, fourthTaskItem));
+}
+
+TEST(SchedulerTasks_Test, GetRecurringAgentTasksOfNewAndDeletedAgents_DeliversOnlyTasksOfRemainingAgents)
+{
+    std::function<bool(void)> updateFunc = std::bind(&UpdateFunc, 42, std::ref(currentTimestamp));
+
+    UpdateTaskItem firstTaskItem{0, 0, 50, 0, updateFunc};
+    UpdateTaskItem secondTaskItem{1, 0, 20, 0, updateFunc};
+    UpdateTaskItem thirdTaskItem{2, 0, 30, 0, updateFunc};
+
+    SchedulerTasks testSchedulerTasks(std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, std::vector<TaskItem>{}, 100);
+    testSchedulerTasks.ScheduleNewRecurringTasks({firstTaskItem, secondTaskItem});
+
+    ASSERT_THAT(testSchedulerTasks.GetRecurringAgentTasks(0), SizeIs(2));
+
+    testSchedulerTasks.DeleteAgentTasks(1);
+    testSchedulerTasks.ScheduleNewRecurringTasks({thirdTaskItem});
+
+    const auto tasksAt40 = CopyTasks(testSchedulerTasks.GetRecurringAgentTasks(40));
+    const auto tasksAt60 = CopyTasks(testSchedulerTasks.GetRecurringAgentTasks(60));
+
+    ASSERT_THAT(tasksAt40, SizeIs(0));
+    ASSERT_THAT(tasksAt60, ElementsAre(thirdTaskItem));
+    ASSERT_THAT(testSchedulerTasks.GetRecurringAgentTasks(100), SizeIs(1));
+}
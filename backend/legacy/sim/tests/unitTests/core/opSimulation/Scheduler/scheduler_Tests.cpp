@@ -7,13 +7,24 @@
  *
  * SPDX-License-Identifier: EPL-2.0
  ********************************************************************************/
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <list>
+#include <mutex>
+#include <random>
 #include <set>
+#include <thread>
 
+#include "agent.h"
+#include "agentDataPublisher.h"
+#include "bindings/stochastics.h"
 #include "eventDetector.h"
 #include "eventDetectorLibrary.h"
+#include "fakeAgent.h"
+#include "fakeAgentBlueprint.h"
+#include "fakeComponent.h"
 #include "fakeDataBuffer.h"
 #include "fakeEventDetectorNetwork.h"
 #include "fakeEventNetwork.h"
@@ -29,6 +40,8 @@
 
 using namespace core::scheduling;
 
+using testing::_;
+using testing::Invoke;
 using testing::NiceMock;
 using testing::Return;
 using testing::ReturnRef;
@@ -93,3 +106,118 @@ TEST(DISABLED_Scheduler, RunWorks)
     RunResult runResult{};
     scheduler.Run(0, 300, runResult, fakeEventNetwork);
 }
+
+namespace {
+
+//! Recorded write to the data buffer (time, entity, key, value)
+using Write = std::tuple<int, int, std::string, double>;
+
+//! Runs agents drawing from their own random streams and publishing the draws
+std::vector<Write> RunAgents(int numberOfThreads, std::uint32_t seed)
+{
+    constexpr int numberOfAgents = 16;
+    constexpr int endTime = 1000;
+
+    NiceMock<FakeWorld> fakeWorld;
+    NiceMock<FakeSpawnPointNetwork> fakeSpawnPointNetwork;
+    NiceMock<FakeDataBuffer> fakeDataBuffer;
+    NiceMock<FakeManipulatorNetwork> fakeManipulatorNetwork;
+    NiceMock<FakeObservationNetwork> fakeObservationNetwork;
+    NiceMock<FakeEventDetectorNetwork> fakeEventDetectorNetwork;
+    NiceMock<FakeEventNetwork> fakeEventNetwork;
+    NiceMock<FakeAgentBlueprint> fakeAgentBlueprint;
+
+    int currentTime{0};
+    std::mutex writesMutex;
+    std::vector<Write> writes;
+
+    ON_CALL(fakeDataBuffer, PutCyclic(_, _, _)).WillByDefault(Invoke([&](const openpass::type::EntityId entityId, const Key &key, const Value &value) {
+        std::lock_guard<std::mutex> lock(writesMutex);
+        writes.emplace_back(currentTime, entityId, key, std::get<double>(value));
+    }));
+    ON_CALL(fakeDataBuffer, PutAcyclic(_, _, _)).WillByDefault(Invoke([&](const openpass::type::EntityId entityId, const Key &key, const Acyclic &) {
+        std::lock_guard<std::mutex> lock(writesMutex);
+        writes.emplace_back(currentTime, entityId, key, 0.0);
+    }));
+    ON_CALL(fakeSpawnPointNetwork, TriggerPreRunSpawnZones()).WillByDefault(Return(true));
+    ON_CALL(fakeSpawnPointNetwork, TriggerRuntimeSpawnPoints(_)).WillByDefault(Invoke([&](const int time) {
+        currentTime = time;
+        return true;
+    }));
+    ON_CALL(fakeObservationNetwork, UpdateTimeStep(_, _)).WillByDefault(Return(true));
+
+    std::vector<std::unique_ptr<NiceMock<FakeAgent>>> agentAdapters;
+    std::vector<std::unique_ptr<core::Agent>> agents;
+    std::vector<std::unique_ptr<openpass::publisher::AgentDataPublisher>> publishers;
+    std::vector<std::unique_ptr<std::mt19937>> streams;
+    std::map<int, core::Channel *> noChannels;
+
+    for (int agentId = 0; agentId < numberOfAgents; ++agentId)
+    {
+        auto &agentAdapter = agentAdapters.emplace_back(std::make_unique<NiceMock<FakeAgent>>());
+        ON_CALL(*agentAdapter, GetId()).WillByDefault(Return(agentId));
+        EXPECT_CALL(fakeWorld, CreateAgentAdapter(_)).WillOnce(ReturnRef(*agentAdapter));
+
+        auto &agent = agents.emplace_back(std::make_unique<core::Agent>(&fakeWorld, fakeAgentBlueprint));
+        auto &publisher = publishers.emplace_back(std::make_unique<openpass::publisher::AgentDataPublisher>(&fakeDataBuffer, agentId));
+        auto &stream = streams.emplace_back(std::make_unique<std::mt19937>(core::Stochastics::GetAgentSeed(seed, agentId)));
+
+        for (int priority : {1, 0})
+        {
+            auto component = new NiceMock<FakeComponent>();
+            ON_CALL(*component, GetPriority()).WillByDefault(Return(priority));
+            ON_CALL(*component, GetCycleTime()).WillByDefault(Return(100));
+            ON_CALL(*component, GetOutputLinks()).WillByDefault(ReturnRef(noChannels));
+            ON_CALL(*component, ReleaseFromLibrary()).WillByDefault(Return(true));
+            ON_CALL(*component, TriggerCycle(_)).WillByDefault(Invoke([&publisher, &stream, priority](int time) {
+                const double draw = std::uniform_real_distribution<double>(0.0, 1.0)(*stream);
+                std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int>(draw * 200)));
+                publisher->Publish("Draw" + std::to_string(priority), draw);
+                if (draw < 0.1)
+                {
+                    publisher->Publish("Event", openpass::databuffer::ComponentEvent({{"Time", time}}));
+                }
+                return true;
+            }));
+            agent->AddComponent("Component" + std::to_string(priority), component);
+        }
+    }
+
+    std::vector<core::Agent *> newAgents;
+    for (const auto &agent : agents)
+    {
+        newAgents.push_back(agent.get());
+    }
+    EXPECT_CALL(fakeSpawnPointNetwork, ConsumeNewAgents()).WillOnce(Return(newAgents)).WillRepeatedly(Return(std::vector<core::Agent *>{}));
+
+    Scheduler scheduler(fakeWorld, fakeSpawnPointNetwork, fakeEventDetectorNetwork, fakeManipulatorNetwork, fakeObservationNetwork, fakeDataBuffer, numberOfThreads);
+
+    RunResult runResult{};
+    EXPECT_TRUE(scheduler.Run(0, endTime, runResult, fakeEventNetwork));
+
+    return writes;
+}
+
+} // namespace
+
+TEST(Scheduler, ConcurrentAgentExecution_ProducesSameDataIndependentOfNumberOfThreads)
+{
+    const auto writesOnTwoThreads = RunAgents(2, 42);
+    const auto writesOnFourThreads = RunAgents(4, 42);
+
+    ASSERT_THAT(writesOnTwoThreads, testing::SizeIs(testing::Gt(16 * 2 * 10)));
+    EXPECT_THAT(writesOnFourThreads, testing::ContainerEq(writesOnTwoThreads));
+}
+
+TEST(Scheduler, ConcurrentAgentExecution_ProducesSameDataAsSerialExecution)
+{
+    auto serialWrites = RunAgents(1, 42);
+    auto concurrentWrites = RunAgents(4, 42);
+
+    // serial execution publishes directly in task order, concurrent execution in agent order
+    std::sort(serialWrites.begin(), serialWrites.end());
+    std::sort(concurrentWrites.begin(), concurrentWrites.end());
+
+    ASSERT_THAT(serialWrites, testing::SizeIs(testing::Gt(16 * 2 * 10)));
+    EXPECT_THAT(concurrentWrites, testing::ContainerEq(serialWrites));
+}
@@ -0,0 +1,92 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "common/workStealingThreadPool.h"
+
+using ::testing::Eq;
+using ::testing::UnorderedElementsAre;
+
+using core::WorkStealingThreadPool;
+
+TEST(WorkStealingThreadPool_Test, ExecuteBatch_RunsEveryJobExactlyOnce)
+{
+    WorkStealingThreadPool threadPool{3};
+    std::vector<std::atomic<int>> executionCounts(100);
+
+    std::vector<WorkStealingThreadPool::Job> jobs;
+    for (auto &executionCount : executionCounts)
+    {
+        jobs.emplace_back([&executionCount] { ++executionCount; return true; });
+    }
+
+    ASSERT_TRUE(threadPool.Execute(jobs));
+
+    for (const auto &executionCount : executionCounts)
+    {
+        EXPECT_THAT(executionCount.load(), Eq(1));
+    }
+}
+
+TEST(WorkStealingThreadPool_Test, ExecuteSeveralBatches_EachBatchFinishedBeforeReturn)
+{
+    WorkStealingThreadPool threadPool{2};
+    std::atomic<int> executedJobs{0};
+
+    for (int batch = 1; batch <= 10; ++batch)
+    {
+        std::vector<WorkStealingThreadPool::Job> jobs(7, [&executedJobs] { ++executedJobs; return true; });
+
+        ASSERT_TRUE(threadPool.Execute(jobs));
+        ASSERT_THAT(executedJobs.load(), Eq(batch * 7));
+    }
+}
+
+TEST(WorkStealingThreadPool_Test, JobReportsError_ExecuteReturnsFalse)
+{
+    WorkStealingThreadPool threadPool{2};
+
+    std::vector<WorkStealingThreadPool::Job> jobs(5, [] { return true; });
+    jobs.emplace_back([] { return false; });
+
+    EXPECT_FALSE(threadPool.Execute(jobs));
+    EXPECT_TRUE(threadPool.Execute({[] { return true; }}));
+}
+
+TEST(WorkStealingThreadPool_Test, JobThrows_ExceptionIsRethrownOnCallingThread)
+{
+    WorkStealingThreadPool threadPool{2};
+
+    std::vector<WorkStealingThreadPool::Job> jobs(5, [] { return true; });
+    jobs.emplace_back([]() -> bool { throw std::runtime_error("job failed"); });
+
+    EXPECT_THROW(threadPool.Execute(jobs), std::runtime_error);
+}
+
+TEST(WorkStealingThreadPool_Test, NoWorkers_JobsAreExecutedByCallingThread)
+{
+    WorkStealingThreadPool threadPool{0};
+    std::vector<int> executionOrder;
+
+    std::vector<WorkStealingThreadPool::Job> jobs;
+    for (int jobId = 0; jobId < 3; ++jobId)
+    {
+        jobs.emplace_back([&executionOrder, jobId] { executionOrder.push_back(jobId); return true; });
+    }
+
+    ASSERT_THAT(threadPool.GetNumberOfThreads(), Eq(1));
+    ASSERT_TRUE(threadPool.Execute(jobs));
+    EXPECT_THAT(executionOrder, UnorderedElementsAre(0, 1, 2));
+}
@@ -46,3 +46,27 @@ TEST(AgentDataPublisher, CallingPublish_ForwardsParametersToDataBuffer)
 
     adp->Publish(key, value);
 }
+
+TEST(AgentDataPublisher, CallingPublishWithActiveWriteBuffer_ForwardsParametersOnCommit)
+{
+    FakeDataBuffer fakeDataBuffer;
+
+    const EntityId agentId = 1;
+    const Key key = "theKey";
+    const Value value = 2;
+
+    AgentDataPublisher adp(&fakeDataBuffer, agentId);
+    PublisherWriteBuffer writeBuffer;
+
+    {
+        PublisherWriteBuffer::Activation activation(writeBuffer);
+        EXPECT_CALL(fakeDataBuffer, PutCyclic(_, _, _)).Times(0);
+        adp.Publish(key, value);
+        ::testing::Mock::VerifyAndClearExpectations(&fakeDataBuffer);
+    }
+
+    EXPECT_THAT(PublisherWriteBuffer::GetActive(), ::testing::IsNull());
+    EXPECT_CALL(fakeDataBuffer, PutCyclic(agentId, key, value));
+
+    writeBuffer.Commit();
+}
@@ -0,0 +1,108 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "agent.h"
+#include "agentFactory.h"
+#include "agentType.h"
+#include "bindings/stochastics.h"
+#include "fakeAgent.h"
+#include "fakeAgentBlueprint.h"
+#include "fakeDataBuffer.h"
+#include "fakeStochastics.h"
+#include "fakeWorld.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+using ::testing::NiceMock;
+using ::testing::NotNull;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace {
+
+//! Stochastics recording the agents, which requested an own random stream
+class AgentStreamStochastics : public core::Stochastics
+{
+public:
+    AgentStreamStochastics() :
+        core::Stochastics(nullptr)
+    {
+    }
+
+    std::shared_ptr<StochasticsInterface> CreateAgentStream(int agentId) override
+    {
+        agentIds.push_back(agentId);
+        return std::make_shared<NiceMock<FakeStochastics>>();
+    }
+
+    std::vector<int> agentIds;
+};
+
+class AgentFactoryTest : public ::testing::Test
+{
+public:
+    AgentFactoryTest()
+    {
+        for (int agentId = 0; agentId < 2; ++agentId)
+        {
+            ON_CALL(agentAdapters[agentId], GetId()).WillByDefault(Return(agentId));
+            ON_CALL(agentAdapters[agentId], GetSensorParameters()).WillByDefault(ReturnRef(sensorParameters));
+        }
+
+        ON_CALL(fakeAgentBlueprint, GetAgentType()).WillByDefault(ReturnRef(agentType));
+        EXPECT_CALL(fakeWorld, CreateAgentAdapter(_))
+            .WillOnce(ReturnRef(agentAdapters[0]))
+            .WillOnce(ReturnRef(agentAdapters[1]));
+    }
+
+    void AddAgents(core::AgentFactory &agentFactory)
+    {
+        ASSERT_THAT(agentFactory.AddAgent(&fakeAgentBlueprint), NotNull());
+        ASSERT_THAT(agentFactory.AddAgent(&fakeAgentBlueprint), NotNull());
+    }
+
+    NiceMock<FakeWorld> fakeWorld;
+    NiceMock<FakeDataBuffer> fakeDataBuffer;
+    NiceMock<FakeAgentBlueprint> fakeAgentBlueprint;
+    NiceMock<FakeAgent> agentAdapters[2];
+    openpass::sensors::Parameters sensorParameters;
+    core::AgentType agentType;
+    AgentStreamStochastics stochastics;
+};
+
+} // namespace
+
+TEST_F(AgentFactoryTest, SingleThreaded_AgentsDrawFromSharedStochastics)
+{
+    core::AgentFactory agentFactory(nullptr, &fakeWorld, &stochastics, nullptr, nullptr, &fakeDataBuffer, 1);
+
+    AddAgents(agentFactory);
+
+    EXPECT_THAT(stochastics.agentIds, IsEmpty());
+}
+
+TEST_F(AgentFactoryTest, Concurrent_EachAgentDrawsFromOwnStream)
+{
+    core::AgentFactory agentFactory(nullptr, &fakeWorld, &stochastics, nullptr, nullptr, &fakeDataBuffer, 4);
+
+    AddAgents(agentFactory);
+
+    EXPECT_THAT(stochastics.agentIds, ElementsAre(0, 1));
+}
+
+TEST(Stochastics, GetAgentSeed_DependsOnSeedAndAgentIdOnly)
+{
+    EXPECT_THAT(core::Stochastics::GetAgentSeed(42, 1), core::Stochastics::GetAgentSeed(42, 1));
+    EXPECT_THAT(core::Stochastics::GetAgentSeed(42, 1), ::testing::Ne(core::Stochastics::GetAgentSeed(42, 2)));
+    EXPECT_THAT(core::Stochastics::GetAgentSeed(42, 1), ::testing::Ne(core::Stochastics::GetAgentSeed(43, 1)));
+}
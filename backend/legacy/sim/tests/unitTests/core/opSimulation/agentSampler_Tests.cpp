@@ -32,6 +32,8 @@ using ::testing::ReturnRef;
 using ::testing::Eq;
 using ::testing::DoubleEq;
 using ::testing::NiceMock;
+using ::testing::Ne;
+using ::testing::ElementsAre;
 
 using namespace std::string_literals;
 
@@ -332,6 +334,59 @@ TEST(DynamicAgentTypeGenerator, GatherSensors)
     ASSERT_THAT(gatheredComponents.at("Sensor_7")->GetOutputLinks().at(3), Eq(101));
 }
 
+TEST(DynamicAgentTypeGenerator, ApplyTemplate_SharesComponentsAndReplacesSensorLatencies)
+{
+    NiceMock<FakeStochastics> fakeStochastics;
+    SampledProfiles sampledProfiles = SampledProfiles::make("", fakeStochastics, nullptr);
+    auto systemConfigBlueprint = std::make_shared<NiceMock<FakeSystemConfig>>();
+    NiceMock<FakeProfiles> profiles;
+    NiceMock<FakeVehicleModels> vehicleModels;
+    DynamicParameters templateParameters = DynamicParameters::empty();
+
+    AgentBuildInformation agentTypeTemplate = AgentBuildInformation::make(sampledProfiles, templateParameters, systemConfigBlueprint, &profiles, &vehicleModels);
+
+    const op::ParameterSetLevel1 sensorParameter{{"Latency", 0.5}, {"Id", 5}, {"Latency", 1.0}};
+    auto driver = std::make_shared<core::ComponentType>("Driver", false, 0, 0, 0, 0, "Driver");
+    auto sensor = std::make_shared<core::ComponentType>("Sensor_5", false, 0, 0, 0, 0, "SensorObjectDetector");
+    sensor->AddOutputLink(3, 100);
+    sensor->SetModelParameter(sensorParameter);
+    agentTypeTemplate.agentType->AddComponent(driver);
+    agentTypeTemplate.agentType->AddComponent(sensor);
+    agentTypeTemplate.agentType->AddChannel(100);
+
+    openpass::sensors::Parameter sensorA;
+    sensorA.id = 5;
+    sensorA.profile.parameter = sensorParameter;
+    agentTypeTemplate.sensorParameters = {sensorA};
+
+    DynamicParameters dynamicParameters = DynamicParameters::empty();
+    dynamicParameters.sensorLatencies = {{5, 2.0}};
+
+    AgentBuildInformation agentBuildInformation = AgentBuildInformation::make(sampledProfiles, dynamicParameters, systemConfigBlueprint, &profiles, &vehicleModels)
+            .ApplyTemplate(agentTypeTemplate);
+
+    const auto& components = agentBuildInformation.agentType->GetComponents();
+    ASSERT_THAT(components.size(), Eq(2));
+    EXPECT_THAT(components.at("Driver"), Eq(driver));
+    ASSERT_THAT(components.at("Sensor_5"), Ne(sensor));
+    EXPECT_THAT(components.at("Sensor_5")->GetOutputLinks().at(3), Eq(100));
+    EXPECT_THAT(agentBuildInformation.agentType->GetChannels(), ElementsAre(100));
+
+    const auto getLatency = [](const op::ParameterSetLevel1& parameters, size_t index)
+    {
+        return std::get<double>(std::get<op::internal::ParameterValue>(parameters.at(index).second));
+    };
+
+    const auto& gatheredSensorParameter = components.at("Sensor_5")->GetModelParameters();
+    EXPECT_THAT(getLatency(gatheredSensorParameter, 0), DoubleEq(0.5));
+    EXPECT_THAT(getLatency(gatheredSensorParameter, 2), DoubleEq(2.0));
+    ASSERT_THAT(agentBuildInformation.sensorParameters.size(), Eq(1));
+    EXPECT_THAT(getLatency(agentBuildInformation.sensorParameters.front().profile.parameter, 2), DoubleEq(2.0));
+
+    EXPECT_THAT(getLatency(sensor->GetModelParameters(), 2), DoubleEq(1.0));
+    EXPECT_THAT(getLatency(agentTypeTemplate.sensorParameters.front().profile.parameter, 2), DoubleEq(1.0));
+}
+
 TEST(DynamicAgentTypeGenerator, SetVehicleModelParameters)
 {
     NiceMock<FakeStochastics> fakeStochastics;
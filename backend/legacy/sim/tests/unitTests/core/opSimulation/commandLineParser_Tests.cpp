@@ -18,6 +18,7 @@
 
 #include <list>
 #include <algorithm>
+#include <stdexcept>
 
 using ::testing::SizeIs;
 
@@ -50,6 +51,7 @@ TEST(CommandLineParser, GivenAllValues_ParsesValuesAppropriately)
         "--lib", "testLibraryPath",
         "--configs", "testConfigPath",
         "--results", "testResultPath",
+        "--invocations", "10-19",
     });
 
     auto parsedArguments = CommandLineParser::Parse(qArguments);
@@ -59,6 +61,9 @@ TEST(CommandLineParser, GivenAllValues_ParsesValuesAppropriately)
     EXPECT_THAT(parsedArguments.libPath, "testLibraryPath");
     EXPECT_THAT(parsedArguments.configsPath, "testConfigPath");
     EXPECT_THAT(parsedArguments.resultsPath, "testResultPath");
+    ASSERT_TRUE(parsedArguments.invocations.has_value());
+    EXPECT_THAT(parsedArguments.invocations->first, 10);
+    EXPECT_THAT(parsedArguments.invocations->second, 19);
 }
 
 TEST(CommandLineParser, GivenNoValues_SetDefaultsAndLogsEntryForEachDefaultedValue)
@@ -70,6 +75,25 @@ TEST(CommandLineParser, GivenNoValues_SetDefaultsAndLogsEntryForEachDefaultedVal
     EXPECT_THAT(parsedArguments.libPath, "modules");
     EXPECT_THAT(parsedArguments.configsPath, "configs");
     EXPECT_THAT(parsedArguments.resultsPath, "results");
+    EXPECT_FALSE(parsedArguments.invocations.has_value());
 
-    EXPECT_THAT(CommandLineParser::GetParsingLog(), SizeIs(5));
+    EXPECT_THAT(CommandLineParser::GetParsingLog(), SizeIs(6));
+}
+
+TEST(CommandLineParser, GivenInvalidInvocations_Throws)
+{
+    for (const std::string invalidInvocations : {"19-10", "10", "10-", "first-last", "10-19-29"})
+    {
+        EXPECT_THROW(CommandLineParser::Parse(CREATE_ARGUMENTS({"--invocations", invalidInvocations})), std::invalid_argument)
+            << "invocations: " << invalidInvocations;
+    }
+}
+
+TEST(CommandLineParser, GivenSingleInvocation_ParsesRangeOfOneInvocation)
+{
+    auto parsedArguments = CommandLineParser::Parse(CREATE_ARGUMENTS({"--invocations", "7-7"}));
+
+    ASSERT_TRUE(parsedArguments.invocations.has_value());
+    EXPECT_THAT(parsedArguments.invocations->first, 7);
+    EXPECT_THAT(parsedArguments.invocations->second, 7);
 }
@@ -0,0 +1,69 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "invocations.h"
+
+using ::testing::Eq;
+
+using namespace core;
+
+namespace {
+
+ExperimentConfig CreateExperimentConfig(int numberOfInvocations)
+{
+    ExperimentConfig experimentConfig{};
+    experimentConfig.numberOfInvocations = numberOfInvocations;
+    return experimentConfig;
+}
+
+} // namespace
+
+TEST(Invocations, GetInvocations_WithoutRange_ReturnsAllInvocations)
+{
+    const auto invocations = GetInvocations(CreateExperimentConfig(100), std::nullopt);
+
+    EXPECT_THAT(invocations.first, Eq(0));
+    EXPECT_THAT(invocations.count, Eq(100));
+}
+
+TEST(Invocations, GetInvocations_WithRangeInsideExperiment_ReturnsRange)
+{
+    const auto invocations = GetInvocations(CreateExperimentConfig(100), std::make_pair(10, 19));
+
+    EXPECT_THAT(invocations.first, Eq(10));
+    EXPECT_THAT(invocations.count, Eq(10));
+}
+
+TEST(Invocations, GetInvocations_WithSingleInvocation_ReturnsOneInvocation)
+{
+    const auto invocations = GetInvocations(CreateExperimentConfig(100), std::make_pair(99, 99));
+
+    EXPECT_THAT(invocations.first, Eq(99));
+    EXPECT_THAT(invocations.count, Eq(1));
+}
+
+TEST(Invocations, GetInvocations_WithRangeExceedingExperiment_ClampsLastInvocation)
+{
+    const auto invocations = GetInvocations(CreateExperimentConfig(100), std::make_pair(90, 119));
+
+    EXPECT_THAT(invocations.first, Eq(90));
+    EXPECT_THAT(invocations.count, Eq(10));
+}
+
+TEST(Invocations, GetInvocations_WithRangeBehindExperiment_ReturnsNoInvocation)
+{
+    const auto invocations = GetInvocations(CreateExperimentConfig(100), std::make_pair(100, 119));
+
+    EXPECT_THAT(invocations.first, Eq(100));
+    EXPECT_THAT(invocations.count, Eq(0));
+}
@@ -0,0 +1,160 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "common/log.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#ifndef WIN32
+#include <csignal>
+#include <unistd.h>
+#endif
+
+using ::testing::Eq;
+using ::testing::IsEmpty;
+using ::testing::Not;
+using ::testing::SizeIs;
+
+namespace {
+
+std::vector<std::string> ReadLines(const std::filesystem::path &file)
+{
+    std::vector<std::string> lines;
+    std::ifstream stream{file};
+    for (std::string line; std::getline(stream, line);)
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+} // namespace
+
+TEST(LogOutputPolicy, OutputOfSeveralThreads_WritesAllMessagesInOrderOfEachThreadAfterFlush)
+{
+    const std::filesystem::path file{std::filesystem::temp_directory_path() / std::filesystem::path(std::tmpnam(nullptr)).filename()};
+    constexpr int numberOfThreads = 4;
+    constexpr int messagesPerThread = 10000;
+
+    LogOutputPolicy::SetFile(file.string());
+    ASSERT_TRUE(LogOutputPolicy::IsOpen());
+
+    std::vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex)
+    {
+        threads.emplace_back([threadIndex] {
+            for (int messageIndex = 0; messageIndex < messagesPerThread; ++messageIndex)
+            {
+                LogOutputPolicy::Output(std::to_string(threadIndex) + " " + std::to_string(messageIndex) + "\n");
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    LogOutputPolicy::Flush();
+
+    const auto lines = ReadLines(file);
+    ASSERT_THAT(lines, SizeIs(numberOfThreads * messagesPerThread));
+
+    std::vector<int> nextMessage(numberOfThreads, 0);
+    for (const auto &line : lines)
+    {
+        int threadIndex, messageIndex;
+        ASSERT_THAT(std::sscanf(line.c_str(), "%d %d", &threadIndex, &messageIndex), Eq(2));
+        ASSERT_THAT(messageIndex, Eq(nextMessage[threadIndex]++));
+    }
+
+    std::filesystem::remove(file);
+}
+
+TEST(LogOutputPolicy, OutputOfMessageLargerThanBuffer_WritesMessage)
+{
+    const std::filesystem::path file{std::filesystem::temp_directory_path() / std::filesystem::path(std::tmpnam(nullptr)).filename()};
+    const std::string message(1 << 20, 'x');
+
+    LogOutputPolicy::SetFile(file.string());
+    LogOutputPolicy::Output("first\n");
+    LogOutputPolicy::Output(message + "\n");
+    LogOutputPolicy::Flush();
+
+    const auto lines = ReadLines(file);
+    ASSERT_THAT(lines, SizeIs(2));
+    EXPECT_THAT(lines[0], Eq("first"));
+    EXPECT_THAT(lines[1], Eq(message));
+
+    std::filesystem::remove(file);
+}
+
+TEST(LogOutputPolicy, ErrorLog_IsWrittenWithoutFlush)
+{
+    const std::filesystem::path file{std::filesystem::temp_directory_path() / std::filesystem::path(std::tmpnam(nullptr)).filename()};
+
+    LogOutputPolicy::SetFile(file.string());
+    LogOutputPolicy::Output("queued\n");
+    LogFile().Get(__FILE__, __LINE__, LogLevel::Error) << "error";
+
+    const auto lines = ReadLines(file);
+    ASSERT_THAT(lines, SizeIs(2));
+    EXPECT_THAT(lines[0], Eq("queued"));
+    EXPECT_THAT(lines[1], ::testing::EndsWith("error"));
+
+    std::filesystem::remove(file);
+}
+
+TEST(LogOutputPolicy, SetFileWithInvalidPath_IsNotOpen)
+{
+    const std::filesystem::path file{std::filesystem::temp_directory_path() / std::filesystem::path(std::tmpnam(nullptr)).filename() / "missingDirectory" / "log.txt"};
+
+    LogOutputPolicy::SetFile(file.string());
+
+    EXPECT_FALSE(LogOutputPolicy::IsOpen());
+}
+
+#ifndef WIN32
+namespace {
+
+void ExitOnAbort(int)
+{
+    _exit(3);
+}
+
+} // namespace
+
+TEST(LogOutputPolicy, Crash_WritesQueuedMessagesAndCallsPreviousHandler)
+{
+    // the death test is executed in a new process, so the file name must not be random
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    const std::filesystem::path file{std::filesystem::temp_directory_path() / "logOutputPolicy_crash.log"};
+    std::filesystem::remove(file);
+
+    EXPECT_EXIT({
+        std::signal(SIGABRT, &ExitOnAbort);
+        LogOutputPolicy::SetFile(file.string());
+        LogOutputPolicy::Output("queued before crash\n");
+        std::abort();
+    }, ::testing::ExitedWithCode(3), "");
+
+    const auto lines = ReadLines(file);
+    ASSERT_THAT(lines, Not(IsEmpty()));
+    EXPECT_THAT(lines[0], Eq("queued before crash"));
+
+    std::filesystem::remove(file);
+}
+#endif
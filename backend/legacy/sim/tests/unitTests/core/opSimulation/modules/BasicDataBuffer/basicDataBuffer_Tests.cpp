@@ -76,7 +76,7 @@ public:
         cyclicStore = newStore;
     }
 
-    StoreIndex<EntityId> &GetEntityIdIndex()
+    EntityIndex &GetEntityIdIndex()
     {
         return entityIdIndex;
     }
@@ -271,9 +271,8 @@ TEST(BasicDataBuffer, PutCyclicData_CreatesIndices)
 
     auto &entityIdx = ds->GetEntityIdIndex();
 
-    auto firstEntityIdx = entityIdx.equal_range(agentId).first;
-
-    EXPECT_THAT(firstEntityIdx->second, Eq(expectedIndex));
+    ASSERT_THAT(entityIdx.at(agentId), SizeIs(1));
+    EXPECT_THAT(entityIdx.at(agentId).front(), Eq(expectedIndex));
 }
 
 TEST_F(BasicDataBuffer_GetCyclic_Test, GivenEntityIdAndKey_ReturnsCorrectData)
@@ -353,6 +352,122 @@ TEST_F(BasicDataBuffer_GetCyclic_Test, Result_IsIteratable)
     }
 }
 
+TEST_F(BasicDataBuffer_GetCyclic_Test, KeyPublishedAfterQuery_IsMatchedByRepeatedQuery)
+{
+    const auto result1 = implementation->GetCyclic(std::nullopt, "intVal");
+    implementation->PutCyclic(3, "intVal", 4);
+    const auto result2 = implementation->GetCyclic(std::nullopt, "intVal");
+
+    ASSERT_THAT(result1->size(), Eq(3));
+    ASSERT_THAT(result2->size(), Eq(4));
+    EXPECT_THAT(result2->at(3), Eq(CyclicRow{3, "intVal", 4}));
+}
+
+TEST(BasicDataBuffer, GivenHierarchicalKeys_ReturnsMatchingRowsInOrderOfInsertion)
+{
+    NiceMock<FakeCallback> fakeCallback;
+    BasicDataBufferImplementation implementation{&fakeRti, &fakeCallback};
+
+    implementation.PutCyclic(0, "Sensor/0/Range", 1);
+    implementation.PutCyclic(0, "Sensor/1/Range", 2);
+    implementation.PutCyclic(1, "Sensor/0/Range", 3);
+    implementation.PutCyclic(0, "Sensor/0/Angle", 4);
+
+    const auto result1 = implementation.GetCyclic(std::nullopt, "Sensor/*/Range");
+    const auto result2 = implementation.GetCyclic(0, "Sensor/0");
+
+    ASSERT_THAT(result1->size(), Eq(3));
+    EXPECT_THAT(result1->at(0), Eq(CyclicRow{0, "Sensor/0/Range", 1}));
+    EXPECT_THAT(result1->at(1), Eq(CyclicRow{0, "Sensor/1/Range", 2}));
+    EXPECT_THAT(result1->at(2), Eq(CyclicRow{1, "Sensor/0/Range", 3}));
+    ASSERT_THAT(result2->size(), Eq(2));
+    EXPECT_THAT(result2->at(0), Eq(CyclicRow{0, "Sensor/0/Range", 1}));
+    EXPECT_THAT(result2->at(1), Eq(CyclicRow{0, "Sensor/0/Angle", 4}));
+}
+
+TEST(BasicDataBuffer, GetCyclicsOfSelection_ReturnsSelectedRowsInOrderOfInsertion)
+{
+    NiceMock<FakeCallback> fakeCallback;
+    BasicDataBufferImplementation implementation{&fakeRti, &fakeCallback};
+
+    implementation.PutCyclic(0, "VelocityEgo", 1);
+    implementation.PutCyclic(0, "Sensor0_DetectedAgents", 2);
+    implementation.PutCyclic(1, "Sensor1_DetectedAgents", 3);
+    implementation.PutCyclic(1, "Sensor1_Range", 4);
+    implementation.PutCyclic(1, "VelocityEgo", 5);
+    implementation.PutCyclic(1, "VelocityEgo/Filtered", 6);
+
+    openpass::databuffer::KeySelection selection;
+    selection.Add("VelocityEgo");
+    selection.Add("Sensor*_DetectedAgents");
+
+    const auto result1 = implementation.GetCyclics(std::nullopt, selection);
+    const auto result2 = implementation.GetCyclics(1, selection);
+
+    ASSERT_THAT(result1->size(), Eq(4));
+    EXPECT_THAT(result1->at(0), Eq(CyclicRow{0, "VelocityEgo", 1}));
+    EXPECT_THAT(result1->at(1), Eq(CyclicRow{0, "Sensor0_DetectedAgents", 2}));
+    EXPECT_THAT(result1->at(2), Eq(CyclicRow{1, "Sensor1_DetectedAgents", 3}));
+    EXPECT_THAT(result1->at(3), Eq(CyclicRow{1, "VelocityEgo", 5}));
+    ASSERT_THAT(result2->size(), Eq(2));
+    EXPECT_THAT(result2->at(0), Eq(CyclicRow{1, "Sensor1_DetectedAgents", 3}));
+    EXPECT_THAT(result2->at(1), Eq(CyclicRow{1, "VelocityEgo", 5}));
+}
+
+TEST(BasicDataBuffer, GetCyclicsOfSelection_MatchesKeysPublishedAfterPreviousQuery)
+{
+    NiceMock<FakeCallback> fakeCallback;
+    BasicDataBufferImplementation implementation{&fakeRti, &fakeCallback};
+
+    openpass::databuffer::KeySelection selection;
+    selection.Add("Sensor*_DetectedAgents");
+
+    implementation.PutCyclic(0, "Sensor0_DetectedAgents", 1);
+    const auto result1 = implementation.GetCyclics(std::nullopt, selection);
+    implementation.PutCyclic(0, "Sensor1_DetectedAgents", 2);
+    implementation.PutCyclic(0, "Sensor1_Range", 3);
+    const auto result2 = implementation.GetCyclics(std::nullopt, selection);
+
+    ASSERT_THAT(result1->size(), Eq(1));
+    ASSERT_THAT(result2->size(), Eq(2));
+    EXPECT_THAT(result2->at(1), Eq(CyclicRow{0, "Sensor1_DetectedAgents", 2}));
+}
+
+TEST(KeySelection, Matches_ComparesWholeKeysAndPatterns)
+{
+    openpass::databuffer::KeySelection selection;
+    EXPECT_TRUE(selection.empty());
+
+    selection.Add("Lane");
+    selection.Add("Agent*Range");
+
+    EXPECT_FALSE(selection.empty());
+    EXPECT_TRUE(selection.Matches("Lane"));
+    EXPECT_FALSE(selection.Matches("LaneId"));
+    EXPECT_TRUE(selection.Matches("AgentRange"));
+    EXPECT_TRUE(selection.Matches("Agent_3_Range"));
+    EXPECT_FALSE(selection.Matches("AgentRang"));
+    EXPECT_FALSE(selection.Matches("Range"));
+}
+
+TEST(BasicDataBuffer, ClearTimeStep_KeysAreReusedInNextTimeStep)
+{
+    NiceMock<FakeCallback> fakeCallback;
+    BasicDataBufferImplementation implementation{&fakeRti, &fakeCallback};
+
+    implementation.PutCyclic(0, "key", 1);
+    implementation.PutCyclic(1, "key", 2);
+    implementation.ClearTimeStep();
+    implementation.PutCyclic(1, "key", 3);
+
+    const auto result = implementation.GetCyclic(std::nullopt, "key");
+
+    ASSERT_THAT(result->size(), Eq(1));
+    EXPECT_THAT(result->at(0), Eq(CyclicRow{1, "key", 3}));
+    EXPECT_THAT(implementation.GetCyclic(0, "key")->size(), Eq(0));
+    EXPECT_THAT(implementation.GetKeys("Cyclics"), ElementsAre("1"));
+}
+
 TEST(BasicDataBuffer, PutAcyclicData_StoresData)
 {
     FakeCallback fakeCallback;
@@ -19,6 +19,7 @@
 #include "fakeWorld.h"
 
 #include "CollisionDetector.h"
+#include "common/events/collisionEvent.h"
 
 using namespace testing;
 using ::testing::Return;
@@ -129,3 +130,81 @@ TEST(CollisionDetector, AgentLowerThanGapUnderTrafficObject_AgentDoesNotCollide)
     collisionDetector.Trigger(0);
 }
 
+
+namespace {
+
+polygon_t Square(double x, double y)
+{
+    polygon_t square;
+    square.outer().push_back(point_t{x, y});
+    square.outer().push_back(point_t{x, y + 2});
+    square.outer().push_back(point_t{x + 2, y + 2});
+    square.outer().push_back(point_t{x + 2, y});
+    return square;
+}
+
+} // namespace
+
+TEST(CollisionDetector, ManyAgents_CreatesEventsOnlyForOverlappingAgentsInOrderOfIds)
+{
+    std::vector<std::unique_ptr<NiceMock<FakeAgent>>> fakeAgents;
+    std::vector<polygon_t> boundingBoxes{Square(0, 0), Square(10, 0), Square(1, 1), Square(20, 0), Square(11, 1), Square(1.5, 0.5)};
+    std::map<int, AgentInterface *> agents;
+
+    for (int id = 0; id < static_cast<int>(boundingBoxes.size()); ++id)
+    {
+        auto &fakeAgent = fakeAgents.emplace_back(std::make_unique<NiceMock<FakeAgent>>());
+        ON_CALL(*fakeAgent, GetId()).WillByDefault(Return(id));
+        ON_CALL(*fakeAgent, GetBoundingBox2D()).WillByDefault(ReturnRef(boundingBoxes[id]));
+        agents.emplace(id, fakeAgent.get());
+    }
+
+    NiceMock<FakeWorld> mockWorld;
+    NiceMock<FakeEventNetwork> mockEventNetwork;
+    std::vector<const TrafficObjectInterface *> objects;
+    ON_CALL(mockWorld, GetTrafficObjects()).WillByDefault(ReturnRef(objects));
+    ON_CALL(mockWorld, GetAgents()).WillByDefault(Return(agents));
+
+    std::vector<std::pair<int, int>> collisions;
+    ON_CALL(mockEventNetwork, InsertEvent(_)).WillByDefault([&collisions](std::shared_ptr<EventInterface> event) {
+        const auto collisionEvent = std::dynamic_pointer_cast<openpass::events::CollisionEvent>(event);
+        collisions.emplace_back(collisionEvent->collisionAgentId, collisionEvent->collisionOpponentId);
+    });
+
+    CollisionDetector collisionDetector(&mockWorld, &mockEventNetwork, nullptr, nullptr);
+    collisionDetector.Trigger(0);
+
+    ASSERT_THAT(collisions, ElementsAre(std::make_pair(0, 2), std::make_pair(0, 5), std::make_pair(1, 4), std::make_pair(2, 5)));
+}
+
+TEST(CollisionDetector, TrafficObjectsAreIndexedOncePerRun)
+{
+    NiceMock<FakeTrafficObject> objectUnderTest;
+    NiceMock<FakeAgent> agentUnderTest;
+    NiceMock<FakeWorld> mockWorld;
+    NiceMock<FakeEventNetwork> mockEventNetwork;
+
+    std::vector<const TrafficObjectInterface *> objects = {&objectUnderTest};
+    std::map<int, AgentInterface *> agents = {{0, &agentUnderTest}};
+
+    ON_CALL(mockWorld, GetTrafficObjects()).WillByDefault(ReturnRef(objects));
+    ON_CALL(mockWorld, GetAgents()).WillByDefault(Return(agents));
+    ON_CALL(objectUnderTest, GetIsCollidable()).WillByDefault(Return(true));
+    ON_CALL(agentUnderTest, GetHeight()).WillByDefault(Return(5.));
+    polygon_t ownBoundingBox = Square(1, 1);
+    polygon_t otherBoundingBox = Square(100, 100);
+    ON_CALL(agentUnderTest, GetBoundingBox2D()).WillByDefault(ReturnRef(ownBoundingBox));
+    ON_CALL(objectUnderTest, GetBoundingBox2D()).WillByDefault(ReturnRef(otherBoundingBox));
+
+    CollisionDetector collisionDetector(&mockWorld, &mockEventNetwork, nullptr, nullptr);
+
+    EXPECT_CALL(mockEventNetwork, InsertEvent(_)).Times(0);
+    collisionDetector.Trigger(0);
+
+    // the next run uses another scenery
+    otherBoundingBox = Square(2, 2);
+    collisionDetector.Reset();
+
+    EXPECT_CALL(mockEventNetwork, InsertEvent(_)).Times(1);
+    collisionDetector.Trigger(0);
+}
@@ -0,0 +1,131 @@
+/********************************************************************************
+ * Copyright (c) 2022 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cmath>
+
+#include "collisionDetection_Impact_implementation.h"
+
+using ::testing::DoubleNear;
+using ::testing::Eq;
+
+namespace {
+
+//! Counter-clockwise corners of a rectangle (rear left, rear right, front right, front left)
+std::vector<Common::Vector2d> CreateRectangle(Common::Vector2d center, double length, double width, double yaw)
+{
+    std::vector<Common::Vector2d> corners{{-length / 2, width / 2},
+                                          {-length / 2, -width / 2},
+                                          {length / 2, -width / 2},
+                                          {length / 2, width / 2}};
+    for (auto &corner : corners)
+    {
+        corner.Rotate(yaw);
+        corner = corner + center;
+    }
+    return corners;
+}
+
+Common::Vector2d CreateVelocity(double absoluteVelocity, double direction)
+{
+    return {absoluteVelocity * std::cos(direction), absoluteVelocity * std::sin(direction)};
+}
+
+struct PosePair
+{
+    std::vector<Common::Vector2d> corners1;
+    std::vector<Common::Vector2d> corners2;
+    Common::Vector2d velocity1;
+    Common::Vector2d velocity2;
+};
+
+} // namespace
+
+class CollisionDetectionPostCrash_PosePairs : public ::testing::TestWithParam<PosePair>
+{
+};
+
+TEST_P(CollisionDetectionPostCrash_PosePairs, CalculateFirstContact_MatchesIterativeReference)
+{
+    const auto &posePair = GetParam();
+    CollisionDetectionPostCrash collisionDetection;
+
+    CollisionDetectionPostCrash::FirstContact firstContact;
+    ASSERT_TRUE(collisionDetection.CalculateFirstContact(posePair.corners1, posePair.corners2,
+                                                         posePair.velocity1, posePair.velocity2,
+                                                         firstContact));
+
+    int timeFirstContactIterative = 0;
+    ASSERT_TRUE(collisionDetection.CalculateFirstContactIterative(posePair.corners1, posePair.corners2,
+                                                                  posePair.velocity1, posePair.velocity2,
+                                                                  timeFirstContactIterative));
+
+    // the iterative search stops at the first intersecting millisecond
+    EXPECT_THAT(firstContact.time * 1000, DoubleNear(timeFirstContactIterative, 1.0));
+}
+
+INSTANTIATE_TEST_SUITE_P(CollisionDetectionPostCrash, CollisionDetectionPostCrash_PosePairs, ::testing::Values(
+    // rear-end
+    PosePair{CreateRectangle({0.0, 0.0}, 4.0, 2.0, 0.0), CreateRectangle({3.7, 0.5}, 4.0, 2.0, 0.0),
+             CreateVelocity(10.0, 0.0), CreateVelocity(5.0, 0.0)},
+    // head-on with lateral offset
+    PosePair{CreateRectangle({0.0, 0.0}, 4.0, 2.0, 0.0), CreateRectangle({3.8, 1.2}, 4.5, 1.8, M_PI),
+             CreateVelocity(15.0, 0.0), CreateVelocity(12.0, M_PI)},
+    // side impact
+    PosePair{CreateRectangle({0.0, 0.0}, 4.0, 2.0, 0.0), CreateRectangle({1.0, -2.7}, 4.0, 2.0, M_PI_2),
+             CreateVelocity(10.0, 0.0), CreateVelocity(8.0, M_PI_2)},
+    // oblique impact, corner to edge
+    PosePair{CreateRectangle({0.0, 0.0}, 4.0, 2.0, 0.3), CreateRectangle({2.2, 2.4}, 5.0, 2.0, -1.2),
+             CreateVelocity(12.0, 0.3), CreateVelocity(9.0, -1.2)},
+    // contact long before the current time
+    PosePair{CreateRectangle({0.0, 0.0}, 4.0, 2.0, 0.0), CreateRectangle({3.0, 0.0}, 4.0, 2.0, 0.0),
+             CreateVelocity(3.0, 0.0), CreateVelocity(0.5, 0.0)}));
+
+TEST(CollisionDetectionPostCrash, CalculateFirstContact_EdgeToEdge_FirstPointOfContactIsCenterOfTouchingEdges)
+{
+    const auto corners1 = CreateRectangle({0.0, 0.0}, 4.0, 2.0, 0.0);
+    const auto corners2 = CreateRectangle({3.5, 1.0}, 4.0, 2.0, 0.0);
+    CollisionDetectionPostCrash collisionDetection;
+
+    CollisionDetectionPostCrash::FirstContact firstContact;
+    ASSERT_TRUE(collisionDetection.CalculateFirstContact(corners1, corners2, {0.0, 0.0}, {-10.0, 0.0}, firstContact));
+
+    // the edges touch at x = 2 with an overlap from y = 0 to y = 1
+    // (the centroid of the intersection at the current time would be at x = 1.75)
+    EXPECT_THAT(firstContact.time, DoubleNear(-0.05, 1E-9));
+    EXPECT_THAT(firstContact.point.x, DoubleNear(2.0, 1E-9));
+    EXPECT_THAT(firstContact.point.y, DoubleNear(0.5, 1E-9));
+}
+
+TEST(CollisionDetectionPostCrash, CalculateFirstContact_VertexToEdge_FirstPointOfContactIsTouchingVertex)
+{
+    const auto corners1 = CreateRectangle({0.0, 0.0}, 4.0, 2.0, 0.0);
+    const auto corners2 = CreateRectangle({2.0 + M_SQRT2 - 0.1, 0.3}, 2.0, 2.0, M_PI_4);
+    CollisionDetectionPostCrash collisionDetection;
+
+    CollisionDetectionPostCrash::FirstContact firstContact;
+    ASSERT_TRUE(collisionDetection.CalculateFirstContact(corners1, corners2, {0.0, 0.0}, {-10.0, 0.0}, firstContact));
+
+    EXPECT_THAT(firstContact.time, DoubleNear(-0.01, 1E-9));
+    EXPECT_THAT(firstContact.point.x, DoubleNear(2.0, 1E-9));
+    EXPECT_THAT(firstContact.point.y, DoubleNear(0.3, 1E-9));
+}
+
+TEST(CollisionDetectionPostCrash, CalculateFirstContact_SameVelocities_ReturnsFalse)
+{
+    const auto corners1 = CreateRectangle({0.0, 0.0}, 4.0, 2.0, 0.0);
+    const auto corners2 = CreateRectangle({3.5, 0.0}, 4.0, 2.0, 0.0);
+    CollisionDetectionPostCrash collisionDetection;
+
+    CollisionDetectionPostCrash::FirstContact firstContact;
+    EXPECT_THAT(collisionDetection.CalculateFirstContact(corners1, corners2, {10.0, 0.0}, {10.0, 0.0}, firstContact), Eq(false));
+}
@@ -11,10 +11,15 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <filesystem>
+#include <fstream>
 #include <memory>
+#include <sstream>
 #include <variant>
 
+#include "observationColumnarCyclics.h"
 #include "observationCyclics.h"
+#include "observationCyclicsWriter.h"
 #include "observation_logImplementation.h"
 #include "runStatisticCalculation.h"
 
@@ -194,6 +199,177 @@ TEST(ObservationCyclics_Test, GetSamplesLineSamplesNotUntilEnd_ReturnsLineWithEm
     ASSERT_THAT(samplesLine, Eq(", 789, "));
 }
 
+TEST(ObservationCyclics_Test, GetSamplesLineWithTypedSamples_ReturnsFormattedLine)
+{
+    ObservationCyclics cyclics;
+    cyclics.Reserve(3);
+    cyclics.Insert(0, "ParameterA", 1.5);
+    cyclics.Insert(0, "ParameterB", 3);
+    cyclics.Insert(100, "ParameterA", std::string("text"));
+    cyclics.Insert(100, "ParameterC", std::vector<int>{1, 2});
+    cyclics.Insert(200, "ParameterD", true);
+
+    std::string samplesLine = cyclics.GetSamplesLine(0);
+    ASSERT_THAT(samplesLine, Eq("1.500000, 3, , "));
+    samplesLine = cyclics.GetSamplesLine(1);
+    ASSERT_THAT(samplesLine, Eq("text, , 1,2, "));
+    samplesLine = cyclics.GetSamplesLine(2);
+    ASSERT_THAT(samplesLine, Eq(", , , 1"));
+}
+
+TEST(ObservationCyclics_Test, ColumnChangingFromIntToDoubleToString_ConvertsPreviousSamples)
+{
+    ObservationCyclics cyclics;
+    cyclics.Insert(0, "01:Lane", -1);
+    cyclics.Insert(100, "01:Lane", 5);
+    cyclics.Insert(200, "01:Lane", 2.5);
+    cyclics.Insert(300, "01:Lane", std::string("none"));
+
+    EXPECT_THAT(cyclics.GetSamplesLine(0), Eq("-1"));
+    EXPECT_THAT(cyclics.GetSamplesLine(1), Eq("5"));
+    EXPECT_THAT(cyclics.GetSamplesLine(2), Eq("2.500000"));
+    EXPECT_THAT(cyclics.GetSamplesLine(3), Eq("none"));
+    EXPECT_THAT(std::get<std::vector<std::string>>(cyclics.GetColumns().at("01:Lane").GetSamples()), SizeIs(4));
+}
+
+TEST(ObservationCyclics_Test, ColumnsOfLateAndRemovedAgents_StoreOnlyTheirTimeSteps)
+{
+    ObservationCyclics cyclics;
+    cyclics.Reserve(5000);
+    cyclics.Insert(0, "ParameterA", 1);
+    cyclics.Insert(100, "ParameterA", 2);
+    cyclics.Insert(200, "ParameterB", 3);
+    cyclics.Insert(300, "ParameterB", 4);
+
+    const auto &columnA = cyclics.GetColumns().at("ParameterA");
+    const auto &columnB = cyclics.GetColumns().at("ParameterB");
+
+    EXPECT_THAT(columnB.GetFirstTimeStepIndex(), Eq(size_t{2}));
+    EXPECT_THAT(std::get<std::vector<int>>(columnB.GetSamples()), ElementsAre(3, 4));
+    EXPECT_THAT(std::get<std::vector<int>>(columnA.GetSamples()).capacity(), ::testing::Le(size_t{1000}));
+    EXPECT_THAT(cyclics.GetSamplesLine(1), Eq("2, "));
+    EXPECT_THAT(cyclics.GetSamplesLine(3), Eq(", 4"));
+}
+
+TEST(ObservationLog_IsLoggedCyclic, EmptyVector_IsNotLogged)
+{
+    EXPECT_FALSE(IsLoggedCyclic(std::vector<double>{}));
+    EXPECT_TRUE(IsLoggedCyclic(std::vector<double>{1.0}));
+}
+
+TEST(ObservationLog_IsLoggedCyclic, EmptyString_IsLogged)
+{
+    EXPECT_TRUE(IsLoggedCyclic(std::string{}));
+    EXPECT_TRUE(IsLoggedCyclic(0));
+}
+
+static std::string ReadFile(const std::string &filepath)
+{
+    std::ifstream file{filepath};
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+TEST(ObservationCyclicsWriter_Test, SeveralBlocks_WritesEachLineOnceAndHeaderIntoHeaderFile)
+{
+    const auto filepath = (std::filesystem::temp_directory_path() / "ObservationCyclicsWriter_Test.csv").string();
+    const auto headerFilepath = filepath + ObservationCyclicsWriter::HEADER_SUFFIX;
+
+    ObservationCyclicsWriter writer;
+    writer.StartRun(filepath);
+
+    ObservationCyclics block;
+    block.Insert(0, "B", 1);
+    block.Insert(100, "B", 2);
+    writer.Write(std::move(block));
+    writer.Wait();
+
+    EXPECT_THAT(ReadFile(filepath), Eq("0, 1\n"
+                                       "100, 2\n"));
+
+    block.Clear();
+    block.Insert(200, "A", std::string("x"));
+    block.Insert(300, "C", 2.5);
+    block.Insert(300, "B", 4);
+    writer.Write(std::move(block));
+
+    writer.FinishRun();
+    writer.Wait();
+
+    EXPECT_THAT(ReadFile(filepath), Eq("0, 1\n"
+                                       "100, 2\n"
+                                       "200, , x, \n"
+                                       "300, 4, , 2.500000\n"));
+    EXPECT_THAT(ReadFile(headerFilepath), Eq("Timestep, B, A, C\n"));
+
+    std::filesystem::remove(filepath);
+    std::filesystem::remove(headerFilepath);
+}
+
+TEST(ObservationCyclicsWriter_Test, FileCannotBeCreated_WaitThrows)
+{
+    ObservationCyclicsWriter writer;
+    writer.StartRun((std::filesystem::temp_directory_path() / "notExistingDirectory" / "Cyclics.csv").string());
+
+    EXPECT_THROW(writer.Wait(), std::runtime_error);
+}
+
+template <typename T>
+static T ReadLittleEndian(std::istream &stream)
+{
+    T value{0};
+    for (size_t byte = 0; byte < sizeof(T); ++byte)
+    {
+        value |= static_cast<T>(static_cast<unsigned char>(stream.get())) << (8 * byte);
+    }
+    return value;
+}
+
+TEST(ObservationColumnarCyclics_Test, Write_WritesRowPerTimeStepAndEntityAndTypedColumnPerKey)
+{
+    const auto filepath = (std::filesystem::temp_directory_path() / "ObservationColumnarCyclics_Test.ocyc").string();
+
+    ObservationCyclics cyclics;
+    cyclics.Insert(0, "00:Velocity", 1.5);
+    cyclics.Insert(0, "01:Velocity", 2.5);
+    cyclics.Insert(0, "00:Lane", -1);
+    cyclics.Insert(100, "01:Lane", std::string("x"));
+    cyclics.Insert(200, "10:Gear", 3);
+
+    ObservationColumnarCyclics::Write(filepath, cyclics);
+
+    std::ifstream file{filepath, std::ios::binary};
+    std::string magic(4, '\0');
+    file.read(magic.data(), 4);
+    ASSERT_THAT(magic, Eq("OPCY"));
+    ASSERT_THAT(ReadLittleEndian<uint32_t>(file), Eq(ObservationColumnarCyclics::FORMAT_VERSION));
+    ASSERT_THAT(ReadLittleEndian<uint32_t>(file), Eq(4u));
+    ASSERT_THAT(ReadLittleEndian<uint32_t>(file), Eq(5u));
+
+    std::vector<std::pair<std::string, char>> columns;
+    for (int column = 0; column < 5; ++column)
+    {
+        std::string name(ReadLittleEndian<uint32_t>(file), '\0');
+        file.read(name.data(), static_cast<std::streamsize>(name.size()));
+        const char typeCode = static_cast<char>(file.get());
+        file.seekg(static_cast<std::streamoff>(ReadLittleEndian<uint64_t>(file)), std::ios::cur);
+
+        columns.emplace_back(name, typeCode);
+    }
+
+    EXPECT_TRUE(file.good());
+    EXPECT_THAT(file.peek(), Eq(std::char_traits<char>::eof()));
+    EXPECT_THAT(columns, ElementsAre(Pair("Timestep", 'i'),
+                                     Pair("AgentId", 'i'),
+                                     Pair("Gear", 'i'),
+                                     Pair("Lane", 's'),
+                                     Pair("Velocity", 'd')));
+
+    file.close();
+    std::filesystem::remove(filepath);
+}
+
 TEST(RunStatisticCalculation_Test, DetermineEgoCollisionWithEgoCollision_SetsEgoCollisionTrue)
 {
     NiceMock<FakeWorld> fakeWorld;
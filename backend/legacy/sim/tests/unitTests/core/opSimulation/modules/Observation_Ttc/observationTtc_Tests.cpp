@@ -0,0 +1,283 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+
+#include "observation_ttc_implementation.h"
+
+#include "fakeAgent.h"
+#include "fakeCallback.h"
+#include "fakeParameter.h"
+#include "fakeRunResult.h"
+#include "fakeWorld.h"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+namespace {
+
+//! Position and velocity of an agent in one time step
+struct AgentState
+{
+    double positionX;
+    double velocityX;
+};
+
+//! Agents of one time step, by id
+using AgentStates = std::map<int, AgentState>;
+
+//! Front agent as determined by the linear search the observer used before sorting the agents
+int FindFrontAgentIdBySearch(const std::map<int, AgentInterface *> &agents, int ownId)
+{
+    const double posX = agents.at(ownId)->GetPositionX();
+    double minDistance = INFINITY;
+    int frontId = -1;
+
+    for (const auto &[id, otherAgent] : agents)
+    {
+        const double posXother = otherAgent->GetPositionX();
+        if ((otherAgent->GetId() != ownId) && (posX < posXother))
+        {
+            const double distance = posXother - posX;
+            if (minDistance > distance)
+            {
+                minDistance = distance;
+                frontId = otherAgent->GetId();
+            }
+        }
+    }
+
+    return frontId;
+}
+
+class ObservationTtc_Test : public ::testing::Test
+{
+public:
+    ObservationTtc_Test()
+    {
+        ON_CALL(fakeParameter, GetParametersString()).WillByDefault(ReturnRef(parameters));
+        ON_CALL(fakeWorld, GetAgents()).WillByDefault([this] { return agents; });
+
+        observation = std::make_unique<Observation_Ttc_Implementation>(nullptr, &fakeWorld, &fakeParameter, &fakeCallback, nullptr);
+        observation->OpSimulationPreHook();
+        observation->OpSimulationPreRunHook();
+    }
+
+    ~ObservationTtc_Test()
+    {
+        std::filesystem::remove(resultFile);
+    }
+
+    //! Replaces the agents of the world and executes a time step
+    void Step(int time, const AgentStates &agentStates)
+    {
+        fakeAgents.clear();
+        agents.clear();
+
+        for (const auto &[id, state] : agentStates)
+        {
+            auto &fakeAgent = fakeAgents.emplace(id, std::make_unique<NiceMock<FakeAgent>>()).first->second;
+            ON_CALL(*fakeAgent, GetId()).WillByDefault(Return(id));
+            ON_CALL(*fakeAgent, GetPositionX()).WillByDefault(Return(state.positionX));
+            ON_CALL(*fakeAgent, GetVelocity(_)).WillByDefault(Return(Common::Vector2d{state.velocityX, 0.0}));
+            agents.emplace(id, fakeAgent.get());
+        }
+
+        observation->OpSimulationUpdateHook(time, runResult);
+    }
+
+    //! Finishes the run and returns the content of the result file
+    std::string FinishRun()
+    {
+        observation->OpSimulationPostRunHook(runResult);
+
+        std::ifstream file{resultFile};
+        std::stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    //! Writes the result file of one run with the front agents of the linear search
+    static std::string WriteExpectedResult(const std::vector<std::pair<int, AgentStates>> &steps)
+    {
+        std::map<int, std::map<int, double>> agentsTtc;
+        std::map<int, double> agentsMinTtc;
+
+        for (const auto &[time, agentStates] : steps)
+        {
+            std::map<int, std::unique_ptr<NiceMock<FakeAgent>>> stepAgents;
+            std::map<int, AgentInterface *> stepAgentInterfaces;
+            for (const auto &[id, state] : agentStates)
+            {
+                auto &fakeAgent = stepAgents.emplace(id, std::make_unique<NiceMock<FakeAgent>>()).first->second;
+                ON_CALL(*fakeAgent, GetId()).WillByDefault(Return(id));
+                ON_CALL(*fakeAgent, GetPositionX()).WillByDefault(Return(state.positionX));
+                stepAgentInterfaces.emplace(id, fakeAgent.get());
+            }
+
+            for (const auto &[id, state] : agentStates)
+            {
+                const int frontId = FindFrontAgentIdBySearch(stepAgentInterfaces, id);
+                if (frontId < 0)
+                {
+                    continue;
+                }
+
+                const auto &frontState = agentStates.at(frontId);
+                double ttc = -(frontState.positionX - state.positionX) / (frontState.velocityX - state.velocityX);
+                if (ttc < 0)
+                {
+                    ttc = INFINITY;
+                }
+
+                const auto [minTtc, inserted] = agentsMinTtc.emplace(id, ttc);
+                if (!inserted && minTtc->second > ttc)
+                {
+                    minTtc->second = ttc;
+                }
+                agentsTtc[id].emplace(time, ttc);
+            }
+        }
+
+        std::ostringstream result;
+        result << "RunID;AgentID;minimal TTC;";
+        for (const auto &step : steps)
+        {
+            result << step.first << ";";
+        }
+        result << "\n0";
+
+        for (const auto &[id, ttcs] : agentsTtc)
+        {
+            result << ";" << id << ";" << agentsMinTtc.at(id) << ";";
+            for (const auto &step : steps)
+            {
+                if (const auto ttc = ttcs.find(step.first); ttc != ttcs.end())
+                {
+                    result << ttc->second;
+                }
+                result << ";";
+            }
+            result << "\n";
+        }
+        result << "\n";
+
+        return result.str();
+    }
+
+    const std::string resultFileName{"ObservationTtc_Test.csv"};
+    const std::string resultFile{(std::filesystem::temp_directory_path() / resultFileName).string()};
+    const std::map<std::string, const std::string> parameters{{"0", std::filesystem::temp_directory_path().string()},
+                                                              {"1", "ObservationTtc_Test.tmp"},
+                                                              {"2", resultFileName}};
+
+    NiceMock<FakeParameter> fakeParameter;
+    NiceMock<FakeWorld> fakeWorld;
+    NiceMock<FakeCallback> fakeCallback;
+    NiceMock<FakeRunResult> runResult;
+    std::map<int, std::unique_ptr<NiceMock<FakeAgent>>> fakeAgents;
+    std::map<int, AgentInterface *> agents;
+    std::unique_ptr<Observation_Ttc_Implementation> observation;
+};
+
+} // namespace
+
+TEST_F(ObservationTtc_Test, AgentsAtSamePosition_HaveSameFrontAgentAndAreNotInFrontOfEachOther)
+{
+    Step(0, {{0, {0.0, 20.0}}, {1, {10.0, 10.0}}, {2, {10.0, 10.0}}, {3, {30.0, 0.0}}});
+
+    EXPECT_THAT(FinishRun(), Eq("RunID;AgentID;minimal TTC;0;\n"
+                                "0;0;1;1;\n"
+                                ";1;2;2;\n"
+                                ";2;2;2;\n"
+                                "\n"));
+}
+
+TEST_F(ObservationTtc_Test, AgentsWithoutApproachingFrontAgent_HaveInfiniteTtc)
+{
+    Step(0, {{0, {0.0, 10.0}}, {1, {10.0, 20.0}}});
+
+    EXPECT_THAT(FinishRun(), Eq("RunID;AgentID;minimal TTC;0;\n"
+                                "0;0;inf;inf;\n"
+                                "\n"));
+}
+
+TEST_F(ObservationTtc_Test, AgentIdsWithGaps_AreEvaluatedByTheirIds)
+{
+    Step(0, {{1, {0.0, 20.0}}, {4, {10.0, 10.0}}, {7, {20.0, 0.0}}});
+
+    EXPECT_THAT(FinishRun(), Eq("RunID;AgentID;minimal TTC;0;\n"
+                                "0;1;1;1;\n"
+                                ";4;1;1;\n"
+                                "\n"));
+}
+
+TEST_F(ObservationTtc_Test, RemovedAgent_KeepsItsTtcAndLeavesLaterTimeStepsBlank)
+{
+    Step(0, {{0, {0.0, 20.0}}, {1, {10.0, 10.0}}, {3, {20.0, 5.0}}});
+    Step(100, {{0, {0.0, 20.0}}, {3, {20.0, 5.0}}});
+
+    EXPECT_THAT(FinishRun(), Eq("RunID;AgentID;minimal TTC;0;100;\n"
+                                "0;0;1;1;1.33333;\n"
+                                ";1;2;2;;\n"
+                                "\n"));
+}
+
+TEST_F(ObservationTtc_Test, RepeatedTimeStep_KeepsFirstTtc)
+{
+    Step(0, {{0, {0.0, 20.0}}, {1, {10.0, 10.0}}});
+    Step(0, {{0, {5.0, 20.0}}, {1, {10.0, 10.0}}});
+
+    EXPECT_THAT(FinishRun(), Eq("RunID;AgentID;minimal TTC;0;\n"
+                                "0;0;0.5;1;\n"
+                                "\n"));
+}
+
+TEST_F(ObservationTtc_Test, RandomTraffic_WritesSameResultAsLinearSearch)
+{
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> position{0, 20};
+    std::uniform_int_distribution<int> velocity{0, 8};
+    std::bernoulli_distribution isPresent{0.8};
+
+    std::vector<std::pair<int, AgentStates>> steps;
+    for (int time = 0; time < 1000; time += 100)
+    {
+        AgentStates agentStates;
+        for (int id = 0; id < 30; ++id)
+        {
+            // coarse positions produce agents at the same position, missing ids produce gaps and removed agents
+            if (isPresent(generator))
+            {
+                agentStates.emplace(id, AgentState{5.0 * position(generator), 5.0 * velocity(generator)});
+            }
+        }
+        steps.emplace_back(time, agentStates);
+    }
+
+    for (const auto &[time, agentStates] : steps)
+    {
+        Step(time, agentStates);
+    }
+
+    EXPECT_THAT(FinishRun(), Eq(WriteExpectedResult(steps)));
+}
@@ -18,12 +18,19 @@
 using ::testing::NiceMock;
 using ::testing::_;
 using ::testing::Return;
+using ::testing::ReturnPointee;
 using ::testing::ReturnRef;
 using ::testing::Eq;
 using ::testing::VariantWith;
 using ::testing::ElementsAre;
 using ::testing::SizeIs;
 
+class FakeRouteStreamCache : public RouteStreamCacheInterface
+{
+public:
+    MOCK_METHOD0(Clear, void());
+};
+
 TEST(EgoAgent_Test, GetDistanceToEndOfLane)
 {
     NiceMock<FakeAgent> fakeAgent;
@@ -127,6 +134,63 @@ TEST(EgoAgent_Test, GetTrafficSignsInRange)
     ASSERT_THAT(result, SizeIs(1));
 }
 
+TEST(EgoAgent_Test, SetRoadGraph_CreatesRouteStreamCacheOnlyOnce)
+{
+    NiceMock<FakeAgent> fakeAgent;
+    NiceMock<FakeWorld> fakeWorld;
+
+    GlobalRoadPositions agentPosition{{"Road1", GlobalRoadPosition{"Road1", -2, 12, 0, 0}}};
+    ON_CALL(fakeAgent, GetRoadPosition(VariantWith<ObjectPointPredefined>(ObjectPointPredefined::FrontCenter))).WillByDefault(ReturnRef(agentPosition));
+    std::vector<std::string> roads{"Road1"};
+    ON_CALL(fakeAgent, GetRoads(_)).WillByDefault(Return(roads));
+
+    RoadGraph roadGraph;
+    RoadGraphVertex root = add_vertex(RouteElement{"Road1", true}, roadGraph);
+    RoadGraphVertex target = add_vertex(RouteElement{"Road2", true}, roadGraph);
+    add_edge(root, target, roadGraph);
+
+    auto routeStreamCache = std::make_shared<NiceMock<FakeRouteStreamCache>>();
+    EXPECT_CALL(fakeWorld, CreateRouteStreamCache(_)).Times(1).WillOnce(Return(routeStreamCache));
+
+    EgoAgent egoAgent {&fakeAgent, &fakeWorld};
+    egoAgent.SetRoadGraph(RoadGraph{roadGraph}, root, target);
+
+    EXPECT_CALL(*routeStreamCache, Clear()).Times(1);
+    egoAgent.SetRoadGraph(std::move(roadGraph), root, target);
+}
+
+TEST(EgoAgent_Test, Update_ClearsRouteStreamCacheOnlyIfRoadChanges)
+{
+    NiceMock<FakeAgent> fakeAgent;
+    NiceMock<FakeWorld> fakeWorld;
+
+    GlobalRoadPositions agentPosition{{"Road1", GlobalRoadPosition{"Road1", -2, 12, 0, 0}},
+                                      {"Road2", GlobalRoadPosition{"Road2", -2, 0, 0, 0}}};
+    ON_CALL(fakeAgent, GetRoadPosition(VariantWith<ObjectPointPredefined>(ObjectPointPredefined::FrontCenter))).WillByDefault(ReturnRef(agentPosition));
+    std::vector<std::string> roads{"Road1"};
+    ON_CALL(fakeAgent, GetRoads(_)).WillByDefault(ReturnPointee(&roads));
+
+    RoadGraph roadGraph;
+    RoadGraphVertex root = add_vertex(RouteElement{"Road1", true}, roadGraph);
+    RoadGraphVertex target = add_vertex(RouteElement{"Road2", true}, roadGraph);
+    add_edge(root, target, roadGraph);
+
+    auto routeStreamCache = std::make_shared<NiceMock<FakeRouteStreamCache>>();
+    ON_CALL(fakeWorld, CreateRouteStreamCache(_)).WillByDefault(Return(routeStreamCache));
+
+    EgoAgent egoAgent {&fakeAgent, &fakeWorld};
+    egoAgent.SetRoadGraph(std::move(roadGraph), root, target);
+
+    EXPECT_CALL(*routeStreamCache, Clear()).Times(0);
+    egoAgent.Update();
+    testing::Mock::VerifyAndClearExpectations(routeStreamCache.get());
+
+    roads = {"Road2"};
+    EXPECT_CALL(*routeStreamCache, Clear()).Times(1);
+    egoAgent.Update();
+    ASSERT_THAT(egoAgent.GetRoadId(), Eq("Road2"));
+}
+
 TEST(EgoAgent_Test, GetReferencePointPosition_FirstRoad)
 {
     NiceMock<FakeAgent> fakeAgent;
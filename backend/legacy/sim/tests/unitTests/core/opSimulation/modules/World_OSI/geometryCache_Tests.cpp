@@ -0,0 +1,103 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "GeometryCache.h"
+
+#include <cstdio>
+#include <filesystem>
+
+using ::testing::Eq;
+using ::testing::SizeIs;
+
+namespace {
+
+GeometryCache::SceneryGeometry CreateGeometry()
+{
+    GeometryCache::SceneryGeometry geometry;
+
+    geometry.sections.push_back({"Road1", 1, {{0.0, {{0, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, 0.1, 0.0},
+                                                     {-1, {0.0, 0.0}, {0.0, -1.5}, {0.0, -3.0}, 0.1, 0.01}}},
+                                              {10.0, {{0, {10.0, 0.0}, {10.0, 0.0}, {10.0, 0.0}, 0.1, 0.0},
+                                                      {-1, {10.0, 0.0}, {10.0, -1.5}, {10.0, -3.0}, 0.1, 0.01}}}}});
+    geometry.intersections.push_back({"Junction", "Road1", "Road2", IntersectingConnectionRank::Higher,
+                                      {{{{1, -1}, {0, 2}}, {3.0, 7.5}}}});
+
+    return geometry;
+}
+
+} // namespace
+
+class GeometryCacheTest : public ::testing::Test
+{
+public:
+    ~GeometryCacheTest()
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    const std::filesystem::path directory{std::filesystem::temp_directory_path() / std::filesystem::path(std::tmpnam(nullptr)).filename()};
+    const std::filesystem::path file{directory / "cache.opgc"};
+};
+
+TEST_F(GeometryCacheTest, ReadWrittenFile_ReturnsWrittenGeometry)
+{
+    ASSERT_TRUE(GeometryCache::Write(file, "hash", CreateGeometry()));
+
+    const auto geometry = GeometryCache::Read(file, "hash");
+
+    ASSERT_TRUE(geometry.has_value());
+    ASSERT_THAT(geometry->sections, SizeIs(1));
+    const auto& section = geometry->sections.front();
+    EXPECT_THAT(section.roadId, Eq("Road1"));
+    EXPECT_THAT(section.sectionIndex, Eq(1));
+    ASSERT_THAT(section.joints, SizeIs(2));
+    EXPECT_THAT(section.joints[1].s, Eq(10.0));
+    ASSERT_THAT(section.joints[1].laneJoints, SizeIs(2));
+    const auto& laneJoint = section.joints[1].laneJoints[1];
+    EXPECT_THAT(laneJoint.laneId, Eq(-1));
+    EXPECT_THAT(laneJoint.center.y, Eq(-1.5));
+    EXPECT_THAT(laneJoint.right.x, Eq(10.0));
+    EXPECT_THAT(laneJoint.right.y, Eq(-3.0));
+    EXPECT_THAT(laneJoint.curvature, Eq(0.01));
+
+    ASSERT_THAT(geometry->intersections, SizeIs(1));
+    const auto& intersection = geometry->intersections.front();
+    EXPECT_THAT(intersection.junctionId, Eq("Junction"));
+    EXPECT_THAT(intersection.roadId, Eq("Road1"));
+    EXPECT_THAT(intersection.intersectingRoad, Eq("Road2"));
+    EXPECT_THAT(intersection.relativeRank, Eq(IntersectingConnectionRank::Higher));
+    ASSERT_THAT(intersection.sOffsets, SizeIs(1));
+    EXPECT_THAT(intersection.sOffsets.front().first.first, Eq(GeometryCache::LaneKey{1, -1}));
+    EXPECT_THAT(intersection.sOffsets.front().first.second, Eq(GeometryCache::LaneKey{0, 2}));
+    EXPECT_THAT(intersection.sOffsets.front().second.first, Eq(3.0));
+    EXPECT_THAT(intersection.sOffsets.front().second.second, Eq(7.5));
+}
+
+TEST_F(GeometryCacheTest, ReadFileOfOtherScenery_ReturnsNothing)
+{
+    ASSERT_TRUE(GeometryCache::Write(file, "hash", CreateGeometry()));
+
+    EXPECT_FALSE(GeometryCache::Read(file, "otherHash").has_value());
+}
+
+TEST_F(GeometryCacheTest, ReadTruncatedFile_ReturnsNothing)
+{
+    ASSERT_TRUE(GeometryCache::Write(file, "hash", CreateGeometry()));
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) - 1);
+
+    EXPECT_FALSE(GeometryCache::Read(file, "hash").has_value());
+}
+
+TEST_F(GeometryCacheTest, ReadMissingFile_ReturnsNothing)
+{
+    EXPECT_FALSE(GeometryCache::Read(file, "hash").has_value());
+}
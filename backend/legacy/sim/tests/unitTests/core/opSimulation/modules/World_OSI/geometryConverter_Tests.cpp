@@ -18,6 +18,7 @@
 #include "fakeRoadLaneSection.h"
 #include "fakeRoadGeometry.h"
 #include "fakeOdRoad.h"
+#include "fakeWorldData.h"
 
 using namespace testing;
 using ::testing::_;
@@ -374,3 +375,80 @@ INSTANTIATE_TEST_CASE_P(RamerDouglasPeucker_UnitTests, RamerDouglasPeucker_UnitT
                             RamerDouglasPeucker_UnitTests_Data{{joint0, joint500b, joint600b, joint700b, joint1000}},
                             RamerDouglasPeucker_UnitTests_Data{{joint0, joint500b, joint600c, joint700b, joint1000}}
                         ));
+
+namespace {
+
+class FakeScenery : public SceneryInterface
+{
+public:
+    MOCK_METHOD0(Clear, void());
+    MOCK_METHOD1(AddRoad, RoadInterface *(const std::string &id));
+    MOCK_METHOD1(AddJunction, JunctionInterface *(const std::string &id));
+    MOCK_CONST_METHOD0(GetRoads, const std::map<std::string, RoadInterface *> &());
+    MOCK_CONST_METHOD1(GetRoad, const RoadInterface *(const std::string &id));
+    MOCK_CONST_METHOD0(GetJunctions, const std::map<std::string, JunctionInterface *> &());
+    MOCK_CONST_METHOD1(GetJunction, const JunctionInterface *(const std::string &id));
+    MOCK_CONST_METHOD0(GetContentHash, std::string());
+    MOCK_CONST_METHOD0(GetGeometryCacheDirectory, std::string());
+};
+
+} // namespace
+
+TEST(GeometryConverter_UnitTests, GetCacheKey_DependsOnContentHash)
+{
+    EXPECT_THAT(GeometryConverter::GetCacheKey("hash"), Eq(GeometryConverter::GetCacheKey("hash")));
+    EXPECT_THAT(GeometryConverter::GetCacheKey("hash"), Ne(GeometryConverter::GetCacheKey("otherHash")));
+    EXPECT_THAT(GeometryConverter::GetCacheKey("hash"), Ne("hash"));
+}
+
+class GeometryConverterMatchesSceneryTest : public ::testing::Test
+{
+public:
+    GeometryConverterMatchesSceneryTest()
+    {
+        ON_CALL(scenery, GetRoads()).WillByDefault(ReturnRef(roads));
+        ON_CALL(road, GetLaneSections()).WillByDefault(ReturnRef(laneSections));
+        ON_CALL(laneSection, GetLanes()).WillByDefault(ReturnRef(lanes));
+        ON_CALL(worldData, GetRoads()).WillByDefault(ReturnRef(worldRoads));
+        ON_CALL(worldData, GetJunctions()).WillByDefault(ReturnRef(junctions));
+    }
+
+    GeometryCache::SceneryGeometry CreateGeometry(const std::string& roadId, uint32_t sectionIndex, int laneId)
+    {
+        GeometryCache::SceneryGeometry geometry;
+        geometry.sections.push_back({roadId, sectionIndex, {{0.0, {{laneId, {0.0, 0.0}, {0.0, -1.5}, {0.0, -3.0}, 0.0, 0.0}}}}});
+        return geometry;
+    }
+
+    NiceMock<FakeScenery> scenery;
+    NiceMock<FakeOdRoad> road;
+    NiceMock<FakeRoadLaneSection> laneSection;
+    NiceMock<FakeRoadLane> lane;
+    NiceMock<OWL::Fakes::WorldData> worldData;
+
+    std::map<int, RoadLaneInterface*> lanes{{-1, &lane}};
+    std::vector<RoadLaneSectionInterface*> laneSections{&laneSection};
+    std::map<std::string, RoadInterface*> roads{{"Road", &road}};
+    std::unordered_map<std::string, OWL::Interfaces::Road*> worldRoads;
+    std::map<std::string, OWL::Junction*> junctions;
+};
+
+TEST_F(GeometryConverterMatchesSceneryTest, GeometryOfExistingLanes_Matches)
+{
+    EXPECT_TRUE(GeometryConverter::MatchesScenery(scenery, worldData, CreateGeometry("Road", 0, -1)));
+}
+
+TEST_F(GeometryConverterMatchesSceneryTest, GeometryOfUnknownRoadSectionOrLane_DoesNotMatch)
+{
+    EXPECT_FALSE(GeometryConverter::MatchesScenery(scenery, worldData, CreateGeometry("OtherRoad", 0, -1)));
+    EXPECT_FALSE(GeometryConverter::MatchesScenery(scenery, worldData, CreateGeometry("Road", 1, -1)));
+    EXPECT_FALSE(GeometryConverter::MatchesScenery(scenery, worldData, CreateGeometry("Road", 0, -2)));
+}
+
+TEST_F(GeometryConverterMatchesSceneryTest, IntersectionOfUnknownJunction_DoesNotMatch)
+{
+    auto geometry = CreateGeometry("Road", 0, -1);
+    geometry.intersections.push_back({"Junction", "Road", "OtherRoad", IntersectingConnectionRank::Higher, {}});
+
+    EXPECT_FALSE(GeometryConverter::MatchesScenery(scenery, worldData, geometry));
+}
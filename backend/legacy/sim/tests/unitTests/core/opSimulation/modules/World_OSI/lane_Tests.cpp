@@ -775,3 +775,35 @@ TEST(GetLaneDirection, LaneWidthQueryOnRotatedCurvedLane_ReturnsCorrectDirection
     ASSERT_DOUBLE_EQ(lane.GetDirection(length / 2.0), direction1 + (direction2 - direction1) * length / 2.0);
     ASSERT_DOUBLE_EQ(lane.GetDirection(length), direction2);
 }
+
+TEST(ClearMovingObjects, LaneWithMovingAndStationaryObject_KeepsStationaryObjectOnly)
+{
+    osi3::Lane osiLane;
+    OWL::Implementation::Lane lane(&osiLane, nullptr, -1);
+    OWL::Fakes::MovingObject movingObject;
+    OWL::Fakes::StationaryObject stationaryObject;
+    OWL::LaneOverlap movingOverlap{GlobalRoadPosition{"",0,10,0,0},
+                                   GlobalRoadPosition{"",0,15,0,0},
+                                   GlobalRoadPosition{"",0,12,0,0},
+                                   GlobalRoadPosition{"",0,12,0,0}};
+    OWL::LaneOverlap stationaryOverlap{GlobalRoadPosition{"",0,20,0,0},
+                                       GlobalRoadPosition{"",0,25,0,0},
+                                       GlobalRoadPosition{"",0,22,0,0},
+                                       GlobalRoadPosition{"",0,22,0,0}};
+    lane.AddStationaryObject(stationaryObject, stationaryOverlap);
+    lane.AddMovingObject(movingObject, movingOverlap);
+    ASSERT_THAT(lane.GetWorldObjects(true).size(), Eq(2));
+
+    lane.ClearMovingObjects();
+
+    ASSERT_THAT(lane.GetWorldObjects(true).size(), Eq(1));
+    EXPECT_THAT(lane.GetWorldObjects(true).front().second, Eq(&stationaryObject));
+
+    lane.AddMovingObject(movingObject, movingOverlap);
+    ASSERT_THAT(lane.GetWorldObjects(true).size(), Eq(2));
+
+    lane.ClearMovingObjects();
+    lane.ClearMovingObjects();
+
+    ASSERT_THAT(lane.GetWorldObjects(true).size(), Eq(1));
+}
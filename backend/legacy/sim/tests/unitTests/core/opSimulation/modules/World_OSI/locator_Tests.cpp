@@ -200,6 +200,28 @@ TEST_F(LocateTest, WorldObject_OffRoute)
     ASSERT_THAT(result.touchedRoads.size(), Eq(2));
 }
 
+TEST_F(LocateTest, WorldObjectDeferred_ReturnsSameResultAsLocateAndLaneOverlaps)
+{
+    OWL::Fakes::MovingObject object;
+    OWL::Primitive::AbsPosition referencePoint;
+    referencePoint.x = 2;
+    referencePoint.y = 2;
+    OWL::Primitive::AbsOrientation orientation;
+    orientation.yaw = 0;
+    ON_CALL(object, GetReferencePointPosition()).WillByDefault(Return(referencePoint));
+    ON_CALL(object, GetAbsOrientation()).WillByDefault(Return(orientation));
+    polygon_t boundingBox{{{1,1},{1,3},{3,3},{3,1}}};
+    const auto expectedResult = localizer.Locate(boundingBox, object);
+    const auto pendingResult = localizer.LocateDeferred(boundingBox, object);
+
+    ASSERT_THAT(pendingResult.result.isOnRoute, Eq(expectedResult.isOnRoute));
+    ASSERT_THAT(pendingResult.result.touchedRoads.size(), Eq(expectedResult.touchedRoads.size()));
+    ASSERT_THAT(pendingResult.result.points.at(ObjectPointPredefined::Reference).size(), Eq(1));
+    ASSERT_THAT(pendingResult.laneOverlaps, SizeIs(2));
+    EXPECT_THAT(pendingResult.laneOverlaps.count(&lane1), Eq(1));
+    EXPECT_THAT(pendingResult.laneOverlaps.count(&lane3), Eq(1));
+}
+
 TEST_F(LocateTest, Point_InsideTwoRoads)
 {
     const auto result = localizer.Locate({2,0},0);
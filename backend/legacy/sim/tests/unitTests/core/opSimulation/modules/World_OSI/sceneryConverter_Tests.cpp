@@ -86,6 +86,8 @@ public:
     MOCK_CONST_METHOD1(GetRoad, RoadInterface *(const std::string &id));
     MOCK_CONST_METHOD0(GetJunctions, std::map<std::string, JunctionInterface *> &());
     MOCK_CONST_METHOD1(GetJunction, JunctionInterface *(const std::string &id));
+    MOCK_CONST_METHOD0(GetContentHash, std::string());
+    MOCK_CONST_METHOD0(GetGeometryCacheDirectory, std::string());
 };
 
 class FakeRoadLink : public RoadLinkInterface
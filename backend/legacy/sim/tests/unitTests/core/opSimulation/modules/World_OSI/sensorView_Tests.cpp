@@ -213,3 +213,30 @@ TEST(SensorViewTests, AddHostVehicleToSensorView_SetsHostVehicleAndLaneAssignmen
         }
     }
 }
+
+TEST(SensorViewTests, AppendGroundTruthToSensorView_MergesGroundTruthIntoSensorView)
+{
+    osi3::SensorView dynamicSensorView;
+    dynamicSensorView.mutable_host_vehicle_id()->set_value(11);
+    dynamicSensorView.mutable_global_ground_truth()->add_moving_object()->mutable_id()->set_value(11);
+    dynamicSensorView.mutable_global_ground_truth()->add_lane()->mutable_id()->set_value(101);
+
+    osi3::GroundTruth staticGroundTruth;
+    staticGroundTruth.add_lane()->mutable_id()->set_value(102);
+    staticGroundTruth.add_lane_boundary()->mutable_id()->set_value(201);
+
+    std::string serializedSensorView = dynamicSensorView.SerializeAsString();
+    OWL::WorldData::AppendGroundTruthToSensorView(staticGroundTruth.SerializeAsString(), serializedSensorView);
+
+    osi3::SensorView sensorView;
+    ASSERT_TRUE(sensorView.ParseFromString(serializedSensorView));
+
+    EXPECT_THAT(sensorView.host_vehicle_id().value(), Eq(11));
+    ASSERT_THAT(sensorView.global_ground_truth().moving_object(), SizeIs(1));
+    EXPECT_THAT(sensorView.global_ground_truth().moving_object(0).id().value(), Eq(11));
+    ASSERT_THAT(sensorView.global_ground_truth().lane(), SizeIs(2));
+    EXPECT_THAT(sensorView.global_ground_truth().lane(0).id().value(), Eq(101));
+    EXPECT_THAT(sensorView.global_ground_truth().lane(1).id().value(), Eq(102));
+    ASSERT_THAT(sensorView.global_ground_truth().lane_boundary(), SizeIs(1));
+    EXPECT_THAT(sensorView.global_ground_truth().lane_boundary(0).id().value(), Eq(201));
+}
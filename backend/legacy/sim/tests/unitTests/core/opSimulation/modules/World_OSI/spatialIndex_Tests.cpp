@@ -0,0 +1,81 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "SpatialIndex.h"
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+namespace {
+
+struct TestObject
+{
+    OWL::Primitive::AbsPosition position;
+    OWL::Primitive::Dimension dimension;
+
+    OWL::Primitive::AbsPosition GetReferencePointPosition() const
+    {
+        return position;
+    }
+
+    OWL::Primitive::Dimension GetDimension() const
+    {
+        return dimension;
+    }
+};
+
+} // namespace
+
+TEST(SpatialIndex, GetCandidates_ReturnsObjectsNearOriginInOrderOfBuild)
+{
+    TestObject farObject{{100.0, 0.0, 0.0}, {4.0, 2.0, 1.0}};
+    TestObject nearObject{{5.0, 5.0, 0.0}, {4.0, 2.0, 1.0}};
+    TestObject objectAtOrigin{{0.0, 0.0, 0.0}, {4.0, 2.0, 1.0}};
+    TestObject objectBehind{{-9.0, 0.0, 0.0}, {4.0, 2.0, 1.0}};
+
+    OWL::SpatialIndex<TestObject> index;
+    index.Build({&farObject, &nearObject, &objectAtOrigin, &objectBehind});
+
+    EXPECT_THAT(index.GetCandidates({0.0, 0.0, 0.0}, 10.0), ElementsAre(&nearObject, &objectAtOrigin, &objectBehind));
+    EXPECT_THAT(index.GetCandidates({0.0, 0.0, 0.0}, 1.0), ElementsAre(&objectAtOrigin));
+    EXPECT_THAT(index.GetCandidates({200.0, 0.0, 0.0}, 50.0), IsEmpty());
+}
+
+TEST(SpatialIndex, GetCandidates_ConsidersExtentOfLargestObject)
+{
+    TestObject longObject{{60.0, 0.0, 0.0}, {80.0, 2.0, 1.0}};
+    TestObject smallObject{{30.0, 30.0, 0.0}, {1.0, 1.0, 1.0}};
+
+    OWL::SpatialIndex<TestObject> index;
+    index.Build({&longObject, &smallObject});
+
+    EXPECT_THAT(index.GetCandidates({0.0, 0.0, 0.0}, 25.0), ElementsAre(&longObject, &smallObject));
+}
+
+TEST(SpatialIndex, Build_ReplacesPreviousObjectsAndValidatesIndex)
+{
+    TestObject objectA{{0.0, 0.0, 0.0}, {4.0, 2.0, 1.0}};
+    TestObject objectB{{1.0, 0.0, 0.0}, {4.0, 2.0, 1.0}};
+
+    OWL::SpatialIndex<TestObject> index;
+    EXPECT_FALSE(index.IsValid());
+
+    index.Build({&objectA});
+    EXPECT_TRUE(index.IsValid());
+
+    index.Invalidate();
+    EXPECT_FALSE(index.IsValid());
+
+    index.Build({&objectB});
+    EXPECT_TRUE(index.IsValid());
+    EXPECT_THAT(index.GetCandidates({0.0, 0.0, 0.0}, 5.0), ElementsAre(&objectB));
+}
@@ -12,7 +12,11 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
+#include <thread>
+
+
 #include "WorldDataQuery.h"
+#include "RouteStreamCache.h"
 #include "common/globalDefinitions.h"
 
 #include "fakeWorld.h"
@@ -49,6 +53,7 @@ using ::testing::UnorderedElementsAre;
 using ::testing::IsEmpty;
 using ::testing::SizeIs;
 using ::testing::Const;
+using ::testing::Each;
 using ::testing::DontCare;
 using ::testing::NiceMock;
 
@@ -1670,6 +1675,95 @@ TEST(CreateLaneMultiStream, LinearGraphLanesDontContinue)
     ASSERT_THAT(node2.next, IsEmpty());
 }
 
+TEST(RouteStreamCache, GetLaneMultiStream_ReusesStreamUntilCleared)
+{
+    Fakes::WorldData worldData;
+    RoadGraph roadGraph;
+    auto vertexA = add_vertex(RouteElement{"RoadA", true}, roadGraph);
+
+    OWL::Id idLaneA = 2;
+
+    Fakes::Road roadA;
+    Fakes::Section sectionA;
+    Fakes::Lane laneA;
+    std::string idRoadA = "RoadA";
+    ON_CALL(roadA, GetId()).WillByDefault(ReturnRef(idRoadA));
+    ON_CALL(laneA, GetId()).WillByDefault(Return(idLaneA));
+    ON_CALL(laneA, GetOdId()).WillByDefault(Return(-1));
+    ON_CALL(laneA, GetRoad()).WillByDefault(ReturnRef(roadA));
+    ON_CALL(laneA, GetLength()).WillByDefault(Return(100));
+    ON_CALL(laneA, Exists()).WillByDefault(Return(true));
+    OWL::Interfaces::Sections sectionsA{&sectionA};
+    ON_CALL(roadA, GetSections()).WillByDefault(ReturnRef(sectionsA));
+    OWL::Interfaces::Lanes lanesA{&laneA};
+    ON_CALL(sectionA, GetLanes()).WillByDefault(ReturnRef(lanesA));
+    ON_CALL(sectionA, Covers(_)).WillByDefault(Return(true));
+
+    std::vector<OWL::Id> successorsLanesA {};
+    ON_CALL(laneA, GetNext()).WillByDefault(ReturnRef(successorsLanesA));
+
+    std::unordered_map<std::string, OWL::Road*> roads {{idRoadA, &roadA}};
+    ON_CALL(worldData, GetRoads()).WillByDefault(ReturnRef(roads));
+    ON_CALL(worldData, GetLane(idLaneA)).WillByDefault(ReturnRef(laneA));
+    WorldDataQuery wdQuery(worldData);
+    RouteStreamCache routeStreamCache{roadGraph, wdQuery};
+
+    const auto laneMultiStream = routeStreamCache.GetLaneMultiStream(vertexA, -1, 0.0);
+    ASSERT_THAT(laneMultiStream->GetRoot().element->element, Eq(&laneA));
+    ASSERT_THAT(routeStreamCache.GetLaneMultiStream(vertexA, -1, 50.0), Eq(laneMultiStream));
+
+    routeStreamCache.Clear();
+    ASSERT_THAT(routeStreamCache.GetLaneMultiStream(vertexA, -1, 0.0), Ne(laneMultiStream));
+}
+
+TEST(RouteStreamCache, GetLaneMultiStream_ConcurrentCallsShareOneStream)
+{
+    Fakes::WorldData worldData;
+    RoadGraph roadGraph;
+    auto vertexA = add_vertex(RouteElement{"RoadA", true}, roadGraph);
+
+    OWL::Id idLaneA = 2;
+
+    Fakes::Road roadA;
+    Fakes::Section sectionA;
+    Fakes::Lane laneA;
+    std::string idRoadA = "RoadA";
+    ON_CALL(roadA, GetId()).WillByDefault(ReturnRef(idRoadA));
+    ON_CALL(laneA, GetId()).WillByDefault(Return(idLaneA));
+    ON_CALL(laneA, GetOdId()).WillByDefault(Return(-1));
+    ON_CALL(laneA, GetRoad()).WillByDefault(ReturnRef(roadA));
+    ON_CALL(laneA, GetLength()).WillByDefault(Return(100));
+    ON_CALL(laneA, Exists()).WillByDefault(Return(true));
+    OWL::Interfaces::Sections sectionsA{&sectionA};
+    ON_CALL(roadA, GetSections()).WillByDefault(ReturnRef(sectionsA));
+    OWL::Interfaces::Lanes lanesA{&laneA};
+    ON_CALL(sectionA, GetLanes()).WillByDefault(ReturnRef(lanesA));
+    ON_CALL(sectionA, Covers(_)).WillByDefault(Return(true));
+
+    std::vector<OWL::Id> successorsLanesA {};
+    ON_CALL(laneA, GetNext()).WillByDefault(ReturnRef(successorsLanesA));
+
+    std::unordered_map<std::string, OWL::Road*> roads {{idRoadA, &roadA}};
+    ON_CALL(worldData, GetRoads()).WillByDefault(ReturnRef(roads));
+    ON_CALL(worldData, GetLane(idLaneA)).WillByDefault(ReturnRef(laneA));
+    WorldDataQuery wdQuery(worldData);
+    RouteStreamCache routeStreamCache{roadGraph, wdQuery};
+
+    std::vector<std::shared_ptr<const LaneMultiStream>> laneMultiStreams(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < laneMultiStreams.size(); ++i)
+    {
+        threads.emplace_back([&, i] { laneMultiStreams[i] = routeStreamCache.GetLaneMultiStream(vertexA, -1, 10.0 * i); });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_THAT(laneMultiStreams.front(), Ne(nullptr));
+    ASSERT_THAT(laneMultiStreams, Each(Eq(laneMultiStreams.front())));
+}
+
 TEST(CreateLaneMultiStream, BranchingGraphOneLanePerRoad)
 {
     Fakes::WorldData worldData;
@@ -0,0 +1,79 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "common/poolAllocated.h"
+
+#include <memory>
+#include <thread>
+
+using ::testing::Eq;
+
+namespace {
+
+class PooledObject : public core::PoolAllocated<PooledObject>
+{
+public:
+    PooledObject(int value) :
+        value{value}
+    {}
+
+    virtual ~PooledObject() = default;
+
+    int value;
+    double payload[4]{};
+};
+
+class LargerPooledObject : public PooledObject
+{
+public:
+    LargerPooledObject() :
+        PooledObject{0}
+    {}
+
+    double additionalPayload[16]{};
+};
+
+} // namespace
+
+TEST(PoolAllocated, DeletedObject_MemoryIsReusedByNextObject)
+{
+    auto* first = new PooledObject{1};
+    const void* firstAddress = first;
+    delete first;
+
+    auto second = std::unique_ptr<PooledObject>(new (std::nothrow) PooledObject{2});
+
+    EXPECT_THAT(static_cast<const void*>(second.get()), Eq(firstAddress));
+    EXPECT_THAT(second->value, Eq(2));
+}
+
+TEST(PoolAllocated, DeletedObjectOfDerivedClass_IsNotPooled)
+{
+    const auto freeBlocks = PooledObject::GetFreeBlockCount();
+
+    PooledObject* object = new LargerPooledObject();
+    delete object;
+
+    EXPECT_THAT(PooledObject::GetFreeBlockCount(), Eq(freeBlocks));
+}
+
+TEST(PoolAllocated, ObjectDeletedByOtherThread_IsPooledByThisThread)
+{
+    const auto freeBlocks = PooledObject::GetFreeBlockCount();
+
+    PooledObject* object = nullptr;
+    std::thread([&object] { object = new PooledObject{1}; }).join();
+    delete object;
+
+    EXPECT_THAT(PooledObject::GetFreeBlockCount(), Eq(freeBlocks + 1));
+}
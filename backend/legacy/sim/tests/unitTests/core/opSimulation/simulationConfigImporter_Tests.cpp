@@ -21,6 +21,7 @@ using ::testing::Pair;
 using ::testing::UnorderedElementsAre;
 using ::testing::EndsWith;
 using ::testing::ElementsAre;
+using ::testing::IsEmpty;
 
 using namespace Importer;
 
@@ -146,6 +147,82 @@ TEST(SimulationConfigImporter_UnitTests, ImportExperimentConfigSuccessfully)
     EXPECT_THAT(experimentConfig.experimentId,        1337);
     EXPECT_THAT(experimentConfig.numberOfInvocations, 5);
     EXPECT_THAT(experimentConfig.randomSeed,          12345);
+    EXPECT_THAT(experimentConfig.numberOfThreads,     1);
+    EXPECT_THAT(experimentConfig.numberOfConcurrentInvocations, 1);
+    EXPECT_THAT(experimentConfig.geometryCacheDirectory, IsEmpty());
+}
+
+TEST(SimulationConfigImporter_UnitTests, ImportExperimentConfigWithNumberOfThreads)
+{
+    QDomElement fakeDocumentRoot = documentRootFromString(
+                                       "<root>"
+                                       "<ExperimentID>1337</ExperimentID>"
+                                       "<NumberOfInvocations>5</NumberOfInvocations>"
+                                       "<RandomSeed>12345</RandomSeed>"
+                                       "<NumberOfThreads>8</NumberOfThreads>"
+                                       "</root>"
+                                   );
+
+    QDomElement fakeDocumentRootInvalidNumberOfThreads = documentRootFromString(
+                                       "<root>"
+                                       "<ExperimentID>1337</ExperimentID>"
+                                       "<NumberOfInvocations>5</NumberOfInvocations>"
+                                       "<RandomSeed>12345</RandomSeed>"
+                                       "<NumberOfThreads>0</NumberOfThreads>"
+                                       "</root>"
+                                   );
+
+    Configuration::SimulationConfig simulationConfig;
+
+    EXPECT_NO_THROW(SimulationConfigImporter::ImportExperiment(fakeDocumentRoot, simulationConfig));
+    EXPECT_THAT(simulationConfig.GetExperimentConfig().numberOfThreads, 8);
+
+    ASSERT_THROW(SimulationConfigImporter::ImportExperiment(fakeDocumentRootInvalidNumberOfThreads, simulationConfig), std::runtime_error);
+}
+
+TEST(SimulationConfigImporter_UnitTests, ImportExperimentConfigWithNumberOfConcurrentInvocations)
+{
+    QDomElement fakeDocumentRoot = documentRootFromString(
+                                       "<root>"
+                                       "<ExperimentID>1337</ExperimentID>"
+                                       "<NumberOfInvocations>5</NumberOfInvocations>"
+                                       "<RandomSeed>12345</RandomSeed>"
+                                       "<NumberOfConcurrentInvocations>4</NumberOfConcurrentInvocations>"
+                                       "</root>"
+                                   );
+
+    QDomElement fakeDocumentRootInvalidNumberOfConcurrentInvocations = documentRootFromString(
+                                       "<root>"
+                                       "<ExperimentID>1337</ExperimentID>"
+                                       "<NumberOfInvocations>5</NumberOfInvocations>"
+                                       "<RandomSeed>12345</RandomSeed>"
+                                       "<NumberOfConcurrentInvocations>0</NumberOfConcurrentInvocations>"
+                                       "</root>"
+                                   );
+
+    Configuration::SimulationConfig simulationConfig;
+
+    EXPECT_NO_THROW(SimulationConfigImporter::ImportExperiment(fakeDocumentRoot, simulationConfig));
+    EXPECT_THAT(simulationConfig.GetExperimentConfig().numberOfConcurrentInvocations, 4);
+
+    ASSERT_THROW(SimulationConfigImporter::ImportExperiment(fakeDocumentRootInvalidNumberOfConcurrentInvocations, simulationConfig), std::runtime_error);
+}
+
+TEST(SimulationConfigImporter_UnitTests, ImportExperimentConfigWithGeometryCacheDirectory)
+{
+    QDomElement fakeDocumentRoot = documentRootFromString(
+                                       "<root>"
+                                       "<ExperimentID>1337</ExperimentID>"
+                                       "<NumberOfInvocations>5</NumberOfInvocations>"
+                                       "<RandomSeed>12345</RandomSeed>"
+                                       "<GeometryCacheDirectory>/tmp/geometryCache</GeometryCacheDirectory>"
+                                       "</root>"
+                                   );
+
+    Configuration::SimulationConfig simulationConfig;
+
+    EXPECT_NO_THROW(SimulationConfigImporter::ImportExperiment(fakeDocumentRoot, simulationConfig));
+    EXPECT_THAT(simulationConfig.GetExperimentConfig().geometryCacheDirectory, Eq("/tmp/geometryCache"));
 }
 
 TEST(SimulationConfigImporter_UnitTests, ImportExperimentConfigUnsuccessfully)
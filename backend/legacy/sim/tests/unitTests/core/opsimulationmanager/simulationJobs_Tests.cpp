@@ -0,0 +1,113 @@
+/********************************************************************************
+ * Copyright (c) 2021 in-tech GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ ********************************************************************************/
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "simulationJobs.h"
+
+using ::testing::Contains;
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::Pair;
+using ::testing::SizeIs;
+
+using namespace SimulationManager;
+
+namespace {
+
+Arguments CreateArguments(const Configuration::SimulationConfig& simulationConfig)
+{
+    return {{"--logLevel", "3"},
+            {"--logFile", simulationConfig.logFile},
+            {"--lib", "lib"},
+            {"--configs", simulationConfig.configs},
+            {"--results", simulationConfig.results}};
+}
+
+} // namespace
+
+TEST(SimulationJobs, SplitIntoJobs_WithoutInvocationsPerJob_ReturnsWholeSimulation)
+{
+    const Configuration::SimulationConfig simulationConfig{"logs/opSimulation.log", "configs", "results"};
+    const auto arguments = CreateArguments(simulationConfig);
+
+    const auto jobs = SplitIntoJobs(arguments, simulationConfig, 100, 0);
+
+    ASSERT_THAT(jobs, SizeIs(1));
+    EXPECT_THAT(jobs[0], Eq(arguments));
+}
+
+TEST(SimulationJobs, SplitIntoJobs_WithInvocationsFittingIntoOneJob_ReturnsWholeSimulation)
+{
+    const Configuration::SimulationConfig simulationConfig{"logs/opSimulation.log", "configs", "results"};
+    const auto arguments = CreateArguments(simulationConfig);
+
+    const auto jobs = SplitIntoJobs(arguments, simulationConfig, 10, 10);
+
+    ASSERT_THAT(jobs, SizeIs(1));
+    EXPECT_THAT(jobs[0], Eq(arguments));
+}
+
+TEST(SimulationJobs, SplitIntoJobs_WithMultipleOfInvocationsPerJob_ReturnsDisjointRangesCoveringAllInvocations)
+{
+    const Configuration::SimulationConfig simulationConfig{"logs/opSimulation.log", "configs", "results"};
+
+    const auto jobs = SplitIntoJobs(CreateArguments(simulationConfig), simulationConfig, 30, 10);
+
+    ASSERT_THAT(jobs, SizeIs(3));
+    EXPECT_THAT(jobs[0], Contains(Pair("--invocations", "0-9")));
+    EXPECT_THAT(jobs[1], Contains(Pair("--invocations", "10-19")));
+    EXPECT_THAT(jobs[2], Contains(Pair("--invocations", "20-29")));
+}
+
+TEST(SimulationJobs, SplitIntoJobs_WithRemainder_LastJobExecutesRemainingInvocations)
+{
+    const Configuration::SimulationConfig simulationConfig{"logs/opSimulation.log", "configs", "results"};
+
+    const auto jobs = SplitIntoJobs(CreateArguments(simulationConfig), simulationConfig, 25, 10);
+
+    ASSERT_THAT(jobs, SizeIs(3));
+    EXPECT_THAT(jobs[0], Contains(Pair("--invocations", "0-9")));
+    EXPECT_THAT(jobs[1], Contains(Pair("--invocations", "10-19")));
+    EXPECT_THAT(jobs[2], Contains(Pair("--invocations", "20-24")));
+}
+
+TEST(SimulationJobs, SplitIntoJobs_ReplacesLogFileAndResultsByRangeOfInvocations)
+{
+    const Configuration::SimulationConfig simulationConfig{"logs/opSimulation.log", "configs", "results"};
+
+    const auto jobs = SplitIntoJobs(CreateArguments(simulationConfig), simulationConfig, 15, 10);
+
+    ASSERT_THAT(jobs, SizeIs(2));
+    EXPECT_THAT(jobs[0], ElementsAre(Pair("--logLevel", "3"),
+                                     Pair("--logFile", "logs/opSimulation_Invocations_0-9.log"),
+                                     Pair("--lib", "lib"),
+                                     Pair("--configs", "configs"),
+                                     Pair("--results", "results/Invocations_0-9"),
+                                     Pair("--invocations", "0-9")));
+    EXPECT_THAT(jobs[1], ElementsAre(Pair("--logLevel", "3"),
+                                     Pair("--logFile", "logs/opSimulation_Invocations_10-14.log"),
+                                     Pair("--lib", "lib"),
+                                     Pair("--configs", "configs"),
+                                     Pair("--results", "results/Invocations_10-14"),
+                                     Pair("--invocations", "10-14")));
+}
+
+TEST(SimulationJobs, SplitIntoJobs_WithLogFileWithoutSuffix_AppendsRangeOfInvocations)
+{
+    const Configuration::SimulationConfig simulationConfig{"logs/opSimulation", "configs", "results"};
+
+    const auto jobs = SplitIntoJobs(CreateArguments(simulationConfig), simulationConfig, 20, 10);
+
+    ASSERT_THAT(jobs, SizeIs(2));
+    EXPECT_THAT(jobs[0], Contains(Pair("--logFile", "logs/opSimulation_Invocations_0-9")));
+    EXPECT_THAT(jobs[1], Contains(Pair("--logFile", "logs/opSimulation_Invocations_10-19")));
+}
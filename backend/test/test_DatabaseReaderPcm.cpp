@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2023 Hexad GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ */
+
+#include <map>
+#include <memory>
+
+#include <QSqlDatabase>
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include "test_DatabaseReaderPcm.h"
+#include "DatabaseReaderPcm.h"
+
+// PARTID is stored as text here, so the trajectories are ordered "10" before "2"
+const QStringList testDatabaseStatements = {
+    "CREATE TABLE participant_data (CASEID TEXT, PARTID TEXT, PARTTYPE REAL, LENGTH REAL, WIDTH REAL, HEIGHT REAL, TRACKWIDTH REAL, WHEELBASE REAL, FRONTAXLEX REAL, WEIGHT REAL, COGZ REAL, IXX REAL, IYY REAL, IZZ REAL)",
+    "CREATE TABLE participant_shape (CASEID TEXT, PARTID TEXT, X REAL)",
+    "CREATE TABLE dynamics (CASEID TEXT, PARTID TEXT, TIME REAL, POSX REAL, POSY REAL, POSPSI REAL, VX REAL, VY REAL, AX REAL, AY REAL, MUE REAL)",
+
+    "INSERT INTO participant_data VALUES ('1', '1', 0, 4.5, 1.8, 1.4, 1.5, 2.6, 1.1, 1450, 0.7, 500, 2000, 2200)",
+    "INSERT INTO participant_data VALUES ('1', '2', 0, 4.2, 1.7, 1.5, 1.4, 2.5, 1.0, 1300, 0.6, 450, 1900, 2100)",
+    "INSERT INTO participant_data VALUES ('2', '2', 0, 4.8, 1.9, 1.4, 1.6, 2.8, 1.2, 1600, 0.7, 550, 2300, 2500)",
+    "INSERT INTO participant_data VALUES ('2', '10', 1, 0.5, 0.8, 1.75, 99999, 99999, 0.2, 60, 0.4, 99999, 99999, 99999)",
+    "INSERT INTO participant_data VALUES ('3', '1', 0, 4.0, 1.6, 1.4, 1.4, 2.4, 1.0, 1200, 0.6, 400, 1800, 2000)",
+    "INSERT INTO participant_data VALUES ('3', '2', 0, 4.4, 1.8, 1.5, 1.5, 2.7, 1.1, 1400, 0.7, 480, 2100, 2300)",
+
+    "INSERT INTO participant_shape VALUES ('1', '1', 1.8), ('1', '1', 2.1), ('1', '2', 2.0)",
+    "INSERT INTO participant_shape VALUES ('2', '2', 2.3), ('2', '10', -0.1)",
+    "INSERT INTO participant_shape VALUES ('3', '1', 1.9)",
+
+    "INSERT INTO dynamics VALUES ('1', '1', 0.0, -80.0, 0.0, 0.0, 16.6, 0.0, 0.0, 0.0, 0.92)",
+    "INSERT INTO dynamics VALUES ('1', '1', 0.01, -79.8, 0.0, 0.0, 16.6, 0.0, 0.0, 0.0, 0.5)",
+    "INSERT INTO dynamics VALUES ('1', '2', 0.0, 10.0, -30.0, 1.57, 0.0, 12.0, 0.0, 0.0, 0.8)",
+    "INSERT INTO dynamics VALUES ('1', '2', 0.01, 10.0, -29.9, 1.57, 0.0, 12.0, 0.0, 0.0, 0.8)",
+    // samples stored out of time order
+    "INSERT INTO dynamics VALUES ('2', '10', 0.02, 5.0, 5.2, 3.14, 0.0, 2.0, 0.0, 0.0, 0.7)",
+    "INSERT INTO dynamics VALUES ('2', '10', 0.0, 5.0, 5.0, 3.14, 0.0, 2.0, 0.0, 0.0, 0.7)",
+    "INSERT INTO dynamics VALUES ('2', '2', 0.0, -50.0, 0.0, 0.0, 20.0, 0.0, -1.0, 0.0, 0.9)",
+    "INSERT INTO dynamics VALUES ('2', '10', 0.01, 5.0, 5.1, 3.14, 0.0, 2.0, 0.0, 0.0, 0.7)",
+    "INSERT INTO dynamics VALUES ('2', '2', 0.01, -49.8, 0.0, 0.0, 20.0, 0.0, -1.0, 0.0, 0.9)",
+    "INSERT INTO dynamics VALUES ('3', '1', 0.0, 0.0, 0.0, 0.0, 10.0, 0.0, 0.0, 0.0, 0.85)",
+    "INSERT INTO dynamics VALUES ('3', '2', 0.0, 20.0, 0.0, 3.14, -10.0, 0.0, 0.0, 0.0, 0.85)",
+    "INSERT INTO dynamics VALUES ('3', '2', 0.01, 19.9, 0.0, 3.14, -10.0, 0.0, 0.0, 0.0, 0.85)"
+};
+
+bool DATABASE_READER_PCM_TEST::createDatabase(const QStringList &statements) {
+    const QString connectionName = QStringLiteral("DATABASE_READER_PCM_TEST");
+    bool success = true;
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+        db.setDatabaseName(this->databasePath);
+        success = db.open();
+
+        QSqlQuery query(db);
+        for (const QString &statement : statements) {
+            if (success && !query.exec(statement)) {
+                ADD_FAILURE() << "Failed to execute '" << statement.toStdString() << "': " << query.lastError().text().toStdString();
+                success = false;
+            }
+        }
+        db.close();
+    }
+    QSqlDatabase::removeDatabase(connectionName);
+    return success;
+}
+
+void DATABASE_READER_PCM_TEST::expectEqualSimulationSets(const PCM_SimulationSet &expected, const PCM_SimulationSet &actual) {
+    ASSERT_EQ(actual.GetParticipants().size(), expected.GetParticipants().size());
+    for (size_t i = 0; i < expected.GetParticipants().size(); ++i) {
+        const PCM_ParticipantData *expectedParticipant = expected.GetParticipants()[i];
+        const PCM_ParticipantData *actualParticipant = actual.GetParticipants()[i];
+        EXPECT_EQ(actualParticipant->GetType(), expectedParticipant->GetType()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetWidth(), expectedParticipant->GetWidth()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetLength(), expectedParticipant->GetLength()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetDistcgfa(), expectedParticipant->GetDistcgfa()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetWeight(), expectedParticipant->GetWeight()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetHeightcg(), expectedParticipant->GetHeightcg()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetWheelbase(), expectedParticipant->GetWheelbase()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetIxx(), expectedParticipant->GetIxx()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetIyy(), expectedParticipant->GetIyy()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetIzz(), expectedParticipant->GetIzz()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetMue(), expectedParticipant->GetMue()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetTrackwidth(), expectedParticipant->GetTrackwidth()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetHeight(), expectedParticipant->GetHeight()) << "participant " << i;
+        EXPECT_EQ(actualParticipant->GetCgfront(), expectedParticipant->GetCgfront()) << "participant " << i;
+    }
+
+    ASSERT_EQ(actual.GetInitials().size(), expected.GetInitials().size());
+    for (size_t i = 0; i < expected.GetInitials().size(); ++i) {
+        const PCM_InitialValues *expectedInitials = expected.GetInitials()[i];
+        const PCM_InitialValues *actualInitials = actual.GetInitials()[i];
+        EXPECT_EQ(actualInitials->GetXpos(), expectedInitials->GetXpos()) << "initial values " << i;
+        EXPECT_EQ(actualInitials->GetYpos(), expectedInitials->GetYpos()) << "initial values " << i;
+        EXPECT_EQ(actualInitials->GetVx(), expectedInitials->GetVx()) << "initial values " << i;
+        EXPECT_EQ(actualInitials->GetVy(), expectedInitials->GetVy()) << "initial values " << i;
+        EXPECT_EQ(actualInitials->GetAx(), expectedInitials->GetAx()) << "initial values " << i;
+        EXPECT_EQ(actualInitials->GetAy(), expectedInitials->GetAy()) << "initial values " << i;
+        EXPECT_EQ(actualInitials->GetPsi(), expectedInitials->GetPsi()) << "initial values " << i;
+    }
+
+    ASSERT_EQ(actual.GetTrajectories().size(), expected.GetTrajectories().size());
+    for (size_t i = 0; i < expected.GetTrajectories().size(); ++i) {
+        const PCM_Trajectory *expectedTrajectory = expected.GetTrajectories()[i];
+        const PCM_Trajectory *actualTrajectory = actual.GetTrajectories()[i];
+        EXPECT_EQ(*actualTrajectory->GetTimeVec(), *expectedTrajectory->GetTimeVec()) << "trajectory " << i;
+        EXPECT_EQ(*actualTrajectory->GetXPosVec(), *expectedTrajectory->GetXPosVec()) << "trajectory " << i;
+        EXPECT_EQ(*actualTrajectory->GetYPosVec(), *expectedTrajectory->GetYPosVec()) << "trajectory " << i;
+        EXPECT_EQ(*actualTrajectory->GetUVelVec(), *expectedTrajectory->GetUVelVec()) << "trajectory " << i;
+        EXPECT_EQ(*actualTrajectory->GetVVelVec(), *expectedTrajectory->GetVVelVec()) << "trajectory " << i;
+        EXPECT_EQ(*actualTrajectory->GetPsiVec(), *expectedTrajectory->GetPsiVec()) << "trajectory " << i;
+    }
+}
+
+void DATABASE_READER_PCM_TEST::SetUp() {
+    ASSERT_TRUE(this->testDir.isValid()) << "Could not create temporary test dir";
+    this->databasePath = this->testDir.filePath("test_cases.db");
+    ASSERT_TRUE(createDatabase(testDatabaseStatements)) << "Could not create test database at: " << this->databasePath.toStdString();
+}
+
+TEST_F(DATABASE_READER_PCM_TEST, read_batch_equals_read_per_case_POSITIVE) {
+    const QStringList pcmCases = {"1", "2", "3"};
+
+    // Read opens and closes the database itself
+    std::map<QString, std::unique_ptr<PCM_SimulationSet>> expectedSimulationSets;
+    DatabaseReader caseReader;
+    ASSERT_TRUE(caseReader.SetDatabase(this->databasePath));
+    for (const QString &pcmCase : pcmCases) {
+        std::unique_ptr<PCM_SimulationSet> simulationSet(caseReader.Read(pcmCase));
+        ASSERT_NE(simulationSet.get(), nullptr) << "Test: Read failed for case " << pcmCase.toStdString();
+        expectedSimulationSets.emplace(pcmCase, std::move(simulationSet));
+    }
+
+    std::map<QString, std::unique_ptr<PCM_SimulationSet>> simulationSets;
+    DatabaseReader batchReader;
+    ASSERT_TRUE(batchReader.SetDatabase(this->databasePath));
+    ASSERT_TRUE(batchReader.OpenDataBase());
+    ASSERT_TRUE(batchReader.ReadBatch(pcmCases, simulationSets));
+    batchReader.CloseDataBase();
+
+    ASSERT_EQ(simulationSets.size(), expectedSimulationSets.size());
+    for (const QString &pcmCase : pcmCases) {
+        ASSERT_EQ(simulationSets.count(pcmCase), 1u) << "Test: ReadBatch did not return case " << pcmCase.toStdString();
+        SCOPED_TRACE("case " + pcmCase.toStdString());
+        expectEqualSimulationSets(*expectedSimulationSets.at(pcmCase), *simulationSets.at(pcmCase));
+    }
+}
+
+TEST_F(DATABASE_READER_PCM_TEST, read_batch_orders_trajectories_like_read_POSITIVE) {
+    std::map<QString, std::unique_ptr<PCM_SimulationSet>> simulationSets;
+    DatabaseReader batchReader;
+    ASSERT_TRUE(batchReader.SetDatabase(this->databasePath));
+    ASSERT_TRUE(batchReader.OpenDataBase());
+    ASSERT_TRUE(batchReader.ReadBatch(QStringList() << "2", simulationSets));
+    batchReader.CloseDataBase();
+
+    ASSERT_EQ(simulationSets.count(QStringLiteral("2")), 1u);
+    const auto &trajectories = simulationSets.at(QStringLiteral("2"))->GetTrajectories();
+    ASSERT_EQ(trajectories.size(), 2u);
+
+    // GROUP BY on the text column PARTID puts participant "10" (starting at y = 5) before participant "2"
+    EXPECT_EQ(*trajectories[0]->GetYPosVec(), std::vector<double>({5.0, 5.1, 5.2}));
+    EXPECT_EQ(*trajectories[0]->GetTimeVec(), std::vector<double>({0.0, 0.01, 0.02}));
+    EXPECT_EQ(*trajectories[1]->GetXPosVec(), std::vector<double>({-50.0, -49.8}));
+}
+
+TEST_F(DATABASE_READER_PCM_TEST, read_batch_database_not_open_NEGATIVE) {
+    std::map<QString, std::unique_ptr<PCM_SimulationSet>> simulationSets;
+    DatabaseReader batchReader;
+    ASSERT_TRUE(batchReader.SetDatabase(this->databasePath));
+
+    EXPECT_FALSE(batchReader.ReadBatch(QStringList() << "1", simulationSets));
+    EXPECT_TRUE(simulationSets.empty());
+}
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2023 Hexad GmbH
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <QString>
+#include <QStringList>
+#include <QTemporaryDir>
+
+class PCM_SimulationSet;
+
+class DATABASE_READER_PCM_TEST : public ::testing::Test {
+  public:
+    QTemporaryDir testDir;
+    QString databasePath;
+
+    bool createDatabase(const QStringList &statements);
+
+    void expectEqualSimulationSets(const PCM_SimulationSet &expected, const PCM_SimulationSet &actual);
+
+    void SetUp() override;
+};
@@ -9,6 +9,7 @@
  *
  */
 #include <QDir>
+#include <QDirIterator>
 #include <QDebug>
 #include <QJsonObject>
 #include <QDateTime>
@@ -410,6 +411,49 @@ void CONVERT_TO_CONFIGS_TEST::verifyConfigsDirectoryStructure(const QString &bas
 }
 
 
+static QMap<QString, QByteArray> readFilesRecursively(const QString &basePath) {
+    QMap<QString, QByteArray> files;
+    QDir base(basePath);
+    QDirIterator it(basePath, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        QFile file(it.next());
+        if (file.open(QIODevice::ReadOnly)) {
+            files.insert(base.relativeFilePath(file.fileName()), file.readAll());
+        }
+    }
+    return files;
+}
+
+void CONVERT_TO_CONFIGS_TEST::GenerateConfigs(int configWriterCount, QMap<QString, QByteArray> &files, QByteArray &frameworkConfig) {
+    QDir dirTest(this->testDirFullPath);
+    ASSERT_TRUE(dirTest.removeRecursively());
+    ASSERT_TRUE(dirTest.mkpath(this->testDirFullPath));
+
+    this->DeleteSimulation();
+    this->InitSimulation(this->destinationFilePathTestDB);
+    OPGUIPCMSimulation::PCMSimulation *sim = OPGUICore::getSimulation();
+    ASSERT_NE(sim, nullptr);
+
+    // two systems for each car result in several system combinations, which are written in parallel
+    sim->setAgentsCar1(QStringList() << this->filePathSys1 << this->filePathSys2);
+    sim->setAgentsCar2(QStringList() << this->filePathSys2 << this->filePathSys1);
+    sim->setAgentsOther(QStringList() << this->filePathSys2);
+    sim->setConfigWriterCount(configWriterCount);
+
+    QString errorMsg;
+    ASSERT_TRUE(sim->UIGenerateConfigOfPCMCases(QStringList() << "1", errorMsg)) << errorMsg.toStdString();
+    ASSERT_TRUE(sim->GenerateSimulationXmlUsingSharedConfig(errorMsg)) << errorMsg.toStdString();
+
+    // the framework config lists the config sets in the order they were registered, its name contains a timestamp
+    QFile frameworkConfigFile(sim->getPathGeneratedOPSimulationManagerConfig());
+    ASSERT_TRUE(frameworkConfigFile.open(QIODevice::ReadOnly));
+    frameworkConfig = frameworkConfigFile.readAll();
+    frameworkConfigFile.close();
+    ASSERT_TRUE(frameworkConfigFile.remove());
+
+    files = readFilesRecursively(this->testDirFullPath);
+}
+
 void CONVERT_TO_CONFIGS_TEST::SetUp()  {
     ASSERT_TRUE(OPGUICoreGlobalConfig::getInstance().isInitializationSuccessful())
             << "Failed to initialize the global configuration.";
@@ -648,6 +692,26 @@ TEST_F(CONVERT_TO_CONFIGS_TEST, convert_to_configs_simulation_inited_POSITIVE) {
 
 }
 
+TEST_F(CONVERT_TO_CONFIGS_TEST, convert_to_configs_parallel_writers_match_serial_writer_POSITIVE) {
+    QMap<QString, QByteArray> serialFiles;
+    QByteArray serialFrameworkConfig;
+    ASSERT_NO_FATAL_FAILURE(GenerateConfigs(1, serialFiles, serialFrameworkConfig));
+
+    QMap<QString, QByteArray> parallelFiles;
+    QByteArray parallelFrameworkConfig;
+    ASSERT_NO_FATAL_FAILURE(GenerateConfigs(4, parallelFiles, parallelFrameworkConfig));
+
+    ASSERT_FALSE(serialFiles.isEmpty()) << "Test: No configs were generated";
+    ASSERT_TRUE(serialFiles.contains("1/0-1-1/configs/simulationConfig.xml")) << "Test: Configs of a system combination are missing";
+
+    // the generated files contain the random seeds, so equal files also mean equal seeds
+    EXPECT_EQ(parallelFiles.keys(), serialFiles.keys()) << "Test: Parallel writers generated other files than a single writer";
+    for (auto it = serialFiles.constBegin(); it != serialFiles.constEnd(); ++it) {
+        EXPECT_EQ(parallelFiles.value(it.key()), it.value()) << "Test: Content differs for " << it.key().toStdString();
+    }
+    EXPECT_EQ(parallelFrameworkConfig, serialFrameworkConfig) << "Test: Config sets were registered in another order";
+}
+
 
 
 
@@ -12,6 +12,8 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <QByteArray>
+#include <QMap>
 #include <QString>
 
 #include <OPGUICoreGlobalConfig.h>
@@ -42,6 +44,8 @@ class CONVERT_TO_CONFIGS_TEST : public ::testing::Test {
 
     void DeleteSimulation();
 
+    void GenerateConfigs(int configWriterCount, QMap<QString, QByteArray> &files, QByteArray &frameworkConfig);
+
     void SetUp() override;
     
     void TearDown() override;